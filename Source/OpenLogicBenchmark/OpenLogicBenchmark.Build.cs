@@ -0,0 +1,32 @@
+// Copyright 2025 - NegativeNameSeller
+
+using UnrealBuildTool;
+
+public class OpenLogicBenchmark : ModuleRules
+{
+	public OpenLogicBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"OpenLogicV2"
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Json",
+				"JsonUtilities",
+				"OpenLogicNodes",
+				"Projects"
+			}
+			);
+	}
+}
@@ -0,0 +1,27 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicBenchmark.h"
+#include "OpenLogicBenchmarkRunner.h"
+#include "HAL/IConsoleManager.h"
+
+#define LOCTEXT_NAMESPACE "FOpenLogicBenchmarkModule"
+
+static FAutoConsoleCommand OpenLogicBenchmarkCommand(
+	TEXT("OpenLogic.Benchmark"),
+	TEXT("Runs the OpenLogic runtime benchmarks and writes a JSON report.\n")
+	TEXT("Arguments: [Shape=Chain|FanOut|DataDepth|ForLoop|ManyHandles] [Size=N] [Iterations=N] [Warmup=N] [Baseline=<file>] [Threshold=0.1] [Output=<file>]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UOpenLogicBenchmarkRunner::RunFromCommandLine(*FString::Join(Args, TEXT(" ")));
+	}));
+
+void FOpenLogicBenchmarkModule::StartupModule()
+{}
+
+void FOpenLogicBenchmarkModule::ShutdownModule()
+{}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FOpenLogicBenchmarkModule, OpenLogicBenchmark)
+DEFINE_LOG_CATEGORY(OpenLogicBenchmarkLog);
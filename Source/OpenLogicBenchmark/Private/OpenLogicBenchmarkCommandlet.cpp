@@ -0,0 +1,17 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicBenchmarkCommandlet.h"
+#include "OpenLogicBenchmarkRunner.h"
+
+UOpenLogicBenchmarkCommandlet::UOpenLogicBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UOpenLogicBenchmarkCommandlet::Main(const FString& Params)
+{
+	return UOpenLogicBenchmarkRunner::RunFromCommandLine(*Params);
+}
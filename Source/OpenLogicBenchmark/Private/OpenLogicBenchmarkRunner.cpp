@@ -0,0 +1,400 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicBenchmarkRunner.h"
+#include "OpenLogicBenchmark.h"
+#include "OpenLogicGraphGenerator.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Utility/OpenLogicUtility.h"
+#include "Event/Task_OnGraphStart.h"
+#include "Engine/Engine.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+FOpenLogicLatencySummary FOpenLogicLatencySummary::FromSamples(TArray<double>& Samples)
+{
+	FOpenLogicLatencySummary Summary;
+	Summary.SampleCount = Samples.Num();
+
+	if (Samples.IsEmpty())
+	{
+		return Summary;
+	}
+
+	Samples.Sort();
+
+	auto Percentile = [&Samples](double Fraction)
+	{
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1);
+		return Samples[Index];
+	};
+
+	double Total = 0.0;
+	for (const double Sample : Samples)
+	{
+		Total += Sample;
+	}
+
+	Summary.MeanMicroseconds = Total / Samples.Num();
+	Summary.P50Microseconds = Percentile(0.50);
+	Summary.P95Microseconds = Percentile(0.95);
+	Summary.P99Microseconds = Percentile(0.99);
+	Summary.MaxMicroseconds = Samples.Last();
+
+	return Summary;
+}
+
+// The heap allocations made so far by the process. The allocator only counts them when stats are compiled in.
+static int64 GetAllocationCount()
+{
+#if STATS
+	return static_cast<int64>(FMalloc::TotalMallocCalls) + static_cast<int64>(FMalloc::TotalReallocCalls);
+#else
+	return 0;
+#endif
+}
+
+bool FOpenLogicBenchmarkReport::HasRegressions() const
+{
+	return Comparisons.ContainsByPredicate([](const FOpenLogicBenchmarkComparison& Comparison) { return Comparison.bRegressed; });
+}
+
+FOpenLogicBenchmarkResult UOpenLogicBenchmarkRunner::Run(const FOpenLogicBenchmarkSettings& Settings)
+{
+	FOpenLogicBenchmarkResult Result;
+	Result.Settings = Settings;
+	Result.Name = FString::Printf(TEXT("%s_%d"), *StaticEnum<EOpenLogicBenchmarkShape>()->GetNameStringByValue(static_cast<int64>(Settings.Shape)), Settings.Size);
+
+	const FOpenLogicGraphData GraphData = FOpenLogicGraphGenerator::Generate(Settings.Shape, Settings.Size);
+	Result.NodeCount = GraphData.Nodes.Num();
+
+	UOpenLogicRuntimeGraph* RuntimeGraph = UOpenLogicUtility::CreateRuntimeGraphFromStruct(this, this, GraphData);
+	if (!RuntimeGraph)
+	{
+		UE_LOG(OpenLogicBenchmarkLog, Error, TEXT("[%s] Failed to create the runtime graph."), *Result.Name);
+		return Result;
+	}
+
+	RuntimeGraph->OnNodeActivatedNative.AddUObject(this, &UOpenLogicBenchmarkRunner::OnNodeActivated);
+	RuntimeGraph->OnNodeCompletedNative.AddUObject(this, &UOpenLogicBenchmarkRunner::OnNodeCompleted);
+
+	const int32 HandlesPerIteration = Settings.Shape == EOpenLogicBenchmarkShape::ManyHandles ? FMath::Max(Settings.Size, 1) : 1;
+
+	TArray<FOpenLogicGraphExecutionHandle> Handles;
+	Handles.Reserve(HandlesPerIteration);
+
+	TArray<double> HandleSamples;
+	HandleSamples.Reserve(Settings.Iterations * HandlesPerIteration);
+
+	ActivationStartCycles.Reset();
+	ActivationSamples.Reset();
+	ActivationCount = 0;
+
+	if (Settings.bSuppressRuntimeLog && GEngine)
+	{
+		GEngine->Exec(nullptr, TEXT("Log OpenLogicLog Off"));
+	}
+
+	FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	uint64 StartUsedMemory = MemoryStats.UsedPhysical;
+	uint64 PeakUsedMemory = StartUsedMemory;
+	int32 StartObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	int64 StartAllocationCount = GetAllocationCount();
+	double StartTime = FPlatformTime::Seconds();
+
+	for (int32 Iteration = 0; Iteration < Settings.WarmupIterations + Settings.Iterations; Iteration++)
+	{
+		// Start measuring once the warmup iterations filled the task pools
+		if (Iteration == Settings.WarmupIterations)
+		{
+			bMeasuring = true;
+
+			MemoryStats = FPlatformMemory::GetStats();
+			StartUsedMemory = MemoryStats.UsedPhysical;
+			PeakUsedMemory = StartUsedMemory;
+			StartObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+			StartAllocationCount = GetAllocationCount();
+			StartTime = FPlatformTime::Seconds();
+		}
+
+		for (int32 HandleIndex = 0; HandleIndex < HandlesPerIteration; HandleIndex++)
+		{
+			FOpenLogicGraphExecutionHandle Handle;
+
+			const uint64 TriggerCycles = FPlatformTime::Cycles64();
+			RuntimeGraph->TriggerEvent(UTask_OnGraphStart::StaticClass(), true, Handle);
+
+			if (bMeasuring)
+			{
+				HandleSamples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - TriggerCycles) * 1000.0);
+			}
+
+			Handles.Add(Handle);
+		}
+
+		if (bMeasuring)
+		{
+			PeakUsedMemory = FMath::Max(PeakUsedMemory, FPlatformMemory::GetStats().UsedPhysical);
+		}
+
+		for (const FOpenLogicGraphExecutionHandle& Handle : Handles)
+		{
+			RuntimeGraph->BP_DestroyExecutionHandle(Handle);
+		}
+
+		Handles.Reset();
+	}
+
+	Result.WallSeconds = FPlatformTime::Seconds() - StartTime;
+	Result.AllocationCount = GetAllocationCount() - StartAllocationCount;
+	Result.UsedMemoryDeltaBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StartUsedMemory);
+	Result.PeakMemoryDeltaBytes = static_cast<int64>(PeakUsedMemory) - static_cast<int64>(StartUsedMemory);
+	Result.ObjectCountDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - StartObjectCount;
+
+	bMeasuring = false;
+
+	if (Settings.bSuppressRuntimeLog && GEngine)
+	{
+		GEngine->Exec(nullptr, TEXT("Log OpenLogicLog Default"));
+	}
+
+	Result.TotalActivations = ActivationCount;
+	Result.ActivationsPerSecond = Result.WallSeconds > 0.0 ? ActivationCount / Result.WallSeconds : 0.0;
+	Result.AllocationsPerActivation = ActivationCount > 0 ? static_cast<double>(Result.AllocationCount) / ActivationCount : 0.0;
+	Result.HandleLatency = FOpenLogicLatencySummary::FromSamples(HandleSamples);
+	Result.ActivationLatency = FOpenLogicLatencySummary::FromSamples(ActivationSamples);
+
+	RuntimeGraph->OnNodeActivatedNative.RemoveAll(this);
+	RuntimeGraph->OnNodeCompletedNative.RemoveAll(this);
+	RuntimeGraph->DestroyWorker();
+
+	ActivationStartCycles.Reset();
+	ActivationSamples.Reset();
+
+	UE_LOG(OpenLogicBenchmarkLog, Display, TEXT("[%s] %lld activations in %.3fs (%.0f/s), handle p95 %.2fus, activation p50 %.2fus p95 %.2fus p99 %.2fus, peak memory +%lld bytes, objects +%d, allocations %lld (%.2f per activation)"),
+		*Result.Name, Result.TotalActivations, Result.WallSeconds, Result.ActivationsPerSecond, Result.HandleLatency.P95Microseconds,
+		Result.ActivationLatency.P50Microseconds, Result.ActivationLatency.P95Microseconds, Result.ActivationLatency.P99Microseconds,
+		Result.PeakMemoryDeltaBytes, Result.ObjectCountDelta, Result.AllocationCount, Result.AllocationsPerActivation);
+
+	return Result;
+}
+
+FOpenLogicBenchmarkReport UOpenLogicBenchmarkRunner::RunSuite(const TArray<FOpenLogicBenchmarkSettings>& Suite, const FString& BaselineFile, float RegressionThreshold)
+{
+	FOpenLogicBenchmarkReport Report;
+	Report.EngineVersion = FEngineVersion::Current().ToString();
+	Report.Timestamp = FDateTime::UtcNow().ToIso8601();
+
+	if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("OpenLogicV2")))
+	{
+		Report.PluginVersion = Plugin->GetDescriptor().VersionName;
+	}
+
+	UOpenLogicBenchmarkRunner* Runner = NewObject<UOpenLogicBenchmarkRunner>(GetTransientPackage());
+	Runner->AddToRoot();
+
+	for (const FOpenLogicBenchmarkSettings& Settings : Suite)
+	{
+		Report.Results.Add(Runner->Run(Settings));
+	}
+
+	Runner->RemoveFromRoot();
+
+	if (!BaselineFile.IsEmpty())
+	{
+		FOpenLogicBenchmarkReport Baseline;
+		if (LoadReport(BaselineFile, Baseline))
+		{
+			Report.BaselineFile = BaselineFile;
+			CompareWithBaseline(Report, Baseline, RegressionThreshold);
+		}
+		else
+		{
+			UE_LOG(OpenLogicBenchmarkLog, Warning, TEXT("Could not load the baseline report %s."), *BaselineFile);
+		}
+	}
+
+	return Report;
+}
+
+int32 UOpenLogicBenchmarkRunner::RunFromCommandLine(const TCHAR* Params)
+{
+	TArray<FOpenLogicBenchmarkSettings> Suite;
+
+	FString ShapeName;
+	if (FParse::Value(Params, TEXT("Shape="), ShapeName))
+	{
+		const int64 ShapeValue = StaticEnum<EOpenLogicBenchmarkShape>()->GetValueByNameString(ShapeName);
+		if (ShapeValue == INDEX_NONE)
+		{
+			UE_LOG(OpenLogicBenchmarkLog, Error, TEXT("Unknown benchmark shape %s."), *ShapeName);
+			return 1;
+		}
+
+		FOpenLogicBenchmarkSettings Settings;
+		Settings.Shape = static_cast<EOpenLogicBenchmarkShape>(ShapeValue);
+		FParse::Value(Params, TEXT("Size="), Settings.Size);
+		Suite.Add(Settings);
+	}
+	else
+	{
+		Suite = GetDefaultSuite();
+	}
+
+	int32 Iterations = INDEX_NONE;
+	int32 WarmupIterations = INDEX_NONE;
+	FParse::Value(Params, TEXT("Iterations="), Iterations);
+	FParse::Value(Params, TEXT("Warmup="), WarmupIterations);
+
+	for (FOpenLogicBenchmarkSettings& Settings : Suite)
+	{
+		Settings.Iterations = Iterations > 0 ? Iterations : Settings.Iterations;
+		Settings.WarmupIterations = WarmupIterations >= 0 ? WarmupIterations : Settings.WarmupIterations;
+	}
+
+	FString BaselineFile;
+	FParse::Value(Params, TEXT("Baseline="), BaselineFile);
+
+	float RegressionThreshold = 0.1f;
+	FParse::Value(Params, TEXT("Threshold="), RegressionThreshold);
+
+	FString OutputFile;
+	if (!FParse::Value(Params, TEXT("Output="), OutputFile))
+	{
+		OutputFile = GetDefaultOutputPath();
+	}
+
+	const FOpenLogicBenchmarkReport Report = RunSuite(Suite, BaselineFile, RegressionThreshold);
+
+	if (SaveReport(Report, OutputFile))
+	{
+		UE_LOG(OpenLogicBenchmarkLog, Display, TEXT("Benchmark report written to %s"), *OutputFile);
+	}
+
+	for (const FOpenLogicBenchmarkComparison& Comparison : Report.Comparisons)
+	{
+		UE_LOG(OpenLogicBenchmarkLog, Display, TEXT("[%s] throughput x%.3f, p95 latency x%.3f%s"),
+			*Comparison.Name, Comparison.ThroughputRatio, Comparison.P95LatencyRatio, Comparison.bRegressed ? TEXT(" - REGRESSION") : TEXT(""));
+	}
+
+	return Report.HasRegressions() ? 1 : 0;
+}
+
+TArray<FOpenLogicBenchmarkSettings> UOpenLogicBenchmarkRunner::GetDefaultSuite()
+{
+	TArray<FOpenLogicBenchmarkSettings> Suite;
+
+	auto AddSettings = [&Suite](EOpenLogicBenchmarkShape Shape, int32 Size, int32 Iterations)
+	{
+		FOpenLogicBenchmarkSettings& Settings = Suite.AddDefaulted_GetRef();
+		Settings.Shape = Shape;
+		Settings.Size = Size;
+		Settings.Iterations = Iterations;
+	};
+
+	AddSettings(EOpenLogicBenchmarkShape::Chain, 256, 200);
+	AddSettings(EOpenLogicBenchmarkShape::FanOut, 256, 200);
+	AddSettings(EOpenLogicBenchmarkShape::DataDepth, 256, 200);
+	AddSettings(EOpenLogicBenchmarkShape::ForLoop, 1000, 100);
+	AddSettings(EOpenLogicBenchmarkShape::ManyHandles, 1000, 50);
+
+	return Suite;
+}
+
+bool UOpenLogicBenchmarkRunner::SaveReport(const FOpenLogicBenchmarkReport& Report, const FString& FilePath)
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, JsonString))
+	{
+		UE_LOG(OpenLogicBenchmarkLog, Error, TEXT("Failed to serialize the benchmark report."));
+		return false;
+	}
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *FilePath))
+	{
+		UE_LOG(OpenLogicBenchmarkLog, Error, TEXT("Failed to write the benchmark report to %s."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool UOpenLogicBenchmarkRunner::LoadReport(const FString& FilePath, FOpenLogicBenchmarkReport& OutReport)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+
+	return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutReport);
+}
+
+void UOpenLogicBenchmarkRunner::CompareWithBaseline(FOpenLogicBenchmarkReport& Report, const FOpenLogicBenchmarkReport& Baseline, float RegressionThreshold)
+{
+	Report.Comparisons.Reset();
+
+	for (const FOpenLogicBenchmarkResult& Result : Report.Results)
+	{
+		const FOpenLogicBenchmarkResult* BaselineResult = Baseline.Results.FindByPredicate([&Result](const FOpenLogicBenchmarkResult& Other)
+		{
+			return Other.Name == Result.Name;
+		});
+
+		if (!BaselineResult)
+		{
+			continue;
+		}
+
+		FOpenLogicBenchmarkComparison& Comparison = Report.Comparisons.AddDefaulted_GetRef();
+		Comparison.Name = Result.Name;
+
+		if (BaselineResult->ActivationsPerSecond > 0.0)
+		{
+			Comparison.ThroughputRatio = Result.ActivationsPerSecond / BaselineResult->ActivationsPerSecond;
+		}
+
+		if (BaselineResult->ActivationLatency.P95Microseconds > 0.0)
+		{
+			Comparison.P95LatencyRatio = Result.ActivationLatency.P95Microseconds / BaselineResult->ActivationLatency.P95Microseconds;
+		}
+
+		Comparison.bRegressed = Comparison.ThroughputRatio < 1.0 - RegressionThreshold || Comparison.P95LatencyRatio > 1.0 + RegressionThreshold;
+	}
+}
+
+FString UOpenLogicBenchmarkRunner::GetDefaultOutputPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("OpenLogic"), TEXT("Benchmarks"), FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")) + TEXT(".json"));
+}
+
+void UOpenLogicBenchmarkRunner::OnNodeActivated(UOpenLogicTask* Task)
+{
+	if (!bMeasuring)
+	{
+		return;
+	}
+
+	ActivationCount++;
+	ActivationStartCycles.Add(Task, FPlatformTime::Cycles64());
+}
+
+void UOpenLogicBenchmarkRunner::OnNodeCompleted(UOpenLogicTask* Task)
+{
+	if (!bMeasuring)
+	{
+		return;
+	}
+
+	uint64 StartCycles = 0;
+	if (ActivationStartCycles.RemoveAndCopyValue(Task, StartCycles))
+	{
+		ActivationSamples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+	}
+}
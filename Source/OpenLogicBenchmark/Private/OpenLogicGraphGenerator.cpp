@@ -0,0 +1,182 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicGraphGenerator.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Event/Task_OnGraphStart.h"
+#include "FlowControl/Task_Branch.h"
+#include "FlowControl/Task_ForLoop.h"
+#include "Literal/Task_MakeLiteralBoolean.h"
+
+// Pin indices of the built-in nodes used by the generator
+namespace OpenLogicGraphGenerator
+{
+	constexpr int32 GraphStart_Then = 1;
+
+	constexpr int32 Branch_Execute = 1;
+	constexpr int32 Branch_Condition = 2;
+	constexpr int32 Branch_False = 2;
+
+	constexpr int32 ForLoop_Execute = 1;
+	constexpr int32 ForLoop_FirstIndex = 2;
+	constexpr int32 ForLoop_LastIndex = 3;
+	constexpr int32 ForLoop_LoopBody = 1;
+
+	constexpr int32 Literal_Value = 1;
+	constexpr int32 Literal_ReturnValue = 1;
+}
+
+FOpenLogicGraphData FOpenLogicGraphGenerator::Generate(EOpenLogicBenchmarkShape Shape, int32 Size)
+{
+	Size = FMath::Max(Size, 1);
+
+	switch (Shape)
+	{
+	case EOpenLogicBenchmarkShape::Chain:
+		return MakeChain(Size);
+	case EOpenLogicBenchmarkShape::FanOut:
+		return MakeFanOut(Size);
+	case EOpenLogicBenchmarkShape::DataDepth:
+		return MakeDataDepth(Size);
+	case EOpenLogicBenchmarkShape::ForLoop:
+		return MakeForLoop(Size);
+	case EOpenLogicBenchmarkShape::ManyHandles:
+		// The handle count is driven by Size, the graph itself stays small
+		return MakeChain(4);
+	}
+
+	return FOpenLogicGraphData();
+}
+
+FOpenLogicGraphData FOpenLogicGraphGenerator::MakeChain(int32 Length)
+{
+	using namespace OpenLogicGraphGenerator;
+
+	FOpenLogicGraphData GraphData;
+
+	FGuid PreviousNode = AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	int32 PreviousPin = GraphStart_Then;
+
+	for (int32 Index = 0; Index < Length; Index++)
+	{
+		const FGuid BranchNode = AddNode(GraphData, UTask_Branch::StaticClass());
+		SetDefaultValue<bool>(GraphData, BranchNode, Branch_Condition, false);
+
+		Connect(GraphData, PreviousNode, PreviousPin, BranchNode, Branch_Execute);
+
+		PreviousNode = BranchNode;
+		PreviousPin = Branch_False;
+	}
+
+	return GraphData;
+}
+
+FOpenLogicGraphData FOpenLogicGraphGenerator::MakeFanOut(int32 Width)
+{
+	using namespace OpenLogicGraphGenerator;
+
+	FOpenLogicGraphData GraphData;
+
+	const FGuid LiteralNode = AddNode(GraphData, UTask_MakeLiteralBoolean::StaticClass());
+	SetDefaultValue<bool>(GraphData, LiteralNode, Literal_Value, false);
+
+	FGuid PreviousNode = AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	int32 PreviousPin = GraphStart_Then;
+
+	for (int32 Index = 0; Index < Width; Index++)
+	{
+		const FGuid BranchNode = AddNode(GraphData, UTask_Branch::StaticClass());
+		SetDefaultValue<bool>(GraphData, BranchNode, Branch_Condition, false);
+
+		Connect(GraphData, PreviousNode, PreviousPin, BranchNode, Branch_Execute);
+		Connect(GraphData, LiteralNode, Literal_ReturnValue, BranchNode, Branch_Condition);
+
+		PreviousNode = BranchNode;
+		PreviousPin = Branch_False;
+	}
+
+	return GraphData;
+}
+
+FOpenLogicGraphData FOpenLogicGraphGenerator::MakeDataDepth(int32 Depth)
+{
+	using namespace OpenLogicGraphGenerator;
+
+	FOpenLogicGraphData GraphData;
+
+	const FGuid StartNode = AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	const FGuid BranchNode = AddNode(GraphData, UTask_Branch::StaticClass());
+	SetDefaultValue<bool>(GraphData, BranchNode, Branch_Condition, false);
+
+	Connect(GraphData, StartNode, GraphStart_Then, BranchNode, Branch_Execute);
+
+	FGuid ConsumerNode = BranchNode;
+	int32 ConsumerPin = Branch_Condition;
+
+	for (int32 Index = 0; Index < Depth; Index++)
+	{
+		const FGuid LiteralNode = AddNode(GraphData, UTask_MakeLiteralBoolean::StaticClass());
+		SetDefaultValue<bool>(GraphData, LiteralNode, Literal_Value, false);
+
+		Connect(GraphData, LiteralNode, Literal_ReturnValue, ConsumerNode, ConsumerPin);
+
+		ConsumerNode = LiteralNode;
+		ConsumerPin = Literal_Value;
+	}
+
+	return GraphData;
+}
+
+FOpenLogicGraphData FOpenLogicGraphGenerator::MakeForLoop(int32 LoopCount)
+{
+	using namespace OpenLogicGraphGenerator;
+
+	FOpenLogicGraphData GraphData;
+
+	const FGuid StartNode = AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+
+	const FGuid LoopNode = AddNode(GraphData, UTask_ForLoop::StaticClass());
+	SetDefaultValue<int32>(GraphData, LoopNode, ForLoop_FirstIndex, 0);
+	SetDefaultValue<int32>(GraphData, LoopNode, ForLoop_LastIndex, LoopCount - 1);
+
+	const FGuid BodyNode = AddNode(GraphData, UTask_Branch::StaticClass());
+	SetDefaultValue<bool>(GraphData, BodyNode, Branch_Condition, false);
+
+	Connect(GraphData, StartNode, GraphStart_Then, LoopNode, ForLoop_Execute);
+	Connect(GraphData, LoopNode, ForLoop_LoopBody, BodyNode, Branch_Execute);
+
+	return GraphData;
+}
+
+FGuid FOpenLogicGraphGenerator::AddNode(FOpenLogicGraphData& GraphData, TSubclassOf<UOpenLogicTask> TaskClass)
+{
+	const FGuid NodeID = FGuid::NewGuid();
+
+	FOpenLogicNode& Node = GraphData.Nodes.Add(NodeID);
+	Node.TaskClass = TaskClass.Get();
+	Node.Position = FVector2D(GraphData.Nodes.Num() * 300.0, 0.0);
+
+	const UOpenLogicTask* DefaultObject = TaskClass->GetDefaultObject<UOpenLogicTask>();
+
+	for (int32 PinIndex = 1; PinIndex <= DefaultObject->TaskData.InputPins.Num(); PinIndex++)
+	{
+		Node.InputPins.Add(PinIndex, FOpenLogicPinState());
+	}
+
+	for (int32 PinIndex = 1; PinIndex <= DefaultObject->TaskData.OutputPins.Num(); PinIndex++)
+	{
+		Node.OutputPins.Add(PinIndex, FOpenLogicPinState());
+	}
+
+	if (DefaultObject->TaskData.Type == ENodeType::Event)
+	{
+		GraphData.Events.FindOrAdd(TaskClass).NodeId.Add(NodeID);
+	}
+
+	return NodeID;
+}
+
+void FOpenLogicGraphGenerator::Connect(FOpenLogicGraphData& GraphData, const FGuid& SourceNode, int32 OutputPin, const FGuid& TargetNode, int32 InputPin)
+{
+	GraphData.Nodes[SourceNode].OutputPins.FindOrAdd(OutputPin).Connections.AddUnique(FOpenLogicPinConnection(TargetNode, InputPin));
+	GraphData.Nodes[TargetNode].InputPins.FindOrAdd(InputPin).Connections.AddUnique(FOpenLogicPinConnection(SourceNode, OutputPin));
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicBenchmarkRunner.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Runs each configuration of the default benchmark suite as an automation test.
+ *
+ *   UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests OpenLogic.Benchmark; Quit" -nullrhi -unattended
+ *     [-OpenLogicBenchmarkBaseline=<file>] [-OpenLogicBenchmarkThreshold=0.1]
+ *
+ * A test fails if its graph did not run, or if it regressed against the baseline report when one is given.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FOpenLogicBenchmarkTest, "OpenLogic.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FOpenLogicBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FOpenLogicBenchmarkSettings& Settings : UOpenLogicBenchmarkRunner::GetDefaultSuite())
+	{
+		const FString ShapeName = StaticEnum<EOpenLogicBenchmarkShape>()->GetNameStringByValue(static_cast<int64>(Settings.Shape));
+		OutBeautifiedNames.Add(ShapeName);
+		OutTestCommands.Add(ShapeName);
+	}
+}
+
+bool FOpenLogicBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const TArray<FOpenLogicBenchmarkSettings> DefaultSuite = UOpenLogicBenchmarkRunner::GetDefaultSuite();
+	const FOpenLogicBenchmarkSettings* Settings = DefaultSuite.FindByPredicate([&Parameters](const FOpenLogicBenchmarkSettings& Candidate)
+	{
+		return StaticEnum<EOpenLogicBenchmarkShape>()->GetNameStringByValue(static_cast<int64>(Candidate.Shape)) == Parameters;
+	});
+
+	if (!Settings)
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark shape %s."), *Parameters));
+		return false;
+	}
+
+	FString BaselineFile;
+	FParse::Value(FCommandLine::Get(), TEXT("OpenLogicBenchmarkBaseline="), BaselineFile);
+
+	float RegressionThreshold = 0.1f;
+	FParse::Value(FCommandLine::Get(), TEXT("OpenLogicBenchmarkThreshold="), RegressionThreshold);
+
+	const FOpenLogicBenchmarkReport Report = UOpenLogicBenchmarkRunner::RunSuite({ *Settings }, BaselineFile, RegressionThreshold);
+	if (!TestEqual(TEXT("Result count"), Report.Results.Num(), 1))
+	{
+		return false;
+	}
+
+	const FOpenLogicBenchmarkResult& Result = Report.Results[0];
+	TestTrue(TEXT("The graph ran"), Result.TotalActivations > 0);
+
+	AddInfo(FString::Printf(TEXT("%lld activations in %.3fs (%.0f/s), activation p50 %.2fus p95 %.2fus p99 %.2fus, %lld allocations (%.2f per activation)"),
+		Result.TotalActivations, Result.WallSeconds, Result.ActivationsPerSecond,
+		Result.ActivationLatency.P50Microseconds, Result.ActivationLatency.P95Microseconds, Result.ActivationLatency.P99Microseconds,
+		Result.AllocationCount, Result.AllocationsPerActivation));
+
+	for (const FOpenLogicBenchmarkComparison& Comparison : Report.Comparisons)
+	{
+		if (Comparison.bRegressed)
+		{
+			AddError(FString::Printf(TEXT("%s regressed: throughput x%.3f, p95 latency x%.3f."), *Comparison.Name, Comparison.ThroughputRatio, Comparison.P95LatencyRatio));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,285 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicGraphGenerator.h"
+#include "Classes/OpenLogicGraph.h"
+#include "Runtime/OpenLogicBatchedGraph.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Runtime/OpenLogicRuntimeGraphComponent.h"
+#include "Utility/OpenLogicUtility.h"
+#include "Event/Task_OnGraphStart.h"
+#include "FlowControl/Task_Branch.h"
+#include "FlowControl/Task_Delay.h"
+#include "Math/Task_FloatArithmetic.h"
+#include "Math/Task_FloatComparison.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Tasks/OpenLogicTask.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Pin indices of the built-in nodes used by the tests
+namespace OpenLogicRuntimeTest
+{
+	constexpr int32 GraphStart_Then = 1;
+
+	constexpr int32 Delay_Execute = 1;
+	constexpr int32 Delay_Duration = 2;
+
+	constexpr int32 Branch_Execute = 1;
+	constexpr int32 Branch_Condition = 2;
+
+	// Float operators and comparisons share their pin layout
+	constexpr int32 Operator_A = 1;
+	constexpr int32 Operator_B = 2;
+	constexpr int32 Operator_ReturnValue = 1;
+}
+
+// Waits for the handle to be cancelled by its timeout, then checks it was released and shuts the graph down
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FOpenLogicWaitForHandleTimeout, FAutomationTestBase*, Test, UOpenLogicRuntimeGraph*, RuntimeGraph, TSharedPtr<FOpenLogicGraphExecutionHandle>, ExecutionHandle, double, GiveUpTime);
+
+bool FOpenLogicWaitForHandleTimeout::Update()
+{
+	const EOpenLogicCancellationReason Reason = ExecutionHandle->CancellationToken.GetReason();
+	if (Reason == EOpenLogicCancellationReason::None && FPlatformTime::Seconds() < GiveUpTime)
+	{
+		return false;
+	}
+
+	Test->TestTrue(TEXT("The handle was cancelled by its timeout"), Reason == EOpenLogicCancellationReason::HandleTimedOut);
+	Test->TestFalse(TEXT("The handle was released"), RuntimeGraph->GetExecutionHandle(ExecutionHandle->HandleIndex).IsValid());
+
+	RuntimeGraph->DestroyWorker();
+	RuntimeGraph->RemoveFromRoot();
+
+	return true;
+}
+
+/**
+ * Times out a handle whose graph runs on the background thread.
+ * The timeout is swept on the game thread while the graph thread may still be running the handle.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOpenLogicBackgroundHandleTimeoutTest, "OpenLogic.Runtime.BackgroundHandleTimeout", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FOpenLogicBackgroundHandleTimeoutTest::RunTest(const FString& Parameters)
+{
+	using namespace OpenLogicRuntimeTest;
+
+	// On Graph Start -> Delay, which never completes without a world to run its latent action
+	FOpenLogicGraphData GraphData;
+	const FGuid StartNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	const FGuid DelayNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_Delay::StaticClass());
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, DelayNode, Delay_Duration, 60.0f);
+	FOpenLogicGraphGenerator::Connect(GraphData, StartNode, GraphStart_Then, DelayNode, Delay_Execute);
+
+	UOpenLogicRuntimeGraph* RuntimeGraph = UOpenLogicUtility::CreateRuntimeGraphFromStruct(GetTransientPackage(), nullptr, GraphData);
+	RuntimeGraph->AddToRoot();
+
+	FOpenLogicThreadSettings ThreadSettings;
+	ThreadSettings.NodeExecutionThread = EOpenLogicRuntimeThreadType::BackgroundThread;
+	RuntimeGraph->SetThreadSettings(ThreadSettings);
+
+	FOpenLogicGraphExecutionHandle Handle;
+	if (!TestTrue(TEXT("The event was triggered"), RuntimeGraph->TriggerEvent(UTask_OnGraphStart::StaticClass(), true, Handle)))
+	{
+		RuntimeGraph->DestroyWorker();
+		RuntimeGraph->RemoveFromRoot();
+		return false;
+	}
+
+	const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = RuntimeGraph->GetExecutionHandle(Handle.HandleIndex);
+	if (!TestTrue(TEXT("The handle is registered"), ExecutionHandle.IsValid()))
+	{
+		RuntimeGraph->DestroyWorker();
+		RuntimeGraph->RemoveFromRoot();
+		return false;
+	}
+
+	RuntimeGraph->SetExecutionHandleTimeout(ExecutionHandle, 0.1f);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FOpenLogicWaitForHandleTimeout(this, RuntimeGraph, ExecutionHandle, FPlatformTime::Seconds() + 5.0));
+
+	return true;
+}
+
+/**
+ * Replicates the state of a pure node, which is activated before it computes its output and never completes.
+ * The replicated value must be the one it computed, not the one its output held when it was activated.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOpenLogicReplicatedPureNodeTest, "OpenLogic.Runtime.ReplicatedPureNode", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FOpenLogicReplicatedPureNodeTest::RunTest(const FString& Parameters)
+{
+	using namespace OpenLogicRuntimeTest;
+
+	// On Graph Start -> Branch, whose Condition is (2 + 3) > 0
+	FOpenLogicGraphData GraphData;
+	const FGuid StartNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	const FGuid BranchNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_Branch::StaticClass());
+	const FGuid GreaterNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_GreaterFloat::StaticClass());
+	const FGuid SumNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_AddFloat::StaticClass());
+
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, SumNode, Operator_A, 2.0f);
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, SumNode, Operator_B, 3.0f);
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, GreaterNode, Operator_B, 0.0f);
+
+	FOpenLogicGraphGenerator::Connect(GraphData, StartNode, GraphStart_Then, BranchNode, Branch_Execute);
+	FOpenLogicGraphGenerator::Connect(GraphData, GreaterNode, Operator_ReturnValue, BranchNode, Branch_Condition);
+	FOpenLogicGraphGenerator::Connect(GraphData, SumNode, Operator_ReturnValue, GreaterNode, Operator_A);
+
+	UOpenLogicGraph* GraphAsset = NewObject<UOpenLogicGraph>(GetTransientPackage());
+	GraphAsset->GraphData = GraphData;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// Always relevant, there is no player to measure the replication distance from
+	AActor* Actor = World->SpawnActor<AActor>();
+	Actor->bAlwaysRelevant = true;
+
+	UOpenLogicRuntimeGraphComponent* Component = NewObject<UOpenLogicRuntimeGraphComponent>(Actor);
+	Component->GraphAsset = GraphAsset;
+	Component->BeginPlayEvent = UTask_OnGraphStart::StaticClass();
+	Component->bReplicateExecutionState = true;
+	Component->RegisterComponent();
+
+	// The captured states are moved into the replicated state by a timer
+	World->Tick(LEVELTICK_All, Component->ReplicationInterval * 2.0f);
+
+	FOpenLogicReplicatedNodeState NodeState;
+	if (TestTrue(TEXT("The pure node state was replicated"), Component->GetReplicatedNodeState(SumNode, NodeState)))
+	{
+		const FOpenLogicReplicatedPinValue* PinValue = NodeState.PinValues.FindByPredicate([](const FOpenLogicReplicatedPinValue& Candidate)
+		{
+			return Candidate.PinIndex == Operator_ReturnValue;
+		});
+
+		if (TestNotNull(TEXT("The output pin was replicated"), PinValue))
+		{
+			TestEqual(TEXT("The replicated value is the one the node computed"), PinValue->Number, 5.0);
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+/**
+ * Runs the same graph once per instance on runtime graphs and once for every instance on a batched graph, and
+ * compares the values computed by its nodes. Seven instances cover a group of four and the remainder of the batched
+ * math nodes.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOpenLogicBatchedGraphTest, "OpenLogic.Runtime.BatchedGraph", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FOpenLogicBatchedGraphTest::RunTest(const FString& Parameters)
+{
+	using namespace OpenLogicRuntimeTest;
+
+	constexpr int32 InstanceCount = 7;
+	constexpr float Threshold = 4.0f;
+
+	// On Graph Start -> Branch, whose Condition is (Instance + 1.5) > Threshold
+	FOpenLogicGraphData GraphData;
+	const FGuid StartNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_OnGraphStart::StaticClass());
+	const FGuid BranchNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_Branch::StaticClass());
+	const FGuid GreaterNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_GreaterFloat::StaticClass());
+	const FGuid SumNode = FOpenLogicGraphGenerator::AddNode(GraphData, UTask_AddFloat::StaticClass());
+
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, SumNode, Operator_B, 1.5f);
+	FOpenLogicGraphGenerator::SetDefaultValue<float>(GraphData, GreaterNode, Operator_B, Threshold);
+
+	FOpenLogicGraphGenerator::Connect(GraphData, StartNode, GraphStart_Then, BranchNode, Branch_Execute);
+	FOpenLogicGraphGenerator::Connect(GraphData, GreaterNode, Operator_ReturnValue, BranchNode, Branch_Condition);
+	FOpenLogicGraphGenerator::Connect(GraphData, SumNode, Operator_ReturnValue, GreaterNode, Operator_A);
+
+	// Per instance, the value of A is the default value of the pin
+	TArray<float> ExpectedSums;
+	TArray<bool> ExpectedComparisons;
+	ExpectedSums.Init(0.0f, InstanceCount);
+	ExpectedComparisons.Init(false, InstanceCount);
+
+	for (int32 Instance = 0; Instance < InstanceCount; Instance++)
+	{
+		FOpenLogicGraphData InstanceGraphData = GraphData;
+		FOpenLogicGraphGenerator::SetDefaultValue<float>(InstanceGraphData, SumNode, Operator_A, static_cast<float>(Instance));
+
+		UOpenLogicRuntimeGraph* RuntimeGraph = UOpenLogicUtility::CreateRuntimeGraphFromStruct(GetTransientPackage(), nullptr, InstanceGraphData);
+
+		// Pure nodes are read once they ran, they never complete
+		RuntimeGraph->OnNodeActivationEndNative.AddLambda([&](UOpenLogicTask* Task)
+		{
+			const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = Task->GetBoundRuntimeNode();
+			const TSharedPtr<void> ReturnValue = RuntimeNode.IsValid() ? RuntimeNode->OutputProperties.FindRef(Operator_ReturnValue) : nullptr;
+			if (!ReturnValue.IsValid())
+			{
+				return;
+			}
+
+			if (RuntimeNode->NodeID == SumNode)
+			{
+				ExpectedSums[Instance] = *static_cast<const float*>(ReturnValue.Get());
+			}
+			else if (RuntimeNode->NodeID == GreaterNode)
+			{
+				ExpectedComparisons[Instance] = *static_cast<const bool*>(ReturnValue.Get());
+			}
+		});
+
+		FOpenLogicGraphExecutionHandle Handle;
+		RuntimeGraph->TriggerEvent(UTask_OnGraphStart::StaticClass(), true, Handle);
+		RuntimeGraph->DestroyWorker();
+	}
+
+	UOpenLogicBatchedGraph* BatchedGraph = NewObject<UOpenLogicBatchedGraph>(GetTransientPackage());
+	if (!TestTrue(TEXT("The graph compiles for batched execution"), BatchedGraph->SetGraphData(GraphData)))
+	{
+		return false;
+	}
+
+	for (int32 Instance = 0; Instance < InstanceCount; Instance++)
+	{
+		BatchedGraph->AddInstance(nullptr);
+	}
+
+	FOpenLogicBatchColumn* AColumn = BatchedGraph->FindPinColumn(SumNode, Operator_A, true);
+	float* AValues = AColumn ? AColumn->GetData<float>() : nullptr;
+	if (!TestNotNull(TEXT("The A pin has a float column"), AValues))
+	{
+		return false;
+	}
+
+	for (int32 Instance = 0; Instance < InstanceCount; Instance++)
+	{
+		AValues[Instance] = static_cast<float>(Instance);
+	}
+
+	TestTrue(TEXT("The event was triggered"), BatchedGraph->TriggerEvent(UTask_OnGraphStart::StaticClass()));
+
+	FOpenLogicBatchColumn* SumColumn = BatchedGraph->FindPinColumn(SumNode, Operator_ReturnValue, false);
+	FOpenLogicBatchColumn* ComparisonColumn = BatchedGraph->FindPinColumn(GreaterNode, Operator_ReturnValue, false);
+	const float* Sums = SumColumn ? SumColumn->GetData<float>() : nullptr;
+	const bool* Comparisons = ComparisonColumn ? ComparisonColumn->GetData<bool>() : nullptr;
+
+	if (!TestNotNull(TEXT("The sum has a float column"), Sums) || !TestNotNull(TEXT("The comparison has a bool column"), Comparisons))
+	{
+		return false;
+	}
+
+	for (int32 Instance = 0; Instance < InstanceCount; Instance++)
+	{
+		TestEqual(FString::Printf(TEXT("Sum of instance %d"), Instance), Sums[Instance], ExpectedSums[Instance]);
+		TestEqual(FString::Printf(TEXT("Comparison of instance %d"), Instance), Comparisons[Instance], ExpectedComparisons[Instance]);
+		TestEqual(FString::Printf(TEXT("Expected sum of instance %d"), Instance), ExpectedSums[Instance], Instance + 1.5f);
+	}
+
+	return true;
+}
+
+#endif
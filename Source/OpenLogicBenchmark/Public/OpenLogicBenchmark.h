@@ -0,0 +1,16 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FOpenLogicBenchmarkModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
+
+DECLARE_LOG_CATEGORY_EXTERN(OpenLogicBenchmarkLog, Log, All);
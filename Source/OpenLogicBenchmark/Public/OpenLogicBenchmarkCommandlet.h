@@ -0,0 +1,24 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OpenLogicBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless entry point for the OpenLogic benchmarks.
+ * UnrealEditor-Cmd <Project> -run=OpenLogicBenchmark -nullrhi -unattended [-Baseline=<file>] [-Threshold=0.1]
+ * Returns a non-zero exit code when a result regressed against the baseline. The same benchmarks also run as the
+ * OpenLogic.Benchmark automation tests.
+ */
+UCLASS()
+class UOpenLogicBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOpenLogicBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,61 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "OpenLogicBenchmarkTypes.h"
+#include "OpenLogicBenchmarkRunner.generated.h"
+
+// Forward declarations
+class UOpenLogicTask;
+
+/**
+ * Runs synthetic graphs through UOpenLogicRuntimeGraph and collects throughput, latency and memory figures.
+ *
+ * Usage (headless):
+ *   UnrealEditor-Cmd <Project> -run=OpenLogicBenchmark -nullrhi -unattended [-Shape=Chain -Size=128 -Iterations=100] [-Baseline=<file>] [-Output=<file>] [-Threshold=0.1]
+ * or from a running instance:
+ *   OpenLogic.Benchmark Shape=Chain Size=128 Iterations=100 Baseline=<file>
+ * or as the OpenLogic.Benchmark automation tests, one per configuration of the default suite.
+ */
+UCLASS()
+class OPENLOGICBENCHMARK_API UOpenLogicBenchmarkRunner : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// Runs a single benchmark configuration.
+	FOpenLogicBenchmarkResult Run(const FOpenLogicBenchmarkSettings& Settings);
+
+	// Runs several configurations and compares them against the baseline report if one is given.
+	static FOpenLogicBenchmarkReport RunSuite(const TArray<FOpenLogicBenchmarkSettings>& Suite, const FString& BaselineFile = FString(), float RegressionThreshold = 0.1f);
+
+	// Parses the command line/console arguments, runs the benchmarks and writes the report. Returns a process exit code.
+	static int32 RunFromCommandLine(const TCHAR* Params);
+
+	// The configurations run when no shape is specified.
+	static TArray<FOpenLogicBenchmarkSettings> GetDefaultSuite();
+
+	static bool SaveReport(const FOpenLogicBenchmarkReport& Report, const FString& FilePath);
+	static bool LoadReport(const FString& FilePath, FOpenLogicBenchmarkReport& OutReport);
+	static void CompareWithBaseline(FOpenLogicBenchmarkReport& Report, const FOpenLogicBenchmarkReport& Baseline, float RegressionThreshold);
+
+	// Saved/OpenLogic/Benchmarks/<timestamp>.json
+	static FString GetDefaultOutputPath();
+
+private:
+	UFUNCTION()
+	void OnNodeActivated(UOpenLogicTask* Task);
+
+	UFUNCTION()
+	void OnNodeCompleted(UOpenLogicTask* Task);
+
+private:
+	// Activation start cycle per running task
+	TMap<const UOpenLogicTask*, uint64> ActivationStartCycles;
+
+	TArray<double> ActivationSamples;
+	int64 ActivationCount = 0;
+	bool bMeasuring = false;
+};
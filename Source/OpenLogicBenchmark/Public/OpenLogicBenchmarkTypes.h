@@ -0,0 +1,174 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OpenLogicBenchmarkTypes.generated.h"
+
+// The shape of a synthetic graph generated for benchmarking.
+UENUM(BlueprintType)
+enum class EOpenLogicBenchmarkShape : uint8
+{
+	// A single long execution chain of Branch nodes.
+	Chain,
+
+	// An execution chain where every node reads the same data producer.
+	FanOut,
+
+	// A single consumer at the end of a deep chain of data dependencies.
+	DataDepth,
+
+	// A For Loop running its body once per index.
+	ForLoop,
+
+	// A short chain triggered from many execution handles at once.
+	ManyHandles
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICBENCHMARK_API FOpenLogicBenchmarkSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+		EOpenLogicBenchmarkShape Shape = EOpenLogicBenchmarkShape::Chain;
+
+	// The number of generated nodes (or loop iterations / handles, depending on the shape).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark", meta = (ClampMin = "1"))
+		int32 Size = 128;
+
+	// The number of measured iterations.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark", meta = (ClampMin = "1"))
+		int32 Iterations = 100;
+
+	// Iterations executed before measuring, to fill task pools.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark", meta = (ClampMin = "0"))
+		int32 WarmupIterations = 5;
+
+	// Mutes OpenLogicLog while measuring so unconnected output pins don't end up dominating the timings.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+		bool bSuppressRuntimeLog = true;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICBENCHMARK_API FOpenLogicLatencySummary
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int32 SampleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double MeanMicroseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double P50Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double P95Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double P99Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double MaxMicroseconds = 0.0;
+
+	// Builds a summary from raw samples (sorted in place).
+	static FOpenLogicLatencySummary FromSamples(TArray<double>& Samples);
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICBENCHMARK_API FOpenLogicBenchmarkResult
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FOpenLogicBenchmarkSettings Settings;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int32 NodeCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int64 TotalActivations = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double WallSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double ActivationsPerSecond = 0.0;
+
+	// Time from triggering an event to the handle returning to the caller.
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FOpenLogicLatencySummary HandleLatency;
+
+	// Time from a node's activation to its completion, including the nodes it executed synchronously.
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FOpenLogicLatencySummary ActivationLatency;
+
+	// UObjects created while measuring (task instances that missed the pool, etc.)
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int32 ObjectCountDelta = 0;
+
+	// Heap allocations (malloc and realloc calls) made by the process while measuring, as counted by the allocator.
+	// Always 0 when the engine is built without stats.
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int64 AllocationCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double AllocationsPerActivation = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int64 UsedMemoryDeltaBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		int64 PeakMemoryDeltaBytes = 0;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICBENCHMARK_API FOpenLogicBenchmarkComparison
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString Name;
+
+	// Current / baseline throughput. Below 1 means slower.
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double ThroughputRatio = 1.0;
+
+	// Current / baseline p95 activation latency. Above 1 means slower.
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		double P95LatencyRatio = 1.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		bool bRegressed = false;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICBENCHMARK_API FOpenLogicBenchmarkReport
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString EngineVersion;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString PluginVersion;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString Timestamp;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		TArray<FOpenLogicBenchmarkResult> Results;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		FString BaselineFile;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+		TArray<FOpenLogicBenchmarkComparison> Comparisons;
+
+	bool HasRegressions() const;
+};
@@ -0,0 +1,46 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include "OpenLogicBenchmarkTypes.h"
+
+/**
+ * Procedurally builds FOpenLogicGraphData out of the built-in nodes, without going through the graph editor.
+ * Every generated graph has a single On Graph Start event as its entry point.
+ */
+class OPENLOGICBENCHMARK_API FOpenLogicGraphGenerator
+{
+public:
+	static FOpenLogicGraphData Generate(EOpenLogicBenchmarkShape Shape, int32 Size);
+
+	// On Graph Start -> Branch x Length, each one continuing through its False pin.
+	static FOpenLogicGraphData MakeChain(int32 Length);
+
+	// Same as MakeChain, but every Branch reads its Condition from one shared literal node.
+	static FOpenLogicGraphData MakeFanOut(int32 Width);
+
+	// On Graph Start -> Branch whose Condition is the end of Depth chained literal nodes.
+	static FOpenLogicGraphData MakeDataDepth(int32 Depth);
+
+	// On Graph Start -> For Loop running LoopCount times, with a Branch as loop body.
+	static FOpenLogicGraphData MakeForLoop(int32 LoopCount);
+
+	// Building blocks for graphs that are not one of the shapes above, such as the ones of the automation tests
+
+	// Adds a node with a pin state for every pin declared by the task class
+	static FGuid AddNode(FOpenLogicGraphData& GraphData, TSubclassOf<UOpenLogicTask> TaskClass);
+
+	// Connects an output pin to an input pin. Pin indices are 1-based, like in the editor.
+	static void Connect(FOpenLogicGraphData& GraphData, const FGuid& SourceNode, int32 OutputPin, const FGuid& TargetNode, int32 InputPin);
+
+	template<typename T>
+	static void SetDefaultValue(FOpenLogicGraphData& GraphData, const FGuid& NodeID, int32 InputPin, const T& Value)
+	{
+		if (FOpenLogicPinState* PinState = GraphData.Nodes[NodeID].InputPins.Find(InputPin))
+		{
+			PinState->DefaultValue.SetValue<T>(Value);
+		}
+	}
+};
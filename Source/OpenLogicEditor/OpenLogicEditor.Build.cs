@@ -47,7 +47,8 @@ public class OpenLogicEditor : ModuleRules
                 "Blutility",
 				"UMG",
                 "UMGEditor",
-                "DetailCustomizations" 
+                "DetailCustomizations",
+				"MessageLog"
 			}
 			);
 		
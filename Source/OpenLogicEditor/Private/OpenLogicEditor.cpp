@@ -12,6 +12,8 @@
 #include "PinList/OpenLogicPinList.h"
 #include "Styling/SlateStyleRegistry.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "MessageLogModule.h"
+#include "Editor.h"
 
 #define LOCTEXT_NAMESPACE "FOpenLogicV2Module"
 
@@ -70,9 +72,22 @@ void FOpenLogicEditorModule::StartupModule()
 	// Register the pin list factory
 	FEdGraphUtilities::RegisterVisualPinFactory(MakeShareable(new FOpenLogicPinListFactory()));
 
+	// Bake the pin handles of task blueprints so they are resolved by index at runtime
+	if (GEditor)
+	{
+		BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddStatic(&OpenLogicPinList::BakePinHandles);
+	}
+
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	PropertyModule.RegisterCustomPropertyTypeLayout(FOpenLogicPinData::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FPinDataCustomization::MakeInstance));
 	PropertyModule.NotifyCustomizationModuleChanged();
+
+	// Register the message log used by the graph analyzer
+	FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
+	FMessageLogInitializationOptions MessageLogOptions;
+	MessageLogOptions.bShowFilters = true;
+	MessageLogOptions.bShowPages = true;
+	MessageLogModule.RegisterLogListing("OpenLogic", LOCTEXT("OpenLogicMessageLog", "Open Logic"), MessageLogOptions);
 }
 
 void FOpenLogicEditorModule::ShutdownModule()
@@ -106,8 +121,18 @@ void FOpenLogicEditorModule::ShutdownModule()
 
 	FCoreUObjectDelegates::OnObjectPostCDOCompiled.RemoveAll(this);
 
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+	}
+
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	PropertyModule.UnregisterCustomPropertyTypeLayout(FOpenLogicPinData::StaticStruct()->GetFName());
+
+	if (FMessageLogModule* MessageLogModule = FModuleManager::GetModulePtr<FMessageLogModule>("MessageLog"))
+	{
+		MessageLogModule->UnregisterLogListing("OpenLogic");
+	}
 }
 
 // Called when the asset registry has loaded all the files.
@@ -9,17 +9,104 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Tasks/OpenLogicTask.h"
 
-TSharedPtr<SGraphPin> FOpenLogicPinListFactory::CreatePin(UEdGraphPin* Pin) const
+bool OpenLogicPinList::IsPinHandle(const UEdGraphPin* Pin)
+{
+	if (!Pin || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Struct)
+	{
+		return false;
+	}
+
+	const UStruct* SubCategoryStruct = Cast<UStruct>(Pin->PinType.PinSubCategoryObject);
+	return SubCategoryStruct && SubCategoryStruct->IsChildOf(FOpenLogicPinHandle::StaticStruct());
+}
+
+EOpenLogicPinDirection OpenLogicPinList::GetPinDirection(const UFunction* Function)
 {
-	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+	return Function && Function->GetMetaData("PinDirection") == "Output" ? EOpenLogicPinDirection::Output : EOpenLogicPinDirection::Input;
+}
 
-	if (Pin->PinType.PinCategory != K2Schema->PC_Struct)
+bool OpenLogicPinList::ParsePinHandle(const FString& Value, FOpenLogicPinHandle& OutHandle)
+{
+	if (Value.IsEmpty())
 	{
-		return nullptr;
+		return false;
+	}
+
+	return FOpenLogicPinHandle::StaticStruct()->ImportText(*Value, &OutHandle, nullptr, PPF_None, GWarn, FOpenLogicPinHandle::StaticStruct()->GetName()) != nullptr;
+}
+
+FString OpenLogicPinList::MakePinHandleValue(const UOpenLogicTask* Task, FName PinName, EOpenLogicPinDirection Direction)
+{
+	FOpenLogicPinHandle Handle(PinName);
+
+	if (Task && !PinName.IsNone())
+	{
+		const TArray<FOpenLogicPinData>& Pins = Direction == EOpenLogicPinDirection::Input ? Task->TaskData.InputPins : Task->TaskData.OutputPins;
+		const int32 PinIndex = Pins.IndexOfByPredicate([PinName](const FOpenLogicPinData& PinData) { return PinData.PinName == PinName; });
+
+		// Runtime pin indices start at 1
+		if (PinIndex != INDEX_NONE)
+		{
+			Handle.PinIndex = PinIndex + 1;
+			Handle.SchemaHash = Task->TaskData.GetPinSchemaHash();
+		}
 	}
 
-	UStruct* SubCategoryStruct = Cast<UStruct>(Pin->PinType.PinSubCategoryObject);
-	if (!SubCategoryStruct || !SubCategoryStruct->IsChildOf(FOpenLogicPinHandle::StaticStruct()))
+	FString Value;
+	FOpenLogicPinHandle::StaticStruct()->ExportText(Value, &Handle, nullptr, nullptr, PPF_None, nullptr);
+	return Value;
+}
+
+void OpenLogicPinList::BakePinHandles(UBlueprint* Blueprint)
+{
+	if (!Blueprint || !Blueprint->GeneratedClass || !Blueprint->GeneratedClass->IsChildOf(UOpenLogicTask::StaticClass()))
+	{
+		return;
+	}
+
+	const UOpenLogicTask* Task = Blueprint->GeneratedClass->GetDefaultObject<UOpenLogicTask>();
+
+	TArray<UK2Node_CallFunction*> CallFunctionNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, CallFunctionNodes);
+
+	bool bChanged = false;
+
+	for (UK2Node_CallFunction* CallFunctionNode : CallFunctionNodes)
+	{
+		const EOpenLogicPinDirection Direction = GetPinDirection(CallFunctionNode->GetTargetFunction());
+
+		for (UEdGraphPin* Pin : CallFunctionNode->Pins)
+		{
+			// Connected handles are only known at runtime and keep being resolved by name
+			if (!IsPinHandle(Pin) || Pin->Direction != EGPD_Input || Pin->LinkedTo.Num() > 0)
+			{
+				continue;
+			}
+
+			FOpenLogicPinHandle Handle;
+			if (!ParsePinHandle(Pin->GetDefaultAsString(), Handle) || Handle.PinName.IsNone())
+			{
+				continue;
+			}
+
+			const FString BakedValue = MakePinHandleValue(Task, Handle.PinName, Direction);
+			if (BakedValue != Pin->DefaultValue)
+			{
+				Pin->DefaultValue = BakedValue;
+				bChanged = true;
+			}
+		}
+	}
+
+	if (bChanged && !Blueprint->bIsRegeneratingOnLoad)
+	{
+		Blueprint->MarkPackageDirty();
+	}
+}
+
+TSharedPtr<SGraphPin> FOpenLogicPinListFactory::CreatePin(UEdGraphPin* Pin) const
+{
+	if (!OpenLogicPinList::IsPinHandle(Pin))
 	{
 		return nullptr;
 	}
@@ -57,12 +144,7 @@ void SOpenLogicPinList::RefreshOptions(UEdGraphPin* InPin)
 		return;
 	}
 	
-	EOpenLogicPinDirection Direction = EOpenLogicPinDirection::Input;
-
-	if (Function->GetMetaData("PinDirection") == "Output")
-	{
-		Direction = EOpenLogicPinDirection::Output;
-	}
+	Direction = OpenLogicPinList::GetPinDirection(Function);
 
 	EPinRole Role = EPinRole::FlowControl;
 
@@ -117,21 +199,18 @@ void SOpenLogicPinList::GetValueAsPinName(FName& OutPinName) const
 		return;
 	}
 
-	FString Value = GraphPinObj->GetDefaultAsString();
-	if (Value.IsEmpty() || !Value.StartsWith(TEXT("(PinName=\"")) || !Value.EndsWith(TEXT("\")")))
+	FOpenLogicPinHandle Handle;
+	if (!OpenLogicPinList::ParsePinHandle(GraphPinObj->GetDefaultAsString(), Handle))
 	{
 		return;
 	}
 
-	Value.RemoveFromStart(TEXT("(PinName=\""));
-	Value.RemoveFromEnd(TEXT("\")"));
-
-	OutPinName = FName(*Value);
+	OutPinName = Handle.PinName;
 }
 
 bool SOpenLogicPinList::IsGraphPinValid() const
 {
-	return GraphPinObj && GraphPinObj->PinType.PinCategory == UEdGraphSchema_K2::PC_Struct && Cast<UStruct>(GraphPinObj->PinType.PinSubCategoryObject)->IsChildOf(FOpenLogicPinHandle::StaticStruct());
+	return OpenLogicPinList::IsPinHandle(GraphPinObj);
 }
 
 void SOpenLogicPinList::OnPinComboBoxSelectionChanged(TSharedPtr<FName> ItemSelected, ESelectInfo::Type SelectInfo)
@@ -144,8 +223,9 @@ void SOpenLogicPinList::OnPinComboBoxSelectionChanged(TSharedPtr<FName> ItemSele
 	const FName SelectedPinName = ItemSelected.IsValid() ? *ItemSelected : NAME_None;
 	const UEdGraphSchema* Schema = GraphPinObj->GetSchema();
 
-	// Format the value into a struct string
-	const FString ValueToStore = TEXT("(PinName=\"") + SelectedPinName.ToString() + TEXT("\")");
+	// Format the value into a struct string, with the pin index baked in
+	const UOpenLogicTask* Task = Blueprint && Blueprint->GeneratedClass ? Cast<UOpenLogicTask>(Blueprint->GeneratedClass->GetDefaultObject(false)) : nullptr;
+	const FString ValueToStore = OpenLogicPinList::MakePinHandleValue(Task, SelectedPinName, Direction);
 
 	// Transaction for undo/redo
 	const FScopedTransaction Transaction(NSLOCTEXT("UnrealEd", "GraphEd_SetPinValue", "Set Pin Value"));
@@ -31,6 +31,9 @@ private:
 	// Called when a widget class has been reloaded.
 	void OnReloadComplete(UObject* Object, const FObjectPostCDOCompiledContext& Context);
 
+	// Bakes the pin handles of task blueprints before they are compiled.
+	FDelegateHandle BlueprintPreCompileHandle;
+
 private:
 	TArray<TSharedPtr<FAssetTypeActions_Base>> OpenLogic_AssetActions = {
 		TSharedPtr<FAssetTypeActions_Base>(new FAssetType_OpenLogicTask),
@@ -5,6 +5,27 @@
 #include "CoreMinimal.h"
 #include "EdGraphUtilities.h"
 #include "SGraphPin.h"
+#include "Core/OpenLogicTypes.h"
+
+class UOpenLogicTask;
+
+namespace OpenLogicPinList
+{
+	// Returns whether a graph pin is a FOpenLogicPinHandle.
+	bool IsPinHandle(const UEdGraphPin* Pin);
+
+	// Returns the direction of the task pins a function takes handles to, from its PinDirection metadata.
+	EOpenLogicPinDirection GetPinDirection(const UFunction* Function);
+
+	// Parses the default value of a pin handle graph pin.
+	bool ParsePinHandle(const FString& Value, FOpenLogicPinHandle& OutHandle);
+
+	// Formats the default value of a pin handle graph pin, with the index and schema hash of the pin baked in.
+	FString MakePinHandleValue(const UOpenLogicTask* Task, FName PinName, EOpenLogicPinDirection Direction);
+
+	// Bakes the pin handle literals of a task blueprint against its current pins. Called before it is compiled.
+	void BakePinHandles(UBlueprint* Blueprint);
+}
 
 class OPENLOGICEDITOR_API SOpenLogicPinList : public SGraphPin
 {
@@ -28,6 +49,7 @@ protected:
 	bool IsGraphPinValid() const;
 	void OnPinComboBoxSelectionChanged(TSharedPtr<FName> ItemSelected, ESelectInfo::Type SelectInfo);
 	UBlueprint* Blueprint = nullptr;
+	EOpenLogicPinDirection Direction = EOpenLogicPinDirection::Input;
 	TSharedPtr<class SNameComboBox> PinComboBox;
 	TArray<TSharedPtr<FName>> Options;
 	TMap<FName, FName> OldNameToNewNameMap;
@@ -0,0 +1,31 @@
+// Copyright 2025 - NegativeNameSeller
+
+using UnrealBuildTool;
+
+public class OpenLogicInsights : ModuleRules
+{
+	public OpenLogicInsights(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"TraceAnalysis",
+				"TraceServices"
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"ApplicationCore",
+				"Slate",
+				"SlateCore",
+				"TraceInsights"
+			}
+			);
+	}
+}
@@ -0,0 +1,136 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Analysis/OpenLogicTraceAnalyzer.h"
+#include "Analysis/OpenLogicTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+FOpenLogicTraceAnalyzer::FOpenLogicTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FOpenLogicTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FOpenLogicTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_GraphSpec, "OpenLogic", "GraphSpec");
+	Builder.RouteEvent(RouteId_TaskClassSpec, "OpenLogic", "TaskClassSpec");
+	Builder.RouteEvent(RouteId_HandleCreated, "OpenLogic", "HandleCreated");
+	Builder.RouteEvent(RouteId_HandleDestroyed, "OpenLogic", "HandleDestroyed");
+	Builder.RouteEvent(RouteId_NodeActivated, "OpenLogic", "NodeActivated");
+	Builder.RouteEvent(RouteId_NodeActivationEnd, "OpenLogic", "NodeActivationEnd");
+	Builder.RouteEvent(RouteId_NodeCompleted, "OpenLogic", "NodeCompleted");
+	Builder.RouteEvent(RouteId_PinWrite, "OpenLogic", "PinWrite");
+	Builder.RouteEvent(RouteId_PoolAccess, "OpenLogic", "PoolAccess");
+	Builder.RouteEvent(RouteId_QueueEnqueue, "OpenLogic", "QueueEnqueue");
+	Builder.RouteEvent(RouteId_QueueDequeue, "OpenLogic", "QueueDequeue");
+}
+
+bool FOpenLogicTraceAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope EditScope(Session);
+
+	const FEventData& EventData = Context.EventData;
+
+	switch (RouteId)
+	{
+	case RouteId_GraphSpec:
+		{
+			FString Name;
+			EventData.GetString("Name", Name);
+			Provider.AddGraph(EventData.GetValue<uint64>("GraphId"), Name);
+			break;
+		}
+	case RouteId_TaskClassSpec:
+		{
+			FString Name;
+			EventData.GetString("Name", Name);
+			Provider.AddTaskClass(EventData.GetValue<uint64>("ClassId"), Name);
+			break;
+		}
+	case RouteId_HandleCreated:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddHandleCreated(Time, EventData.GetValue<uint64>("GraphId"), EventData.GetValue<int32>("HandleIndex"));
+			break;
+		}
+	case RouteId_HandleDestroyed:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddHandleDestroyed(Time, EventData.GetValue<uint64>("GraphId"), EventData.GetValue<int32>("HandleIndex"));
+			break;
+		}
+	case RouteId_NodeActivated:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.BeginNode(Time,
+				EventData.GetValue<uint64>("GraphId"),
+				EventData.GetValue<int32>("HandleIndex"),
+				EventData.GetValue<uint32>("ThreadId"),
+				ReadNodeGuid(EventData),
+				EventData.GetValue<uint64>("ClassId"));
+			break;
+		}
+	case RouteId_NodeActivationEnd:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.EndNode(Time,
+				EventData.GetValue<uint64>("GraphId"),
+				EventData.GetValue<int32>("HandleIndex"),
+				EventData.GetValue<uint32>("ThreadId"),
+				ReadNodeGuid(EventData),
+				EventData.GetValue<bool>("bPending"));
+			break;
+		}
+	case RouteId_NodeCompleted:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.CompleteNode(Time, EventData.GetValue<uint64>("GraphId"), EventData.GetValue<int32>("HandleIndex"), ReadNodeGuid(EventData));
+			break;
+		}
+	case RouteId_PinWrite:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddPinWrite(Time,
+				EventData.GetValue<uint64>("GraphId"),
+				EventData.GetValue<int32>("HandleIndex"),
+				ReadNodeGuid(EventData),
+				EventData.GetValue<int32>("PinIndex"));
+			break;
+		}
+	case RouteId_PoolAccess:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddPoolAccess(Time, EventData.GetValue<uint64>("ClassId"), EventData.GetValue<bool>("bHit"));
+			break;
+		}
+	case RouteId_QueueEnqueue:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddQueueEnqueue(Time, EventData.GetValue<uint64>("GraphId"), EventData.GetValue<int32>("HandleIndex"));
+			break;
+		}
+	case RouteId_QueueDequeue:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Provider.AddQueueDequeue(Time, EventData.GetValue<uint64>("GraphId"), EventData.GetValue<int32>("HandleIndex"));
+			break;
+		}
+	default:
+		break;
+	}
+
+	return true;
+}
+
+FGuid FOpenLogicTraceAnalyzer::ReadNodeGuid(const FEventData& EventData)
+{
+	const TArrayView<const uint32> GuidData = EventData.GetArrayView<uint32>("NodeGuid");
+	if (GuidData.Num() != 4)
+	{
+		return FGuid();
+	}
+
+	return FGuid(GuidData[0], GuidData[1], GuidData[2], GuidData[3]);
+}
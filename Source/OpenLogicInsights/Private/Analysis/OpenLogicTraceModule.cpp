@@ -0,0 +1,26 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Analysis/OpenLogicTraceModule.h"
+#include "Analysis/OpenLogicTraceAnalyzer.h"
+#include "Analysis/OpenLogicTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+FName FOpenLogicTraceModule::ModuleName("OpenLogicTrace");
+
+void FOpenLogicTraceModule::GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo)
+{
+	OutModuleInfo.Name = ModuleName;
+	OutModuleInfo.DisplayName = TEXT("OpenLogic");
+}
+
+void FOpenLogicTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& InSession)
+{
+	TSharedPtr<FOpenLogicTraceProvider> Provider = MakeShared<FOpenLogicTraceProvider>(InSession);
+	InSession.AddProvider(FOpenLogicTraceProvider::ProviderName, Provider);
+	InSession.AddAnalyzer(new FOpenLogicTraceAnalyzer(InSession, *Provider));
+}
+
+void FOpenLogicTraceModule::GetLoggers(TArray<const TCHAR*>& OutLoggers)
+{
+	OutLoggers.Add(TEXT("OpenLogic"));
+}
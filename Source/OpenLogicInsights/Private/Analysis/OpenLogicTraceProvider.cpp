@@ -0,0 +1,282 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Analysis/OpenLogicTraceProvider.h"
+
+FName FOpenLogicTraceProvider::ProviderName("OpenLogicTraceProvider");
+
+FOpenLogicTraceProvider::FOpenLogicTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+void FOpenLogicTraceProvider::AddGraph(uint64 GraphId, const FString& Name)
+{
+	Session.WriteAccessCheck();
+
+	GraphNames.Add(GraphId, Session.StoreString(*Name));
+}
+
+void FOpenLogicTraceProvider::AddTaskClass(uint64 ClassId, const FString& Name)
+{
+	Session.WriteAccessCheck();
+
+	TaskClassNames.Add(ClassId, Session.StoreString(*Name));
+}
+
+void FOpenLogicTraceProvider::AddHandleCreated(double Time, uint64 GraphId, int32 HandleIndex)
+{
+	Session.WriteAccessCheck();
+
+	HandleCount++;
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::AddHandleDestroyed(double Time, uint64 GraphId, int32 HandleIndex)
+{
+	Session.WriteAccessCheck();
+
+	// Destroying a handle cancels every latent task it was still waiting on
+	const uint64 HandleKey = MakeHandleKey(GraphId, HandleIndex);
+
+	for (auto It = PendingNodeWaits.CreateIterator(); It; ++It)
+	{
+		const FOpenLogicTraceWaitScope& WaitScope = WaitScopes[It.Value()];
+		if (MakeHandleKey(WaitScope.GraphId, WaitScope.HandleIndex) == HandleKey)
+		{
+			CloseWaitScope(Time, It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (const uint32* QueueWait = PendingQueueWaits.Find(HandleKey))
+	{
+		CloseWaitScope(Time, *QueueWait);
+		PendingQueueWaits.Remove(HandleKey);
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::BeginNode(double Time, uint64 GraphId, int32 HandleIndex, uint32 ThreadId, const FGuid& NodeID, uint64 ClassId)
+{
+	Session.WriteAccessCheck();
+
+	// Graphs activated from a node of another graph nest under it, so the stack is shared by every graph of the thread
+	FNodeTimeline& Timeline = NodeTimelines.FindOrAdd(ThreadId);
+
+	FOpenLogicTraceNodeScope& Scope = Timeline.Scopes.AddDefaulted_GetRef();
+	Scope.StartTime = Time;
+	Scope.Depth = Timeline.Stack.Num();
+	Scope.GraphId = GraphId;
+	Scope.HandleIndex = HandleIndex;
+	Scope.ThreadId = ThreadId;
+	Scope.NodeID = NodeID;
+	Scope.TaskClassName = TaskClassNames.FindRef(ClassId);
+
+	Timeline.Stack.Add(Timeline.Scopes.Num() - 1);
+	MaxNodeDepth = FMath::Max(MaxNodeDepth, Scope.Depth);
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::EndNode(double Time, uint64 GraphId, int32 HandleIndex, uint32 ThreadId, const FGuid& NodeID, bool bPending)
+{
+	Session.WriteAccessCheck();
+
+	FNodeTimeline* Timeline = NodeTimelines.Find(ThreadId);
+	if (!Timeline || Timeline->Stack.IsEmpty())
+	{
+		return;
+	}
+
+	// Unwind until the matching activation, closing anything left open by a missed end event
+	const TCHAR* TaskClassName = nullptr;
+	while (!Timeline->Stack.IsEmpty())
+	{
+		FOpenLogicTraceNodeScope& Scope = Timeline->Scopes[Timeline->Stack.Pop()];
+		Scope.EndTime = Time;
+
+		if (Scope.NodeID == NodeID && Scope.HandleIndex == HandleIndex && Scope.GraphId == GraphId)
+		{
+			TaskClassName = Scope.TaskClassName;
+			break;
+		}
+	}
+
+	if (bPending)
+	{
+		const uint64 NodeKey = MakeNodeKey(GraphId, HandleIndex, NodeID);
+		if (!PendingNodeWaits.Contains(NodeKey))
+		{
+			PendingNodeWaits.Add(NodeKey, OpenWaitScope(Time, GraphId, HandleIndex, NodeID, TaskClassName));
+		}
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::CompleteNode(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID)
+{
+	Session.WriteAccessCheck();
+
+	const uint64 NodeKey = MakeNodeKey(GraphId, HandleIndex, NodeID);
+
+	uint32 WaitIndex = 0;
+	if (PendingNodeWaits.RemoveAndCopyValue(NodeKey, WaitIndex))
+	{
+		CloseWaitScope(Time, WaitIndex);
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::AddPinWrite(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID, int32 PinIndex)
+{
+	Session.WriteAccessCheck();
+
+	PinWriteCount++;
+}
+
+void FOpenLogicTraceProvider::AddPoolAccess(double Time, uint64 ClassId, bool bHit)
+{
+	Session.WriteAccessCheck();
+
+	if (bHit)
+	{
+		PoolHitCount++;
+	}
+	else
+	{
+		PoolMissCount++;
+	}
+}
+
+void FOpenLogicTraceProvider::AddQueueEnqueue(double Time, uint64 GraphId, int32 HandleIndex)
+{
+	Session.WriteAccessCheck();
+
+	const uint64 HandleKey = MakeHandleKey(GraphId, HandleIndex);
+	if (!PendingQueueWaits.Contains(HandleKey))
+	{
+		PendingQueueWaits.Add(HandleKey, OpenWaitScope(Time, GraphId, HandleIndex, FGuid(), TEXT("Queued")));
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::AddQueueDequeue(double Time, uint64 GraphId, int32 HandleIndex)
+{
+	Session.WriteAccessCheck();
+
+	uint32 WaitIndex = 0;
+	if (PendingQueueWaits.RemoveAndCopyValue(MakeHandleKey(GraphId, HandleIndex), WaitIndex))
+	{
+		CloseWaitScope(Time, WaitIndex);
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FOpenLogicTraceProvider::EnumerateNodeThreads(TFunctionRef<void(uint32 ThreadId)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	for (const auto& TimelinePair : NodeTimelines)
+	{
+		Callback(TimelinePair.Key);
+	}
+}
+
+void FOpenLogicTraceProvider::EnumerateNodeScopes(uint32 ThreadId, double StartTime, double EndTime, TFunctionRef<void(const FOpenLogicTraceNodeScope&)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	const FNodeTimeline* Timeline = NodeTimelines.Find(ThreadId);
+	if (!Timeline)
+	{
+		return;
+	}
+
+	for (const FOpenLogicTraceNodeScope& Scope : Timeline->Scopes)
+	{
+		if (Scope.StartTime > EndTime)
+		{
+			break;
+		}
+
+		// Scopes that are still open extend to the end of the session
+		const double ScopeEndTime = Scope.EndTime < 0.0 ? Session.GetDurationSeconds() : Scope.EndTime;
+		if (ScopeEndTime >= StartTime)
+		{
+			Callback(Scope);
+		}
+	}
+}
+
+void FOpenLogicTraceProvider::EnumerateWaitScopes(double StartTime, double EndTime, TFunctionRef<void(const FOpenLogicTraceWaitScope&)> Callback) const
+{
+	Session.ReadAccessCheck();
+
+	for (const FOpenLogicTraceWaitScope& Scope : WaitScopes)
+	{
+		if (Scope.StartTime > EndTime)
+		{
+			continue;
+		}
+
+		const double ScopeEndTime = Scope.EndTime < 0.0 ? Session.GetDurationSeconds() : Scope.EndTime;
+		if (ScopeEndTime >= StartTime)
+		{
+			Callback(Scope);
+		}
+	}
+}
+
+const TCHAR* FOpenLogicTraceProvider::GetGraphName(uint64 GraphId) const
+{
+	Session.ReadAccessCheck();
+
+	return GraphNames.FindRef(GraphId);
+}
+
+uint32 FOpenLogicTraceProvider::OpenWaitScope(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID, const TCHAR* Name)
+{
+	// Pick the first free lane so concurrent waits don't overlap in the track
+	int32 Lane = BusyWaitLanes.Find(false);
+	if (Lane == INDEX_NONE)
+	{
+		Lane = BusyWaitLanes.Add(true);
+	}
+	else
+	{
+		BusyWaitLanes[Lane] = true;
+	}
+
+	FOpenLogicTraceWaitScope& Scope = WaitScopes.AddDefaulted_GetRef();
+	Scope.StartTime = Time;
+	Scope.Lane = Lane;
+	Scope.GraphId = GraphId;
+	Scope.HandleIndex = HandleIndex;
+	Scope.NodeID = NodeID;
+	Scope.Name = Name ? Name : TEXT("Latent");
+
+	MaxWaitLane = FMath::Max(MaxWaitLane, static_cast<uint32>(Lane));
+
+	return WaitScopes.Num() - 1;
+}
+
+void FOpenLogicTraceProvider::CloseWaitScope(double Time, uint32 WaitIndex)
+{
+	if (!WaitScopes.IsValidIndex(WaitIndex))
+	{
+		return;
+	}
+
+	FOpenLogicTraceWaitScope& Scope = WaitScopes[WaitIndex];
+	Scope.EndTime = Time;
+
+	if (BusyWaitLanes.IsValidIndex(Scope.Lane))
+	{
+		BusyWaitLanes[Scope.Lane] = false;
+	}
+}
@@ -0,0 +1,22 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "OpenLogicInsights.h"
+#include "Features/IModularFeatures.h"
+
+#define LOCTEXT_NAMESPACE "FOpenLogicInsightsModule"
+
+void FOpenLogicInsightsModule::StartupModule()
+{
+	IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+	IModularFeatures::Get().RegisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, &TimingViewExtender);
+}
+
+void FOpenLogicInsightsModule::ShutdownModule()
+{
+	IModularFeatures::Get().UnregisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, &TimingViewExtender);
+	IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FOpenLogicInsightsModule, OpenLogicInsights)
@@ -0,0 +1,48 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Timing/OpenLogicTimingTrack.h"
+#include "Analysis/OpenLogicTraceProvider.h"
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+INSIGHTS_IMPLEMENT_RTTI(FOpenLogicTimingTrack)
+
+FOpenLogicTimingTrack::FOpenLogicTimingTrack(const TraceServices::IAnalysisSession& InSession, EOpenLogicTimingTrackMode InMode, uint32 InThreadId)
+	: FTimingEventsTrack(InMode == EOpenLogicTimingTrackMode::Nodes ? FString::Printf(TEXT("OpenLogic Nodes (Thread %u)"), InThreadId) : FString(TEXT("OpenLogic Waits")))
+	, Session(InSession)
+	, Mode(InMode)
+	, ThreadId(InThreadId)
+{
+}
+
+void FOpenLogicTimingTrack::BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context)
+{
+	TraceServices::FAnalysisSessionReadScope ReadScope(Session);
+
+	const FOpenLogicTraceProvider* Provider = Session.ReadProvider<FOpenLogicTraceProvider>(FOpenLogicTraceProvider::ProviderName);
+	if (!Provider)
+	{
+		return;
+	}
+
+	const FTimingTrackViewport& Viewport = Context.GetViewport();
+	const double SessionEndTime = Session.GetDurationSeconds();
+
+	if (Mode == EOpenLogicTimingTrackMode::Nodes)
+	{
+		Provider->EnumerateNodeScopes(ThreadId, Viewport.GetStartTime(), Viewport.GetEndTime(), [&Builder, SessionEndTime](const FOpenLogicTraceNodeScope& Scope)
+		{
+			const double EndTime = Scope.EndTime < 0.0 ? SessionEndTime : Scope.EndTime;
+			Builder.AddEvent(Scope.StartTime, EndTime, Scope.Depth, Scope.TaskClassName ? Scope.TaskClassName : TEXT("Unknown Task"), Scope.HandleIndex);
+		});
+	}
+	else
+	{
+		Provider->EnumerateWaitScopes(Viewport.GetStartTime(), Viewport.GetEndTime(), [&Builder, SessionEndTime](const FOpenLogicTraceWaitScope& Scope)
+		{
+			const double EndTime = Scope.EndTime < 0.0 ? SessionEndTime : Scope.EndTime;
+			Builder.AddEvent(Scope.StartTime, EndTime, Scope.Lane, Scope.Name, Scope.HandleIndex);
+		});
+	}
+}
@@ -0,0 +1,97 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Timing/OpenLogicTimingViewExtender.h"
+#include "Timing/OpenLogicTimingTrack.h"
+#include "Analysis/OpenLogicTraceProvider.h"
+#include "Insights/ITimingViewSession.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+#define LOCTEXT_NAMESPACE "FOpenLogicTimingViewExtender"
+
+void FOpenLogicTimingViewExtender::OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	PerSessionDataMap.Add(&InSession, FPerSessionData());
+}
+
+void FOpenLogicTimingViewExtender::OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	PerSessionDataMap.Remove(&InSession);
+}
+
+void FOpenLogicTimingViewExtender::Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	FPerSessionData* PerSessionData = PerSessionDataMap.Find(&InSession);
+	if (!PerSessionData)
+	{
+		return;
+	}
+
+	// Only add the tracks once the trace actually contains OpenLogic events, and add a node track for each new thread
+	TArray<uint32> NewThreadIds;
+	{
+		TraceServices::FAnalysisSessionReadScope ReadScope(InAnalysisSession);
+
+		const FOpenLogicTraceProvider* Provider = InAnalysisSession.ReadProvider<FOpenLogicTraceProvider>(FOpenLogicTraceProvider::ProviderName);
+		if (!Provider || !Provider->HasData())
+		{
+			return;
+		}
+
+		Provider->EnumerateNodeThreads([PerSessionData, &NewThreadIds](uint32 ThreadId)
+		{
+			if (!PerSessionData->NodeTracks.Contains(ThreadId))
+			{
+				NewThreadIds.Add(ThreadId);
+			}
+		});
+	}
+
+	NewThreadIds.Sort();
+	for (const uint32 ThreadId : NewThreadIds)
+	{
+		TSharedPtr<FOpenLogicTimingTrack> NodesTrack = MakeShared<FOpenLogicTimingTrack>(InAnalysisSession, EOpenLogicTimingTrackMode::Nodes, ThreadId);
+		PerSessionData->NodeTracks.Add(ThreadId, NodesTrack);
+		InSession.AddScrollableTrack(NodesTrack);
+	}
+
+	if (!PerSessionData->WaitsTrack.IsValid())
+	{
+		PerSessionData->WaitsTrack = MakeShared<FOpenLogicTimingTrack>(InAnalysisSession, EOpenLogicTimingTrackMode::Waits);
+		InSession.AddScrollableTrack(PerSessionData->WaitsTrack);
+	}
+}
+
+void FOpenLogicTimingViewExtender::ExtendFilterMenu(UE::Insights::Timing::ITimingViewSession& InSession, FMenuBuilder& InMenuBuilder)
+{
+	FPerSessionData* PerSessionData = PerSessionDataMap.Find(&InSession);
+	if (!PerSessionData || !PerSessionData->WaitsTrack.IsValid())
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FOpenLogicTimingTrack>> Tracks;
+	PerSessionData->NodeTracks.KeySort(TLess<uint32>());
+	PerSessionData->NodeTracks.GenerateValueArray(Tracks);
+	Tracks.Add(PerSessionData->WaitsTrack);
+
+	InMenuBuilder.BeginSection("OpenLogic", LOCTEXT("OpenLogicSection", "OpenLogic"));
+
+	for (TSharedPtr<FOpenLogicTimingTrack> Track : Tracks)
+	{
+		InMenuBuilder.AddMenuEntry(
+			FText::FromString(Track->GetName()),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda([Track]() { Track->ToggleVisibility(); }),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([Track]() { return Track->IsVisible(); })),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton);
+	}
+
+	InMenuBuilder.EndSection();
+}
+
+#undef LOCTEXT_NAMESPACE
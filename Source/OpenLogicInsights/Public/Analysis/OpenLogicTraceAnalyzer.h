@@ -0,0 +1,47 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Analyzer.h"
+
+// Forward declarations
+class FOpenLogicTraceProvider;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+/**
+ * Decodes the events emitted on the OpenLogic trace channel and feeds them to the FOpenLogicTraceProvider.
+ */
+class FOpenLogicTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+public:
+	FOpenLogicTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FOpenLogicTraceProvider& InProvider);
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_GraphSpec,
+		RouteId_TaskClassSpec,
+		RouteId_HandleCreated,
+		RouteId_HandleDestroyed,
+		RouteId_NodeActivated,
+		RouteId_NodeActivationEnd,
+		RouteId_NodeCompleted,
+		RouteId_PinWrite,
+		RouteId_PoolAccess,
+		RouteId_QueueEnqueue,
+		RouteId_QueueDequeue,
+	};
+
+	static FGuid ReadNodeGuid(const FEventData& EventData);
+
+	TraceServices::IAnalysisSession& Session;
+	FOpenLogicTraceProvider& Provider;
+};
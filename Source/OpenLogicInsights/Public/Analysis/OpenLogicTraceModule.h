@@ -0,0 +1,21 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/ModuleService.h"
+
+/**
+ * Registers the OpenLogic analyzer and provider with every new analysis session.
+ */
+class FOpenLogicTraceModule : public TraceServices::IModule
+{
+public:
+	virtual void GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo) override;
+	virtual void OnAnalysisBegin(TraceServices::IAnalysisSession& InSession) override;
+	virtual void GetLoggers(TArray<const TCHAR*>& OutLoggers) override;
+	virtual void GenerateReports(const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory) override {}
+
+private:
+	static FName ModuleName;
+};
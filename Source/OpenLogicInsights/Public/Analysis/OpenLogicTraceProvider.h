@@ -0,0 +1,107 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+// A synchronous node activation, from NodeActivated to NodeActivationEnd
+struct FOpenLogicTraceNodeScope
+{
+	double StartTime = 0.0;
+	double EndTime = -1.0;
+	uint32 Depth = 0;
+	uint64 GraphId = 0;
+	int32 HandleIndex = INDEX_NONE;
+	uint32 ThreadId = 0;
+	FGuid NodeID;
+	const TCHAR* TaskClassName = nullptr;
+};
+
+// A time span spent waiting, either on a latent task completion or in the background queue
+struct FOpenLogicTraceWaitScope
+{
+	double StartTime = 0.0;
+	double EndTime = -1.0;
+	uint32 Lane = 0;
+	uint64 GraphId = 0;
+	int32 HandleIndex = INDEX_NONE;
+	FGuid NodeID;
+	const TCHAR* Name = nullptr;
+};
+
+class OPENLOGICINSIGHTS_API FOpenLogicTraceProvider : public TraceServices::IProvider
+{
+public:
+	static FName ProviderName;
+
+	explicit FOpenLogicTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	// Analysis (write) side, called by the analyzer inside an edit scope
+	void AddGraph(uint64 GraphId, const FString& Name);
+	void AddTaskClass(uint64 ClassId, const FString& Name);
+	void AddHandleCreated(double Time, uint64 GraphId, int32 HandleIndex);
+	void AddHandleDestroyed(double Time, uint64 GraphId, int32 HandleIndex);
+	void BeginNode(double Time, uint64 GraphId, int32 HandleIndex, uint32 ThreadId, const FGuid& NodeID, uint64 ClassId);
+	void EndNode(double Time, uint64 GraphId, int32 HandleIndex, uint32 ThreadId, const FGuid& NodeID, bool bPending);
+	void CompleteNode(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID);
+	void AddPinWrite(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID, int32 PinIndex);
+	void AddPoolAccess(double Time, uint64 ClassId, bool bHit);
+	void AddQueueEnqueue(double Time, uint64 GraphId, int32 HandleIndex);
+	void AddQueueDequeue(double Time, uint64 GraphId, int32 HandleIndex);
+
+	// Query (read) side, called by the timing track inside a read scope
+	void EnumerateNodeThreads(TFunctionRef<void(uint32 ThreadId)> Callback) const;
+	void EnumerateNodeScopes(uint32 ThreadId, double StartTime, double EndTime, TFunctionRef<void(const FOpenLogicTraceNodeScope&)> Callback) const;
+	void EnumerateWaitScopes(double StartTime, double EndTime, TFunctionRef<void(const FOpenLogicTraceWaitScope&)> Callback) const;
+	const TCHAR* GetGraphName(uint64 GraphId) const;
+
+	bool HasData() const { return NodeTimelines.Num() > 0 || WaitScopes.Num() > 0; }
+	uint32 GetMaxNodeDepth() const { return MaxNodeDepth; }
+	uint32 GetMaxWaitLane() const { return MaxWaitLane; }
+	uint64 GetPoolHitCount() const { return PoolHitCount; }
+	uint64 GetPoolMissCount() const { return PoolMissCount; }
+	uint64 GetPinWriteCount() const { return PinWriteCount; }
+	uint64 GetHandleCount() const { return HandleCount; }
+
+private:
+	uint32 OpenWaitScope(double Time, uint64 GraphId, int32 HandleIndex, const FGuid& NodeID, const TCHAR* Name);
+	void CloseWaitScope(double Time, uint32 WaitIndex);
+
+	static uint64 MakeHandleKey(uint64 GraphId, int32 HandleIndex) { return HashCombineFast(GetTypeHash(GraphId), GetTypeHash(HandleIndex)); }
+	static uint64 MakeNodeKey(uint64 GraphId, int32 HandleIndex, const FGuid& NodeID) { return HashCombineFast(MakeHandleKey(GraphId, HandleIndex), GetTypeHash(NodeID)); }
+
+private:
+	TraceServices::IAnalysisSession& Session;
+
+	TMap<uint64, const TCHAR*> GraphNames;
+	TMap<uint64, const TCHAR*> TaskClassNames;
+
+	// The synchronous scopes of one thread. Events of a thread arrive in order, so its scopes are in start time order.
+	struct FNodeTimeline
+	{
+		TArray<FOpenLogicTraceNodeScope> Scopes;
+
+		// Open scopes, used to compute nesting depth
+		TArray<int32> Stack;
+	};
+
+	TMap<uint32, FNodeTimeline> NodeTimelines;
+
+	// Events of different threads are not ordered, so waits opened from several threads are not in start time order
+	TArray<FOpenLogicTraceWaitScope> WaitScopes;
+
+	// Open wait scopes per node (latent tasks) and per handle (queued handles)
+	TMap<uint64, uint32> PendingNodeWaits;
+	TMap<uint64, uint32> PendingQueueWaits;
+
+	// Which wait lanes are currently in use
+	TBitArray<> BusyWaitLanes;
+
+	uint32 MaxNodeDepth = 0;
+	uint32 MaxWaitLane = 0;
+	uint64 PoolHitCount = 0;
+	uint64 PoolMissCount = 0;
+	uint64 PinWriteCount = 0;
+	uint64 HandleCount = 0;
+};
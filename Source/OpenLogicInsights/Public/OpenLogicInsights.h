@@ -0,0 +1,20 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "Analysis/OpenLogicTraceModule.h"
+#include "Timing/OpenLogicTimingViewExtender.h"
+
+class FOpenLogicInsightsModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	FOpenLogicTraceModule TraceModule;
+	FOpenLogicTimingViewExtender TimingViewExtender;
+};
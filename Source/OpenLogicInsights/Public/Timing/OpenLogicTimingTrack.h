@@ -0,0 +1,40 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Insights/ViewModels/TimingEventsTrack.h"
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+enum class EOpenLogicTimingTrackMode : uint8
+{
+	// Synchronous node activations of one thread, nested by call depth
+	Nodes,
+
+	// Latent task waits and background queue waits
+	Waits
+};
+
+/**
+ * Timing view track showing OpenLogic node activity next to the CPU and frame tracks.
+ */
+class FOpenLogicTimingTrack : public FTimingEventsTrack
+{
+	INSIGHTS_DECLARE_RTTI(FOpenLogicTimingTrack, FTimingEventsTrack)
+
+public:
+	FOpenLogicTimingTrack(const TraceServices::IAnalysisSession& InSession, EOpenLogicTimingTrackMode InMode, uint32 InThreadId = 0);
+
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override;
+
+private:
+	const TraceServices::IAnalysisSession& Session;
+	EOpenLogicTimingTrackMode Mode;
+
+	// The thread whose activations a Nodes track shows
+	uint32 ThreadId = 0;
+};
@@ -0,0 +1,31 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Insights/ITimingViewExtender.h"
+
+// Forward declarations
+class FOpenLogicTimingTrack;
+
+/**
+ * Adds the OpenLogic tracks to the Insights timing view once the session contains OpenLogic events.
+ */
+class FOpenLogicTimingViewExtender : public UE::Insights::Timing::ITimingViewExtender
+{
+public:
+	virtual void OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+	virtual void ExtendFilterMenu(UE::Insights::Timing::ITimingViewSession& InSession, FMenuBuilder& InMenuBuilder) override;
+
+private:
+	struct FPerSessionData
+	{
+		// One track per thread that activated nodes, as the activations of different threads overlap
+		TMap<uint32, TSharedPtr<FOpenLogicTimingTrack>> NodeTracks;
+		TSharedPtr<FOpenLogicTimingTrack> WaitsTrack;
+	};
+
+	TMap<UE::Insights::Timing::ITimingViewSession*, FPerSessionData> PerSessionDataMap;
+};
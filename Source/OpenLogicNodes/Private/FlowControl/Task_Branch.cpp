@@ -3,6 +3,14 @@
 #include "FlowControl/Task_Branch.h"
 #include "NodeLibraryTags.h"
 #include "Classes/Properties/OpenLogicBoolean.h"
+#include "Runtime/OpenLogicBatchedGraph.h"
+
+// Output pin indices, in the order the constructor declares them
+namespace BranchPins
+{
+	constexpr int32 True = 1;
+	constexpr int32 False = 2;
+}
 
 UTask_Branch::UTask_Branch(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -19,11 +27,13 @@ UTask_Branch::UTask_Branch(const FObjectInitializer& ObjectInitializer)
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("True"));
 	TaskData.OutputPins.Add(FOpenLogicPinData("False"));
+
+	bSupportsBatchedExecution = true;
 }
 
 void UTask_Branch::OnTaskActivated_Implementation(UObject* Context, FName PinName)
 {
-	if (GetPropertyValueByAttribute<bool>(FName("Condition")))
+	if (ConditionPin.Get())
 	{
 		CompleteTask("True");
 	} else
@@ -31,3 +41,24 @@ void UTask_Branch::OnTaskActivated_Implementation(UObject* Context, FName PinNam
 		CompleteTask("False");
 	}
 }
+
+void UTask_Branch::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const bool* Condition = Context.GetInputColumn<bool>(ConditionPin.GetHandle().PinIndex);
+	if (!Condition)
+	{
+		return;
+	}
+
+	// Each side continues with the instances that took it, in one activation
+	TArray<int32, TInlineAllocator<64>> TrueInstances;
+	TArray<int32, TInlineAllocator<64>> FalseInstances;
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		(Condition[Instance] ? TrueInstances : FalseInstances).Add(Instance);
+	}
+
+	Context.ExecutePin(BranchPins::True, TrueInstances);
+	Context.ExecutePin(BranchPins::False, FalseInstances);
+}
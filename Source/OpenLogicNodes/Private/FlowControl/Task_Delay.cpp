@@ -23,11 +23,13 @@ UTask_Delay::UTask_Delay(const FObjectInitializer& ObjectInitializer)
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Completed"));
+
+	bIsLatent = true;
 }
 
 void UTask_Delay::OnTaskActivated_Implementation(UObject* Context, FName PinName)
 {
-	float Duration = GetPropertyValueByAttribute<float>(FName("Duration"));
+	const float Duration = DurationPin.Get();
 
 	if (Duration <= 0.0f)
 	{
@@ -35,6 +37,37 @@ void UTask_Delay::OnTaskActivated_Implementation(UObject* Context, FName PinName
 		return;
 	}
 
+	StartDelay(Duration);
+}
+
+void UTask_Delay::SerializeTaskState(FArchive& Ar)
+{
+	Super::SerializeTaskState(Ar);
+
+	// Negative when no delay is pending
+	float TimeRemaining = -1.0f;
+
+	if (Ar.IsSaving())
+	{
+		UWorld* World = GetWorld();
+		FDelayAction* Action = World ? World->GetLatentActionManager().FindExistingAction<FDelayAction>(this, DelayUUID) : nullptr;
+		if (Action)
+		{
+			TimeRemaining = Action->TimeRemaining;
+		}
+	}
+
+	Ar << TimeRemaining;
+
+	// A delay that was about to end completes on the next latent update, not while the graph is being restored
+	if (Ar.IsLoading() && TimeRemaining >= 0.0f)
+	{
+		StartDelay(TimeRemaining);
+	}
+}
+
+void UTask_Delay::StartDelay(float Duration)
+{
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -46,7 +79,7 @@ void UTask_Delay::OnTaskActivated_Implementation(UObject* Context, FName PinName
 	LatentInfo.CallbackTarget = this;
 	LatentInfo.ExecutionFunction = GET_FUNCTION_NAME_CHECKED(UTask_Delay, OnDelayCompleted);
 	LatentInfo.Linkage = 0;
-	LatentInfo.UUID = GetUniqueID();
+	LatentInfo.UUID = DelayUUID;
 
 	if (!LatentManager.FindExistingAction<FDelayAction>(this, LatentInfo.UUID))
 	{
@@ -54,6 +87,13 @@ void UTask_Delay::OnTaskActivated_Implementation(UObject* Context, FName PinName
 	}
 }
 
+void UTask_Delay::OnTaskCompleted_Implementation()
+{
+	Super::OnTaskCompleted_Implementation();
+
+	DelayUUID++;
+}
+
 void UTask_Delay::OnDelayCompleted()
 {
 	CompleteTask("Completed");
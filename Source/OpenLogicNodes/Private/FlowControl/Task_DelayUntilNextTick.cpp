@@ -21,9 +21,36 @@ UTask_DelayUntilNextTick::UTask_DelayUntilNextTick(const FObjectInitializer& Obj
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Completed"));
+
+	bIsLatent = true;
 }
 
 void UTask_DelayUntilNextTick::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	StartDelay();
+}
+
+void UTask_DelayUntilNextTick::SerializeTaskState(FArchive& Ar)
+{
+	Super::SerializeTaskState(Ar);
+
+	bool bPending = false;
+
+	if (Ar.IsSaving())
+	{
+		UWorld* World = GetWorld();
+		bPending = World && World->GetLatentActionManager().FindExistingAction<FDelayUntilNextTickAction>(this, DelayUUID) != nullptr;
+	}
+
+	Ar << bPending;
+
+	if (Ar.IsLoading() && bPending)
+	{
+		StartDelay();
+	}
+}
+
+void UTask_DelayUntilNextTick::StartDelay()
 {
 	UWorld* World = GetWorld();
 	if (!World)
@@ -36,7 +63,7 @@ void UTask_DelayUntilNextTick::OnTaskActivated_Implementation(UObject* Context,
 	LatentInfo.CallbackTarget = this;
 	LatentInfo.ExecutionFunction = GET_FUNCTION_NAME_CHECKED(UTask_DelayUntilNextTick, OnDelayCompleted);
 	LatentInfo.Linkage = 0;
-	LatentInfo.UUID = GetUniqueID();
+	LatentInfo.UUID = DelayUUID;
 
 	if (!LatentManager.FindExistingAction<FDelayUntilNextTickAction>(this, LatentInfo.UUID))
 	{
@@ -44,6 +71,13 @@ void UTask_DelayUntilNextTick::OnTaskActivated_Implementation(UObject* Context,
 	}
 }
 
+void UTask_DelayUntilNextTick::OnTaskCompleted_Implementation()
+{
+	Super::OnTaskCompleted_Implementation();
+
+	DelayUUID++;
+}
+
 void UTask_DelayUntilNextTick::OnDelayCompleted()
 {
 	CompleteTask("Completed");
@@ -31,12 +31,12 @@ void UTask_DoN::OnTaskActivated_Implementation(UObject* Context, FName PinName)
 		return;
 	}
 	
-	int32 N = GetPropertyValueByAttribute<int32>(FName("N"));
+	const int32 N = NPin.Get();
 
 	if (Counter < N)
 	{
 		Counter++;
-		SetPropertyValueByAttribute<int32>(FName("Counter"), Counter);
+		CounterPin.Set(Counter);
 		ExecutePinByName("execute");
 	}
 }
\ No newline at end of file
@@ -31,7 +31,7 @@ void UTask_DoOnce::OnTaskActivated_Implementation(UObject* Context, FName PinNam
 		return;	
 	}
 
-	bool bStartClosed = GetPropertyValueByAttribute<bool>(FName("Start Closed"));
+	const bool bStartClosed = StartClosedPin.Get();
 	
 	if (bFirstEntrance)
 	{
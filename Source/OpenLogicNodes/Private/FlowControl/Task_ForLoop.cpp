@@ -21,12 +21,14 @@ UTask_ForLoop::UTask_ForLoop(const FObjectInitializer& ObjectInitializer)
 	TaskData.OutputPins.Add(FOpenLogicPinData("Loop Body"));
 	TaskData.OutputPins.Add(FOpenLogicPinData("Index", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicInteger::StaticClass()));
 	TaskData.OutputPins.Add(FOpenLogicPinData("Completed"));
+
+	LoopBodyPin = "Loop Body";
 }
 
 void UTask_ForLoop::OnTaskActivated_Implementation(UObject* Context, FName PinName)
 {
-	int32 FirstIndex = GetPropertyValueByAttribute<int32>(FName("First Index"));
-	int32 LastIndex = GetPropertyValueByAttribute<int32>(FName("Last Index"));
+	const int32 FirstIndex = FirstIndexPin.Get();
+	const int32 LastIndex = LastIndexPin.Get();
 
 	if (FirstIndex > LastIndex)
 	{
@@ -36,7 +38,7 @@ void UTask_ForLoop::OnTaskActivated_Implementation(UObject* Context, FName PinNa
 
 	for (int32 Index = FirstIndex; Index <= LastIndex; Index++)
 	{
-		SetPropertyValueByAttribute<int32>(FName("Index"), Index);
+		IndexPin.Set(Index);
 		ExecutePinByName("Loop Body");
 	}
 
@@ -22,6 +22,8 @@ UTask_ForLoopWithBreak::UTask_ForLoopWithBreak(const FObjectInitializer& ObjectI
 	TaskData.OutputPins.Add(FOpenLogicPinData("Loop Body"));
 	TaskData.OutputPins.Add(FOpenLogicPinData("Index", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicInteger::StaticClass()));
 	TaskData.OutputPins.Add(FOpenLogicPinData("Completed"));
+
+	LoopBodyPin = "Loop Body";
 }
 
 void UTask_ForLoopWithBreak::OnTaskActivated_Implementation(UObject* Context, FName PinName)
@@ -34,8 +36,8 @@ void UTask_ForLoopWithBreak::OnTaskActivated_Implementation(UObject* Context, FN
 
 	bBreak = false;
 	
-	int32 FirstIndex = GetPropertyValueByAttribute<int32>(FName("First Index"));
-	int32 LastIndex = GetPropertyValueByAttribute<int32>(FName("Last Index"));
+	const int32 FirstIndex = FirstIndexPin.Get();
+	const int32 LastIndex = LastIndexPin.Get();
 
 	if (FirstIndex > LastIndex)
 	{
@@ -45,7 +47,7 @@ void UTask_ForLoopWithBreak::OnTaskActivated_Implementation(UObject* Context, FN
 
 	for (int32 Index = FirstIndex; Index <= LastIndex; Index++)
 	{
-		SetPropertyValueByAttribute<int32>(FName("Index"), Index);
+		IndexPin.Set(Index);
 		ExecutePinByName("Loop Body");
 
 		if (bBreak)
@@ -0,0 +1,17 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Literal/Task_MakeLiteral.h"
+
+UTask_MakeLiteral::UTask_MakeLiteral(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bIsThreadSafe = true;
+
+	Functions.Activate = &UTask_MakeLiteral::Activate;
+}
+
+void UTask_MakeLiteral::Activate(FOpenLogicStructTaskContext& Context)
+{
+	// The value is immutable once shared, so it is passed on as is
+	Context.SetOutputValue(1, Context.GetInputValue(1));
+}
@@ -18,8 +18,3 @@ UTask_MakeLiteralBoolean::UTask_MakeLiteralBoolean(const FObjectInitializer& Obj
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicBoolean::StaticClass()));
 }
-
-void UTask_MakeLiteralBoolean::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
-}
@@ -17,9 +17,4 @@ UTask_MakeLiteralByte::UTask_MakeLiteralByte(const FObjectInitializer& ObjectIni
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicByte::StaticClass()));
-}
-
-void UTask_MakeLiteralByte::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
 }
\ No newline at end of file
@@ -17,9 +17,4 @@ UTask_MakeLiteralDouble::UTask_MakeLiteralDouble(const FObjectInitializer& Objec
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicDouble::StaticClass()));
-}
-
-void UTask_MakeLiteralDouble::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
 }
\ No newline at end of file
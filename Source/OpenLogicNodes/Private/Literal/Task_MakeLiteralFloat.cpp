@@ -17,9 +17,4 @@ UTask_MakeLiteralFloat::UTask_MakeLiteralFloat(const FObjectInitializer& ObjectI
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
-}
-
-void UTask_MakeLiteralFloat::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
 }
\ No newline at end of file
@@ -17,9 +17,4 @@ UTask_MakeLiteralInteger::UTask_MakeLiteralInteger(const FObjectInitializer& Obj
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicInteger::StaticClass()));
-}
-
-void UTask_MakeLiteralInteger::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
 }
\ No newline at end of file
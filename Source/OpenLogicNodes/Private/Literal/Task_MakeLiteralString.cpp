@@ -17,9 +17,4 @@ UTask_MakeLiteralString::UTask_MakeLiteralString(const FObjectInitializer& Objec
 
 	// Output pins
 	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicString::StaticClass()));
-}
-
-void UTask_MakeLiteralString::OnTaskActivated_Implementation(UObject* Context, FName PinName)
-{
-	Super::OnTaskActivated_Implementation(Context, PinName);
 }
\ No newline at end of file
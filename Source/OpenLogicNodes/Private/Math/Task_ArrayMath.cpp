@@ -0,0 +1,267 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_ArrayMath.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicBoolean.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+#include "Classes/Properties/OpenLogicFloatArray.h"
+#include "Classes/Properties/OpenLogicVector.h"
+#include "Classes/Properties/OpenLogicVectorArray.h"
+
+// The array nodes write into an existing array, so batched columns keep their allocations between activations
+namespace OpenLogicArrayMath
+{
+	static void Filter(const TArray<float>& Array, float Min, float Max, TArray<float>& OutArray)
+	{
+		OutArray.Reset(Array.Num());
+
+		for (const float Element : Array)
+		{
+			if (Element >= Min && Element <= Max)
+			{
+				OutArray.Add(Element);
+			}
+		}
+	}
+
+	static void Sort(const TArray<float>& Array, bool bDescending, TArray<float>& OutArray)
+	{
+		OutArray = Array;
+
+		if (bDescending)
+		{
+			OutArray.Sort(TGreater<float>());
+		}
+		else
+		{
+			OutArray.Sort();
+		}
+	}
+
+	static void DotProduct(const TArray<FVector>& Array, const FVector& B, TArray<float>& OutArray)
+	{
+		OutArray.SetNumUninitialized(Array.Num());
+
+		const VectorRegister VectorB = OpenLogicMath::LoadVector(B);
+		for (int32 Index = 0; Index < Array.Num(); Index++)
+		{
+			FVector::FReal Dot;
+			VectorStoreFloat1(VectorDot3(OpenLogicMath::LoadVector(Array[Index]), VectorB), &Dot);
+			OutArray[Index] = static_cast<float>(Dot);
+		}
+	}
+}
+
+UTask_FloatArrayReduction::UTask_FloatArrayReduction(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Category = "Math|Array";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Array", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.5f;
+}
+
+void UTask_FloatArrayReduction::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	const TArray<float>* Array = ArrayPin.GetPtr();
+	ReturnValuePin.Set(Array ? Reduce(*Array) : 0.0f);
+}
+
+void UTask_FloatArrayReduction::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const TArray<float>* Array = Context.GetInputColumn<TArray<float>>(ArrayPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Array || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context, [&](int32 Instance) { ReturnValue[Instance] = Reduce(Array[Instance]); });
+}
+
+UTask_SumFloatArray::UTask_SumFloatArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Sum (Float Array)";
+	TaskData.Description = FText::FromString("Returns the sum of the elements of Array.");
+}
+
+float UTask_SumFloatArray::Reduce(const TArray<float>& Array) const
+{
+	return OpenLogicMath::SumFloats(Array.GetData(), Array.Num());
+}
+
+UTask_MinFloatArray::UTask_MinFloatArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Min (Float Array)";
+	TaskData.Description = FText::FromString("Returns the smallest element of Array, or 0 if it is empty.");
+}
+
+float UTask_MinFloatArray::Reduce(const TArray<float>& Array) const
+{
+	return OpenLogicMath::ReduceFloats<false>(Array.GetData(), Array.Num());
+}
+
+UTask_MaxFloatArray::UTask_MaxFloatArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Max (Float Array)";
+	TaskData.Description = FText::FromString("Returns the largest element of Array, or 0 if it is empty.");
+}
+
+float UTask_MaxFloatArray::Reduce(const TArray<float>& Array) const
+{
+	return OpenLogicMath::ReduceFloats<true>(Array.GetData(), Array.Num());
+}
+
+UTask_FilterFloatArray::UTask_FilterFloatArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Filter (Float Array)";
+	TaskData.Description = FText::FromString("Returns the elements of Array between Min and Max (inclusive), in their original order.");
+	TaskData.Category = "Math|Array";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Array", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Min", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Max", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.5f;
+}
+
+void UTask_FilterFloatArray::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	TArray<float> ReturnValue;
+	if (const TArray<float>* Array = ArrayPin.GetPtr())
+	{
+		OpenLogicArrayMath::Filter(*Array, MinPin.Get(), MaxPin.Get(), ReturnValue);
+	}
+
+	ReturnValuePin.Set(MoveTemp(ReturnValue));
+}
+
+void UTask_FilterFloatArray::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const TArray<float>* Array = Context.GetInputColumn<TArray<float>>(ArrayPin.GetHandle().PinIndex);
+	const float* Min = Context.GetInputColumn<float>(MinPin.GetHandle().PinIndex);
+	const float* Max = Context.GetInputColumn<float>(MaxPin.GetHandle().PinIndex);
+	TArray<float>* ReturnValue = Context.GetOutputColumn<TArray<float>>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Array || !Min || !Max || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context, [&](int32 Instance) { OpenLogicArrayMath::Filter(Array[Instance], Min[Instance], Max[Instance], ReturnValue[Instance]); });
+}
+
+UTask_SortFloatArray::UTask_SortFloatArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Sort (Float Array)";
+	TaskData.Description = FText::FromString("Returns the elements of Array in ascending order, or descending order if Descending is set.");
+	TaskData.Category = "Math|Array";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Array", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Descending", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicBoolean::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 1.0f;
+}
+
+void UTask_SortFloatArray::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	TArray<float> ReturnValue;
+	if (const TArray<float>* Array = ArrayPin.GetPtr())
+	{
+		OpenLogicArrayMath::Sort(*Array, DescendingPin.Get(), ReturnValue);
+	}
+
+	ReturnValuePin.Set(MoveTemp(ReturnValue));
+}
+
+void UTask_SortFloatArray::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const TArray<float>* Array = Context.GetInputColumn<TArray<float>>(ArrayPin.GetHandle().PinIndex);
+	const bool* Descending = Context.GetInputColumn<bool>(DescendingPin.GetHandle().PinIndex);
+	TArray<float>* ReturnValue = Context.GetOutputColumn<TArray<float>>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Array || !Descending || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context, [&](int32 Instance) { OpenLogicArrayMath::Sort(Array[Instance], Descending[Instance], ReturnValue[Instance]); });
+}
+
+UTask_DotProductArray::UTask_DotProductArray(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Dot Product (Vector Array)";
+	TaskData.Description = FText::FromString("Returns the dot product of each element of Array with B.");
+	TaskData.Category = "Math|Array";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Array", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVectorArray::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloatArray::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.5f;
+}
+
+void UTask_DotProductArray::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	TArray<float> ReturnValue;
+	if (const TArray<FVector>* Array = ArrayPin.GetPtr())
+	{
+		OpenLogicArrayMath::DotProduct(*Array, BPin.Get(), ReturnValue);
+	}
+
+	ReturnValuePin.Set(MoveTemp(ReturnValue));
+}
+
+void UTask_DotProductArray::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const TArray<FVector>* Array = Context.GetInputColumn<TArray<FVector>>(ArrayPin.GetHandle().PinIndex);
+	const FVector* B = Context.GetInputColumn<FVector>(BPin.GetHandle().PinIndex);
+	TArray<float>* ReturnValue = Context.GetOutputColumn<TArray<float>>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Array || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context, [&](int32 Instance) { OpenLogicArrayMath::DotProduct(Array[Instance], B[Instance], ReturnValue[Instance]); });
+}
@@ -0,0 +1,50 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_ClampFloat.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+
+UTask_ClampFloat::UTask_ClampFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Clamp (Float)";
+	TaskData.Description = FText::FromString("Returns Value clamped between Min and Max, inclusive.");
+	TaskData.Category = "Math|Float";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Min", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Max", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_ClampFloat::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(FMath::Clamp(ValuePin.Get(), MinPin.Get(), MaxPin.Get()));
+}
+
+void UTask_ClampFloat::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const float* Value = Context.GetInputColumn<float>(ValuePin.GetHandle().PinIndex);
+	const float* Min = Context.GetInputColumn<float>(MinPin.GetHandle().PinIndex);
+	const float* Max = Context.GetInputColumn<float>(MaxPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Value || !Min || !Max || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context,
+		[&](int32 Instance) { VectorStore(VectorMax(VectorMin(VectorLoad(Value + Instance), VectorLoad(Max + Instance)), VectorLoad(Min + Instance)), ReturnValue + Instance); },
+		[&](int32 Instance) { ReturnValue[Instance] = FMath::Clamp(Value[Instance], Min[Instance], Max[Instance]); });
+}
@@ -0,0 +1,99 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_FloatArithmetic.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+
+UTask_FloatOperator::UTask_FloatOperator(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Category = "Math|Float";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_FloatOperator::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(Evaluate(APin.Get(), BPin.Get()));
+}
+
+void UTask_FloatOperator::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const float* A = Context.GetInputColumn<float>(APin.GetHandle().PinIndex);
+	const float* B = Context.GetInputColumn<float>(BPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context,
+		[&](int32 Instance) { VectorStore(EvaluateVector(VectorLoad(A + Instance), VectorLoad(B + Instance)), ReturnValue + Instance); },
+		[&](int32 Instance) { ReturnValue[Instance] = Evaluate(A[Instance], B[Instance]); });
+}
+
+UTask_AddFloat::UTask_AddFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Add (Float)";
+	TaskData.Description = FText::FromString("Returns A + B.");
+}
+
+UTask_SubtractFloat::UTask_SubtractFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Subtract (Float)";
+	TaskData.Description = FText::FromString("Returns A - B.");
+}
+
+UTask_MultiplyFloat::UTask_MultiplyFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Multiply (Float)";
+	TaskData.Description = FText::FromString("Returns A * B.");
+}
+
+UTask_DivideFloat::UTask_DivideFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Divide (Float)";
+	TaskData.Description = FText::FromString("Returns A / B, or 0 if B is 0.");
+}
+
+float UTask_DivideFloat::Evaluate(float A, float B) const
+{
+	return B != 0.0f ? A / B : 0.0f;
+}
+
+VectorRegister4Float UTask_DivideFloat::EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const
+{
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	return VectorSelect(VectorCompareEQ(B, Zero), Zero, VectorDivide(A, B));
+}
+
+UTask_MinFloat::UTask_MinFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Min (Float)";
+	TaskData.Description = FText::FromString("Returns the smallest of A and B.");
+}
+
+UTask_MaxFloat::UTask_MaxFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Max (Float)";
+	TaskData.Description = FText::FromString("Returns the largest of A and B.");
+}
@@ -0,0 +1,82 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_FloatComparison.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicBoolean.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+
+UTask_FloatComparison::UTask_FloatComparison(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Category = "Math|Float";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicBoolean::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_FloatComparison::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(Evaluate(APin.Get(), BPin.Get()));
+}
+
+void UTask_FloatComparison::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const float* A = Context.GetInputColumn<float>(APin.GetHandle().PinIndex);
+	const float* B = Context.GetInputColumn<float>(BPin.GetHandle().PinIndex);
+	bool* ReturnValue = Context.GetOutputColumn<bool>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context,
+		[&](int32 Instance) { OpenLogicMath::StoreMask(EvaluateVector(VectorLoad(A + Instance), VectorLoad(B + Instance)), ReturnValue + Instance); },
+		[&](int32 Instance) { ReturnValue[Instance] = Evaluate(A[Instance], B[Instance]); });
+}
+
+UTask_LessFloat::UTask_LessFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Less (Float)";
+	TaskData.Description = FText::FromString("Returns true if A is less than B.");
+}
+
+UTask_LessEqualFloat::UTask_LessEqualFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Less Equal (Float)";
+	TaskData.Description = FText::FromString("Returns true if A is less than or equal to B.");
+}
+
+UTask_GreaterFloat::UTask_GreaterFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Greater (Float)";
+	TaskData.Description = FText::FromString("Returns true if A is greater than B.");
+}
+
+UTask_GreaterEqualFloat::UTask_GreaterEqualFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Greater Equal (Float)";
+	TaskData.Description = FText::FromString("Returns true if A is greater than or equal to B.");
+}
+
+UTask_EqualFloat::UTask_EqualFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Equal (Float)";
+	TaskData.Description = FText::FromString("Returns true if A is exactly equal to B.");
+}
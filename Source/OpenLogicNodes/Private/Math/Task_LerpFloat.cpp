@@ -0,0 +1,55 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_LerpFloat.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+
+UTask_LerpFloat::UTask_LerpFloat(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Lerp (Float)";
+	TaskData.Description = FText::FromString("Linearly interpolates between A and B based on Alpha (100% of A when Alpha=0 and 100% of B when Alpha=1).");
+	TaskData.Category = "Math|Float";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Alpha", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_LerpFloat::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(FMath::Lerp(APin.Get(), BPin.Get(), AlphaPin.Get()));
+}
+
+void UTask_LerpFloat::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const float* A = Context.GetInputColumn<float>(APin.GetHandle().PinIndex);
+	const float* B = Context.GetInputColumn<float>(BPin.GetHandle().PinIndex);
+	const float* Alpha = Context.GetInputColumn<float>(AlphaPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !Alpha || !ReturnValue)
+	{
+		return;
+	}
+
+	OpenLogicMath::ForEachInstance(Context,
+		[&](int32 Instance)
+		{
+			const VectorRegister4Float VectorA = VectorLoad(A + Instance);
+			const VectorRegister4Float Delta = VectorSubtract(VectorLoad(B + Instance), VectorA);
+			VectorStore(VectorMultiplyAdd(Delta, VectorLoad(Alpha + Instance), VectorA), ReturnValue + Instance);
+		},
+		[&](int32 Instance) { ReturnValue[Instance] = FMath::Lerp(A[Instance], B[Instance], Alpha[Instance]); });
+}
@@ -0,0 +1,139 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_TransformMath.h"
+#include "Runtime/OpenLogicBatchedGraph.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicTransform.h"
+#include "Classes/Properties/OpenLogicVector.h"
+
+// FTransform stores its rotation, translation and scale in VectorRegisters on platforms with SIMD support, so the
+// operators below are vectorized by the engine.
+
+UTask_ComposeTransforms::UTask_ComposeTransforms(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Compose Transforms";
+	TaskData.Description = FText::FromString("Returns the transform applying A, then B.");
+	TaskData.Category = "Math|Transform";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicTransform::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicTransform::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicTransform::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.2f;
+}
+
+void UTask_ComposeTransforms::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(APin.Get() * BPin.Get());
+}
+
+void UTask_ComposeTransforms::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FTransform* A = Context.GetInputColumn<FTransform>(APin.GetHandle().PinIndex);
+	const FTransform* B = Context.GetInputColumn<FTransform>(BPin.GetHandle().PinIndex);
+	FTransform* ReturnValue = Context.GetOutputColumn<FTransform>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		FTransform::Multiply(&ReturnValue[Instance], &A[Instance], &B[Instance]);
+	}
+}
+
+UTask_TransformLocation::UTask_TransformLocation(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Transform Location";
+	TaskData.Description = FText::FromString("Transforms Location from the local space of Transform to its parent space.");
+	TaskData.Category = "Math|Transform";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Transform", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicTransform::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Location", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_TransformLocation::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(TransformPin.Get().TransformPosition(LocationPin.Get()));
+}
+
+void UTask_TransformLocation::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FTransform* Transform = Context.GetInputColumn<FTransform>(TransformPin.GetHandle().PinIndex);
+	const FVector* Location = Context.GetInputColumn<FVector>(LocationPin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Transform || !Location || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		ReturnValue[Instance] = Transform[Instance].TransformPosition(Location[Instance]);
+	}
+}
+
+UTask_InverseTransformLocation::UTask_InverseTransformLocation(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Inverse Transform Location";
+	TaskData.Description = FText::FromString("Transforms Location from the parent space of Transform to its local space.");
+	TaskData.Category = "Math|Transform";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Transform", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicTransform::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Location", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_InverseTransformLocation::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(TransformPin.Get().InverseTransformPosition(LocationPin.Get()));
+}
+
+void UTask_InverseTransformLocation::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FTransform* Transform = Context.GetInputColumn<FTransform>(TransformPin.GetHandle().PinIndex);
+	const FVector* Location = Context.GetInputColumn<FVector>(LocationPin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Transform || !Location || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		ReturnValue[Instance] = Transform[Instance].InverseTransformPosition(Location[Instance]);
+	}
+}
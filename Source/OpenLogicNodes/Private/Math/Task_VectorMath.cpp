@@ -0,0 +1,290 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Math/Task_VectorMath.h"
+#include "Math/OpenLogicMathHelpers.h"
+#include "NodeLibraryTags.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+#include "Classes/Properties/OpenLogicVector.h"
+
+UTask_VectorOperator::UTask_VectorOperator(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_VectorOperator::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	FVector ReturnValue;
+	OpenLogicMath::StoreVector(EvaluateVector(OpenLogicMath::LoadVector(APin.Get()), OpenLogicMath::LoadVector(BPin.Get())), ReturnValue);
+	ReturnValuePin.Set(ReturnValue);
+}
+
+void UTask_VectorOperator::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* A = Context.GetInputColumn<FVector>(APin.GetHandle().PinIndex);
+	const FVector* B = Context.GetInputColumn<FVector>(BPin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		OpenLogicMath::StoreVector(EvaluateVector(OpenLogicMath::LoadVector(A[Instance]), OpenLogicMath::LoadVector(B[Instance])), ReturnValue[Instance]);
+	}
+}
+
+UTask_AddVector::UTask_AddVector(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Add (Vector)";
+	TaskData.Description = FText::FromString("Returns A + B, component-wise.");
+}
+
+UTask_SubtractVector::UTask_SubtractVector(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Subtract (Vector)";
+	TaskData.Description = FText::FromString("Returns A - B, component-wise.");
+}
+
+UTask_CrossProduct::UTask_CrossProduct(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Cross Product";
+	TaskData.Description = FText::FromString("Returns the cross product of A and B.");
+}
+
+UTask_ScaleVector::UTask_ScaleVector(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Scale (Vector)";
+	TaskData.Description = FText::FromString("Returns Vector multiplied by Scale.");
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Vector", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Scale", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_ScaleVector::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(VectorPin.Get() * ScalePin.Get());
+}
+
+void UTask_ScaleVector::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* Vector = Context.GetInputColumn<FVector>(VectorPin.GetHandle().PinIndex);
+	const float* Scale = Context.GetInputColumn<float>(ScalePin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Vector || !Scale || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		const VectorRegister ScaleRegister = VectorSetFloat1(static_cast<FVector::FReal>(Scale[Instance]));
+		OpenLogicMath::StoreVector(VectorMultiply(OpenLogicMath::LoadVector(Vector[Instance]), ScaleRegister), ReturnValue[Instance]);
+	}
+}
+
+UTask_LerpVector::UTask_LerpVector(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Lerp (Vector)";
+	TaskData.Description = FText::FromString("Linearly interpolates between A and B based on Alpha (100% of A when Alpha=0 and 100% of B when Alpha=1).");
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("Alpha", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_LerpVector::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(FMath::Lerp(APin.Get(), BPin.Get(), static_cast<FVector::FReal>(AlphaPin.Get())));
+}
+
+void UTask_LerpVector::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* A = Context.GetInputColumn<FVector>(APin.GetHandle().PinIndex);
+	const FVector* B = Context.GetInputColumn<FVector>(BPin.GetHandle().PinIndex);
+	const float* Alpha = Context.GetInputColumn<float>(AlphaPin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !Alpha || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		const VectorRegister VectorA = OpenLogicMath::LoadVector(A[Instance]);
+		const VectorRegister Delta = VectorSubtract(OpenLogicMath::LoadVector(B[Instance]), VectorA);
+		const VectorRegister AlphaRegister = VectorSetFloat1(static_cast<FVector::FReal>(Alpha[Instance]));
+		OpenLogicMath::StoreVector(VectorMultiplyAdd(Delta, AlphaRegister, VectorA), ReturnValue[Instance]);
+	}
+}
+
+UTask_DotProduct::UTask_DotProduct(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Dot Product";
+	TaskData.Description = FText::FromString("Returns the dot product of A and B.");
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("A", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+	TaskData.InputPins.Add(FOpenLogicPinData("B", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_DotProduct::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(static_cast<float>(FVector::DotProduct(APin.Get(), BPin.Get())));
+}
+
+void UTask_DotProduct::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* A = Context.GetInputColumn<FVector>(APin.GetHandle().PinIndex);
+	const FVector* B = Context.GetInputColumn<FVector>(BPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!A || !B || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		FVector::FReal Dot;
+		VectorStoreFloat1(VectorDot3(OpenLogicMath::LoadVector(A[Instance]), OpenLogicMath::LoadVector(B[Instance])), &Dot);
+		ReturnValue[Instance] = static_cast<float>(Dot);
+	}
+}
+
+UTask_VectorLength::UTask_VectorLength(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Vector Length";
+	TaskData.Description = FText::FromString("Returns the length of Vector.");
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Vector", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicFloat::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_VectorLength::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(static_cast<float>(VectorPin.Get().Size()));
+}
+
+void UTask_VectorLength::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* Vector = Context.GetInputColumn<FVector>(VectorPin.GetHandle().PinIndex);
+	float* ReturnValue = Context.GetOutputColumn<float>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Vector || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		ReturnValue[Instance] = static_cast<float>(Vector[Instance].Size());
+	}
+}
+
+UTask_NormalizeVector::UTask_NormalizeVector(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	TaskData.Name = "Normalize (Vector)";
+	TaskData.Description = FText::FromString("Returns Vector scaled to a length of 1, or a zero vector if it is too small to be normalized.");
+	TaskData.Category = "Math|Vector";
+	TaskData.Library = FGameplayTagContainer(TAG_OpenLogicMathLibrary);
+
+	// Input pins
+	TaskData.InputPins.Add(FOpenLogicPinData("Vector", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	// Output pins
+	TaskData.OutputPins.Add(FOpenLogicPinData("Return Value", FText::GetEmpty(), EPinRole::DataProperty, UOpenLogicVector::StaticClass()));
+
+	ReevaluateOnDemand = true;
+	bIsThreadSafe = true;
+	bSupportsBatchedExecution = true;
+	EstimatedCost = 0.1f;
+}
+
+void UTask_NormalizeVector::OnTaskActivated_Implementation(UObject* Context, FName PinName)
+{
+	ReturnValuePin.Set(VectorPin.Get().GetSafeNormal());
+}
+
+void UTask_NormalizeVector::OnTaskActivatedBatch(FOpenLogicBatchContext& Context)
+{
+	const FVector* Vector = Context.GetInputColumn<FVector>(VectorPin.GetHandle().PinIndex);
+	FVector* ReturnValue = Context.GetOutputColumn<FVector>(ReturnValuePin.GetHandle().PinIndex);
+
+	if (!Vector || !ReturnValue)
+	{
+		return;
+	}
+
+	for (const int32 Instance : Context.GetInstances())
+	{
+		ReturnValue[Instance] = Vector[Instance].GetSafeNormal();
+	}
+}
@@ -6,4 +6,5 @@ UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicDefaultLibrary, "OpenLogicDefaultLib
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicEventLibrary, "OpenLogicDefaultLibrary.Event", "Parent tag for event nodes in OpenLogic.");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicFlowControlLibrary, "OpenLogicDefaultLibrary.FlowControl", "Parent tag for flow control nodes in OpenLogic.");
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicUtilityLibrary, "OpenLogicDefaultLibrary.Utility", "Parent tag for utility nodes in OpenLogic.");
-UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicLiteralLibrary, "OpenLogicDefaultLibrary.Literal", "Parent tag for literal nodes in OpenLogic.");
\ No newline at end of file
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicLiteralLibrary, "OpenLogicDefaultLibrary.Literal", "Parent tag for literal nodes in OpenLogic.");
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicMathLibrary, "OpenLogicDefaultLibrary.Math", "Parent tag for math nodes in OpenLogic.");
\ No newline at end of file
@@ -22,7 +22,7 @@ UTask_LogString::UTask_LogString(const FObjectInitializer& ObjectInitializer)
 
 void UTask_LogString::OnTaskActivated_Implementation(UObject* Context, FName PinName)
 {
-	FString StringValue = GetPropertyValueByAttribute<FString>(FName("In String"));
+	const FString StringValue = InStringPin.Get();
 	UE_LOG(LogTemp, Log, TEXT("Log String: %s"), *StringValue);
 
 	CompleteTask("then");
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_Branch.generated.h"
 
 UCLASS()
@@ -14,4 +14,8 @@ public:
 	UTask_Branch(const FObjectInitializer& ObjectInitializer);
 
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<bool> ConditionPin { this, "Condition" };
 };
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_Delay.generated.h"
 
 UCLASS()
@@ -15,7 +15,21 @@ public:
 
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 
+	// Saves the time left on the pending delay, and starts it again when loaded.
+	virtual void SerializeTaskState(FArchive& Ar) override;
+
+	// Moves on to a new latent action identifier, see DelayUUID.
+	virtual void OnTaskCompleted_Implementation() override;
+
 protected:
+	TOpenLogicInput<float> DurationPin { this, "Duration" };
+
+	// Identifies the pending delay. Removed latent actions are only deleted on the next latent update, a pooled instance
+	// activated again in between must not mistake the delay of its previous activation for its own.
+	int32 DelayUUID = 0;
+
 	UFUNCTION()
 		void OnDelayCompleted();
+
+	void StartDelay(float Duration);
 };
\ No newline at end of file
@@ -15,7 +15,18 @@ public:
 
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 
+	// Saves whether the task is waiting for the next tick, and waits again when loaded.
+	virtual void SerializeTaskState(FArchive& Ar) override;
+
+	// Moves on to a new latent action identifier, see DelayUUID.
+	virtual void OnTaskCompleted_Implementation() override;
+
 protected:
+	// Identifies the pending delay, changed on completion like UTask_Delay::DelayUUID.
+	int32 DelayUUID = 0;
+
 	UFUNCTION()
 		void OnDelayCompleted();
+
+	void StartDelay();
 };
\ No newline at end of file
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_DoN.generated.h"
 
 UCLASS()
@@ -16,6 +16,9 @@ public:
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 
 protected:
-	UPROPERTY()
+	TOpenLogicInput<int32> NPin { this, "N" };
+	TOpenLogicOutput<int32> CounterPin { this, "Counter" };
+
+	UPROPERTY(SaveGame)
 		int32 Counter = 0;
 };
\ No newline at end of file
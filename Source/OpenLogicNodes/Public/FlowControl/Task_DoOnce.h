@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_DoOnce.generated.h"
 
 UCLASS()
@@ -16,9 +16,11 @@ public:
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 
 protected:
-	UPROPERTY()
+	TOpenLogicInput<bool> StartClosedPin { this, "Start Closed" };
+
+	UPROPERTY(SaveGame)
 		bool bFirstEntrance = true;
 
-	UPROPERTY()
+	UPROPERTY(SaveGame)
 		bool bIsClosed = false;
 };
\ No newline at end of file
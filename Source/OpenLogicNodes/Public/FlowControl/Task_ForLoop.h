@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_ForLoop.generated.h"
 
 UCLASS()
@@ -14,4 +14,9 @@ public:
 	UTask_ForLoop(const FObjectInitializer& ObjectInitializer);
 
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+
+protected:
+	TOpenLogicInput<int32> FirstIndexPin { this, "First Index" };
+	TOpenLogicInput<int32> LastIndexPin { this, "Last Index" };
+	TOpenLogicOutput<int32> IndexPin { this, "Index" };
 };
\ No newline at end of file
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_ForLoopWithBreak.generated.h"
 
 UCLASS()
@@ -16,6 +16,10 @@ public:
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 
 protected:
+	TOpenLogicInput<int32> FirstIndexPin { this, "First Index" };
+	TOpenLogicInput<int32> LastIndexPin { this, "Last Index" };
+	TOpenLogicOutput<int32> IndexPin { this, "Index" };
+
 	UPROPERTY()
 		bool bBreak = false;
 };
\ No newline at end of file
@@ -0,0 +1,22 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicStructTask.h"
+#include "Task_MakeLiteral.generated.h"
+
+/**
+ * Base class of the literal nodes, which return the value of their Value pin. Literals are struct tasks, they run
+ * without a task instance.
+ */
+UCLASS(Abstract)
+class OPENLOGICNODES_API UTask_MakeLiteral : public UOpenLogicStructTask
+{
+	GENERATED_BODY()
+public:
+	UTask_MakeLiteral(const FObjectInitializer& ObjectInitializer);
+
+private:
+	static void Activate(FOpenLogicStructTaskContext& Context);
+};
@@ -3,15 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Literal/Task_MakeLiteral.h"
 #include "Task_MakeLiteralByte.generated.h"
 
 UCLASS()
-class OPENLOGICNODES_API UTask_MakeLiteralByte : public UOpenLogicTask
+class OPENLOGICNODES_API UTask_MakeLiteralByte : public UTask_MakeLiteral
 {
 	GENERATED_BODY()
 public:
 	UTask_MakeLiteralByte(const FObjectInitializer& ObjectInitializer);
-
-	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 };
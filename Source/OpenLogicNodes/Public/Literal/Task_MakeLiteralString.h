@@ -3,15 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Literal/Task_MakeLiteral.h"
 #include "Task_MakeLiteralString.generated.h"
 
 UCLASS()
-class OPENLOGICNODES_API UTask_MakeLiteralString : public UOpenLogicTask
+class OPENLOGICNODES_API UTask_MakeLiteralString : public UTask_MakeLiteral
 {
 	GENERATED_BODY()
 public:
 	UTask_MakeLiteralString(const FObjectInitializer& ObjectInitializer);
-
-	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
 };
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/OpenLogicBatchedGraph.h"
+
+namespace OpenLogicMath
+{
+	// The number of floats processed by one VectorRegister4Float.
+	constexpr int32 VectorWidth = 4;
+
+	/**
+	 * Runs the activated instances of a batched math node. When every instance is activated, the columns are walked
+	 * linearly and VectorFunc is called with the first of each group of VectorWidth instances, ScalarFunc handling
+	 * the remainder. Otherwise ScalarFunc is called for each activated instance.
+	 */
+	template <typename VectorFuncType, typename ScalarFuncType>
+	void ForEachInstance(const FOpenLogicBatchContext& Context, VectorFuncType&& VectorFunc, ScalarFuncType&& ScalarFunc)
+	{
+		if (!Context.IsFullBatch())
+		{
+			for (const int32 Instance : Context.GetInstances())
+			{
+				ScalarFunc(Instance);
+			}
+			return;
+		}
+
+		const int32 InstanceCount = Context.GetInstanceCount();
+
+		int32 Instance = 0;
+		for (; Instance + VectorWidth <= InstanceCount; Instance += VectorWidth)
+		{
+			VectorFunc(Instance);
+		}
+
+		for (; Instance < InstanceCount; Instance++)
+		{
+			ScalarFunc(Instance);
+		}
+	}
+
+	/**
+	 * Runs ScalarFunc for each activated instance, for nodes that vectorize within the value of an instance rather
+	 * than across instances, such as the array nodes.
+	 */
+	template <typename ScalarFuncType>
+	void ForEachInstance(const FOpenLogicBatchContext& Context, ScalarFuncType&& ScalarFunc)
+	{
+		ForEachInstance(Context,
+			[&ScalarFunc](int32 FirstInstance)
+			{
+				for (int32 Instance = FirstInstance; Instance < FirstInstance + VectorWidth; Instance++)
+				{
+					ScalarFunc(Instance);
+				}
+			},
+			ScalarFunc);
+	}
+
+	// Returns the sum of Count floats, added four at a time.
+	inline float SumFloats(const float* Values, int32 Count)
+	{
+		VectorRegister4Float Sum = VectorZeroFloat();
+
+		int32 Index = 0;
+		for (; Index + VectorWidth <= Count; Index += VectorWidth)
+		{
+			Sum = VectorAdd(Sum, VectorLoad(Values + Index));
+		}
+
+		float Lanes[VectorWidth];
+		VectorStore(Sum, Lanes);
+
+		float Result = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		for (; Index < Count; Index++)
+		{
+			Result += Values[Index];
+		}
+
+		return Result;
+	}
+
+	// Returns the smallest or largest of Count floats, compared four at a time. 0 if Count is 0.
+	template <bool bMax>
+	float ReduceFloats(const float* Values, int32 Count)
+	{
+		if (Count <= 0)
+		{
+			return 0.0f;
+		}
+
+		VectorRegister4Float Extreme = VectorSetFloat1(Values[0]);
+
+		int32 Index = 0;
+		for (; Index + VectorWidth <= Count; Index += VectorWidth)
+		{
+			const VectorRegister4Float Group = VectorLoad(Values + Index);
+			Extreme = bMax ? VectorMax(Extreme, Group) : VectorMin(Extreme, Group);
+		}
+
+		float Lanes[VectorWidth];
+		VectorStore(Extreme, Lanes);
+
+		float Result = Lanes[0];
+		for (int32 Lane = 1; Lane < VectorWidth; Lane++)
+		{
+			Result = bMax ? FMath::Max(Result, Lanes[Lane]) : FMath::Min(Result, Lanes[Lane]);
+		}
+
+		for (; Index < Count; Index++)
+		{
+			Result = bMax ? FMath::Max(Result, Values[Index]) : FMath::Min(Result, Values[Index]);
+		}
+
+		return Result;
+	}
+
+	// Stores four comparison results from a VectorCompare* mask as bools.
+	FORCEINLINE void StoreMask(const VectorRegister4Float& Mask, bool* Dest)
+	{
+		const int32 Bits = VectorMaskBits(Mask);
+		Dest[0] = (Bits & 1) != 0;
+		Dest[1] = (Bits & 2) != 0;
+		Dest[2] = (Bits & 4) != 0;
+		Dest[3] = (Bits & 8) != 0;
+	}
+
+	FORCEINLINE VectorRegister LoadVector(const FVector& Vector)
+	{
+		return VectorLoadFloat3(&Vector.X);
+	}
+
+	FORCEINLINE void StoreVector(const VectorRegister& Register, FVector& Vector)
+	{
+		VectorStoreFloat3(Register, &Vector.X);
+	}
+}
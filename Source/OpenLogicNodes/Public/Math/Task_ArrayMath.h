@@ -0,0 +1,112 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_ArrayMath.generated.h"
+
+/**
+ * Base class of the pure float array reductions, which take an array and return a float. The elements are processed
+ * four at a time, one instance after the other in batched graphs.
+ */
+UCLASS(Abstract)
+class OPENLOGICNODES_API UTask_FloatArrayReduction : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_FloatArrayReduction(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	virtual float Reduce(const TArray<float>& Array) const { return 0.0f; }
+
+	TOpenLogicInput<TArray<float>> ArrayPin { this, "Array" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_SumFloatArray : public UTask_FloatArrayReduction
+{
+	GENERATED_BODY()
+public:
+	UTask_SumFloatArray(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Reduce(const TArray<float>& Array) const override;
+};
+
+// Returns 0 for an empty array.
+UCLASS()
+class OPENLOGICNODES_API UTask_MinFloatArray : public UTask_FloatArrayReduction
+{
+	GENERATED_BODY()
+public:
+	UTask_MinFloatArray(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Reduce(const TArray<float>& Array) const override;
+};
+
+// Returns 0 for an empty array.
+UCLASS()
+class OPENLOGICNODES_API UTask_MaxFloatArray : public UTask_FloatArrayReduction
+{
+	GENERATED_BODY()
+public:
+	UTask_MaxFloatArray(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Reduce(const TArray<float>& Array) const override;
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_FilterFloatArray : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_FilterFloatArray(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<TArray<float>> ArrayPin { this, "Array" };
+	TOpenLogicInput<float> MinPin { this, "Min" };
+	TOpenLogicInput<float> MaxPin { this, "Max" };
+	TOpenLogicOutput<TArray<float>> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_SortFloatArray : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_SortFloatArray(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<TArray<float>> ArrayPin { this, "Array" };
+	TOpenLogicInput<bool> DescendingPin { this, "Descending" };
+	TOpenLogicOutput<TArray<float>> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_DotProductArray : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_DotProductArray(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<TArray<FVector>> ArrayPin { this, "Array" };
+	TOpenLogicInput<FVector> BPin { this, "B" };
+	TOpenLogicOutput<TArray<float>> ReturnValuePin { this, "Return Value" };
+};
@@ -0,0 +1,24 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_ClampFloat.generated.h"
+
+UCLASS()
+class OPENLOGICNODES_API UTask_ClampFloat : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_ClampFloat(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<float> ValuePin { this, "Value" };
+	TOpenLogicInput<float> MinPin { this, "Min" };
+	TOpenLogicInput<float> MaxPin { this, "Max" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
@@ -0,0 +1,103 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_FloatArithmetic.generated.h"
+
+/**
+ * Base class of the pure float operators, which take A and B and return a float. In batched graphs the operator
+ * runs on four instances at once.
+ */
+UCLASS(Abstract)
+class OPENLOGICNODES_API UTask_FloatOperator : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_FloatOperator(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	virtual float Evaluate(float A, float B) const { return 0.0f; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const { return VectorZeroFloat(); }
+
+	TOpenLogicInput<float> APin { this, "A" };
+	TOpenLogicInput<float> BPin { this, "B" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_AddFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_AddFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override { return A + B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorAdd(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_SubtractFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_SubtractFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override { return A - B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorSubtract(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_MultiplyFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_MultiplyFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override { return A * B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorMultiply(A, B); }
+};
+
+// Returns 0 when B is 0, like the Blueprint divide node.
+UCLASS()
+class OPENLOGICNODES_API UTask_DivideFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_DivideFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override;
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override;
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_MinFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_MinFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override { return FMath::Min(A, B); }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorMin(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_MaxFloat : public UTask_FloatOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_MaxFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual float Evaluate(float A, float B) const override { return FMath::Max(A, B); }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorMax(A, B); }
+};
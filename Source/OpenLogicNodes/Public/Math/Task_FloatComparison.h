@@ -0,0 +1,92 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_FloatComparison.generated.h"
+
+/**
+ * Base class of the pure float comparisons, which compare A to B. In batched graphs four instances are compared at
+ * once.
+ */
+UCLASS(Abstract)
+class OPENLOGICNODES_API UTask_FloatComparison : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_FloatComparison(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	virtual bool Evaluate(float A, float B) const { return false; }
+
+	// Returns a mask with the lanes where the comparison is true set.
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const { return VectorZeroFloat(); }
+
+	TOpenLogicInput<float> APin { this, "A" };
+	TOpenLogicInput<float> BPin { this, "B" };
+	TOpenLogicOutput<bool> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_LessFloat : public UTask_FloatComparison
+{
+	GENERATED_BODY()
+public:
+	UTask_LessFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual bool Evaluate(float A, float B) const override { return A < B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorCompareLT(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_LessEqualFloat : public UTask_FloatComparison
+{
+	GENERATED_BODY()
+public:
+	UTask_LessEqualFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual bool Evaluate(float A, float B) const override { return A <= B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorCompareLE(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_GreaterFloat : public UTask_FloatComparison
+{
+	GENERATED_BODY()
+public:
+	UTask_GreaterFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual bool Evaluate(float A, float B) const override { return A > B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorCompareGT(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_GreaterEqualFloat : public UTask_FloatComparison
+{
+	GENERATED_BODY()
+public:
+	UTask_GreaterEqualFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual bool Evaluate(float A, float B) const override { return A >= B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorCompareGE(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_EqualFloat : public UTask_FloatComparison
+{
+	GENERATED_BODY()
+public:
+	UTask_EqualFloat(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual bool Evaluate(float A, float B) const override { return A == B; }
+	virtual VectorRegister4Float EvaluateVector(const VectorRegister4Float& A, const VectorRegister4Float& B) const override { return VectorCompareEQ(A, B); }
+};
@@ -0,0 +1,24 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_LerpFloat.generated.h"
+
+UCLASS()
+class OPENLOGICNODES_API UTask_LerpFloat : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_LerpFloat(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<float> APin { this, "A" };
+	TOpenLogicInput<float> BPin { this, "B" };
+	TOpenLogicInput<float> AlphaPin { this, "Alpha" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
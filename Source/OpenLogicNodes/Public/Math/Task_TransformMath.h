@@ -0,0 +1,55 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_TransformMath.generated.h"
+
+UCLASS()
+class OPENLOGICNODES_API UTask_ComposeTransforms : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_ComposeTransforms(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FTransform> APin { this, "A" };
+	TOpenLogicInput<FTransform> BPin { this, "B" };
+	TOpenLogicOutput<FTransform> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_TransformLocation : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_TransformLocation(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FTransform> TransformPin { this, "Transform" };
+	TOpenLogicInput<FVector> LocationPin { this, "Location" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_InverseTransformLocation : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_InverseTransformLocation(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FTransform> TransformPin { this, "Transform" };
+	TOpenLogicInput<FVector> LocationPin { this, "Location" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
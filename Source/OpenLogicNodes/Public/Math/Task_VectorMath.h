@@ -0,0 +1,141 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "Task_VectorMath.generated.h"
+
+/**
+ * Base class of the pure vector operators, which take A and B and return a vector. Each vector is processed in a
+ * single VectorRegister.
+ */
+UCLASS(Abstract)
+class OPENLOGICNODES_API UTask_VectorOperator : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_VectorOperator(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	virtual VectorRegister EvaluateVector(const VectorRegister& A, const VectorRegister& B) const { return VectorZero(); }
+
+	TOpenLogicInput<FVector> APin { this, "A" };
+	TOpenLogicInput<FVector> BPin { this, "B" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_AddVector : public UTask_VectorOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_AddVector(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual VectorRegister EvaluateVector(const VectorRegister& A, const VectorRegister& B) const override { return VectorAdd(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_SubtractVector : public UTask_VectorOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_SubtractVector(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual VectorRegister EvaluateVector(const VectorRegister& A, const VectorRegister& B) const override { return VectorSubtract(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_CrossProduct : public UTask_VectorOperator
+{
+	GENERATED_BODY()
+public:
+	UTask_CrossProduct(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual VectorRegister EvaluateVector(const VectorRegister& A, const VectorRegister& B) const override { return VectorCross(A, B); }
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_ScaleVector : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_ScaleVector(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FVector> VectorPin { this, "Vector" };
+	TOpenLogicInput<float> ScalePin { this, "Scale" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_LerpVector : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_LerpVector(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FVector> APin { this, "A" };
+	TOpenLogicInput<FVector> BPin { this, "B" };
+	TOpenLogicInput<float> AlphaPin { this, "Alpha" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_DotProduct : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_DotProduct(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FVector> APin { this, "A" };
+	TOpenLogicInput<FVector> BPin { this, "B" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_VectorLength : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_VectorLength(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FVector> VectorPin { this, "Vector" };
+	TOpenLogicOutput<float> ReturnValuePin { this, "Return Value" };
+};
+
+UCLASS()
+class OPENLOGICNODES_API UTask_NormalizeVector : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UTask_NormalizeVector(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) override;
+
+protected:
+	TOpenLogicInput<FVector> VectorPin { this, "Vector" };
+	TOpenLogicOutput<FVector> ReturnValuePin { this, "Return Value" };
+};
@@ -9,4 +9,5 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicDefaultLibrary)
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicEventLibrary)
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicFlowControlLibrary)
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicUtilityLibrary)
-UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicLiteralLibrary)
\ No newline at end of file
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicLiteralLibrary)
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_OpenLogicMathLibrary)
\ No newline at end of file
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Task_LogString.generated.h"
 
 UCLASS()
@@ -14,4 +14,7 @@ public:
 	UTask_LogString(const FObjectInitializer& ObjectInitializer);
 
 	virtual void OnTaskActivated_Implementation(UObject* Context, FName PinName) override;
+
+protected:
+	TOpenLogicInput<FString> InStringPin { this, "In String" };
 };
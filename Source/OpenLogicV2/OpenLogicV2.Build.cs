@@ -30,7 +30,9 @@ public class OpenLogicV2 : ModuleRules
                 "DeveloperSettings",
                 "GameplayTags",
 				"JsonUtilities",
-                "Json"
+                "Json",
+				"TraceLog",
+				"NetCore"
 			}
 		);
 			
@@ -54,9 +56,10 @@ public class OpenLogicV2 : ModuleRules
 			PrivateDependencyModuleNames.Add("PropertyEditor");
         }
 		
+		// FInstancedStruct is part of the runtime node, so it is exposed through the public headers
 		if (Target.Version.MajorVersion < 5 || (Target.Version.MajorVersion == 5 && Target.Version.MinorVersion < 5))
 		{
-			PrivateDependencyModuleNames.Add("StructUtils");
+			PublicDependencyModuleNames.Add("StructUtils");
 		}
 
         DynamicallyLoadedModuleNames.AddRange(
@@ -0,0 +1,9 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Classes/Properties/OpenLogicFloatArray.h"
+
+UOpenLogicFloatArray::UOpenLogicFloatArray()
+{
+	PropertyDisplayName = FText::FromString("Float Array");
+	PropertyColor = FLinearColor(0.03, 0.63, 0.0, 1.0);
+}
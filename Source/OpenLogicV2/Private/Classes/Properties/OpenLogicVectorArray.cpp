@@ -0,0 +1,9 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Classes/Properties/OpenLogicVectorArray.h"
+
+UOpenLogicVectorArray::UOpenLogicVectorArray()
+{
+	PropertyDisplayName = FText::FromString("Vector Array");
+	PropertyColor = FLinearColor(0.87, 0.52, 0.0, 1.0);
+}
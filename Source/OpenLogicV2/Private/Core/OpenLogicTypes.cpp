@@ -6,6 +6,9 @@
 #include "Tasks/OpenLogicTask.h"
 #include "Utility/PayloadObject.h"
 #include "Widgets/ExecutionPinBase.h"
+#include "Profiling/OpenLogicTrace.h"
+#include "Profiling/OpenLogicMemory.h"
+#include "Profiling/OpenLogicStats.h"
 
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(TAG_OpenLogicUserLibrary, "OpenLogicUserLibrary", "Parent tag for user-defined node libraries in OpenLogic.");
 
@@ -90,18 +93,41 @@ TArray<FName> FOpenLogicPinData::GetRelevantPropertyAttributes() const
 	return RelevantAttributes;
 }
 
+uint32 FTaskData::GetPinSchemaHash() const
+{
+	uint32 Hash = 0;
+
+	// Pin names are hashed as text, FName hashes are not stable between sessions
+	auto HashPins = [&Hash](const TArray<FOpenLogicPinData>& Pins)
+	{
+		Hash = HashCombine(Hash, static_cast<uint32>(Pins.Num()));
+
+		for (const FOpenLogicPinData& PinData : Pins)
+		{
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*PinData.PinName.ToString().ToLower()));
+			Hash = HashCombine(Hash, static_cast<uint32>(PinData.Role));
+		}
+	};
+
+	HashPins(InputPins);
+	HashPins(OutputPins);
+
+	// 0 is the hash of handles that were not baked
+	return Hash != 0 ? Hash : 1;
+}
+
 FOpenLogicPinData FOpenLogicNode::GetPinData(int32 PinIndex, bool bIsInput) const
 {
-	TMap<int32, FOpenLogicPinState> Pins = bIsInput ? InputPins : OutputPins;
-	if (!Pins.Contains(PinIndex))
+	const TMap<int32, FOpenLogicPinState>& Pins = bIsInput ? InputPins : OutputPins;
+	const FOpenLogicPinState* PinState = Pins.Find(PinIndex);
+	if (!PinState)
 	{
 		return FOpenLogicPinData();
 	}
 
-	const FOpenLogicPinState& PinState = Pins[PinIndex];
-	if (PinState.IsUserCreated)
+	if (PinState->IsUserCreated)
 	{
-		return PinState.PinData;
+		return PinState->PinData;
 	}
 	
 	UClass* Class = TaskClass.LoadSynchronous();
@@ -122,7 +148,7 @@ FOpenLogicPinData FOpenLogicNode::GetPinData(int32 PinIndex, bool bIsInput) cons
 
 int32 FOpenLogicNode::GetPinIndexFromName(const FName& PinName, bool bIsInput) const
 {
-	const TMap<int32, FOpenLogicPinState> Pins = bIsInput ? InputPins : OutputPins;
+	const TMap<int32, FOpenLogicPinState>& Pins = bIsInput ? InputPins : OutputPins;
 
 	for (const auto& PinPair : Pins)
 	{
@@ -304,14 +330,19 @@ void FOpenLogicGraphData::Migration_BlueprintContentSerialization()
 
 UOpenLogicTask* FOpenLogicTaskPool::GetTaskInstance(TSubclassOf<UOpenLogicTask> TaskClass, UObject* Outer)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_TaskPool);
+
 	UOpenLogicTask* TaskInstance;
 
+	OPENLOGIC_TRACE_POOL_ACCESS(TaskClass.Get(), AvailableTasks.Num() > 0, AvailableTasks.Num());
+
 	// Check if there are any available tasks
 	if (AvailableTasks.Num() > 0)
 	{
 		// Get the first available task
 		TaskInstance = *AvailableTasks.CreateIterator();
 		AvailableTasks.Remove(TaskInstance);
+		OPENLOGIC_COUNTER_DEC(PooledTasksAvailable, 1);
 	} else
 	{
 		// Create a new task instance if none are available
@@ -329,20 +360,104 @@ UOpenLogicTask* FOpenLogicTaskPool::GetTaskInstance(TSubclassOf<UOpenLogicTask>
 	
 	// Add the task instance to the active tasks
 	ActiveTasks.Add(TaskInstance);
+	OPENLOGIC_COUNTER_INC(PooledTasksActive, 1);
 
 	return TaskInstance;
 }
 
-void FOpenLogicTaskPool::ReturnTaskInstance(UOpenLogicTask* TaskInstance)
+void FOpenLogicTaskPool::ReturnTaskInstance(UOpenLogicTask* TaskInstance, int32 MaxAvailableTasks)
 {
 	if (!TaskInstance && !ActiveTasks.Contains(TaskInstance))
 	{
 		return;
 	}
 
-	ActiveTasks.Remove(TaskInstance);
+	if (ActiveTasks.Remove(TaskInstance) > 0)
+	{
+		OPENLOGIC_COUNTER_DEC(PooledTasksActive, 1);
+	}
+
 	TaskInstance->ResetTaskState();
+
+	// Dropping the reference is enough, nothing else keeps a pooled instance alive
+	if (MaxAvailableTasks > 0 && AvailableTasks.Num() >= MaxAvailableTasks)
+	{
+		return;
+	}
+
 	AvailableTasks.Add(TaskInstance);
+	OPENLOGIC_COUNTER_INC(PooledTasksAvailable, 1);
+}
+
+int32 FOpenLogicTaskPool::Trim(int32 MaxAvailableTasks)
+{
+	const int32 ReleasedCount = FMath::Max(AvailableTasks.Num() - FMath::Max(MaxAvailableTasks, 0), 0);
+	if (ReleasedCount == 0)
+	{
+		return 0;
+	}
+
+	int32 RemainingCount = ReleasedCount;
+	for (auto It = AvailableTasks.CreateIterator(); It && RemainingCount > 0; ++It, RemainingCount--)
+	{
+		It.RemoveCurrent();
+	}
+
+	AvailableTasks.Compact();
+	OPENLOGIC_COUNTER_DEC(PooledTasksAvailable, ReleasedCount);
+
+	return ReleasedCount;
+}
+
+FOpenLogicCancellationToken FOpenLogicCancellationToken::Create()
+{
+	FOpenLogicCancellationToken Token;
+	Token.State = MakeShared<std::atomic<EOpenLogicCancellationReason>, ESPMode::ThreadSafe>(EOpenLogicCancellationReason::None);
+	return Token;
+}
+
+bool FOpenLogicCancellationToken::Cancel(EOpenLogicCancellationReason Reason) const
+{
+	if (!State.IsValid() || Reason == EOpenLogicCancellationReason::None)
+	{
+		return false;
+	}
+
+	EOpenLogicCancellationReason Expected = EOpenLogicCancellationReason::None;
+	return State->compare_exchange_strong(Expected, Reason, std::memory_order_relaxed);
+}
+
+void FOpenLogicPriorityQueueCounters::RecordEnqueue()
+{
+	QueueDepth.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FOpenLogicPriorityQueueCounters::RecordDequeue(uint64 WaitMicroseconds)
+{
+	QueueDepth.fetch_sub(1, std::memory_order_relaxed);
+	DequeuedCount.fetch_add(1, std::memory_order_relaxed);
+	TotalWaitMicroseconds.fetch_add(WaitMicroseconds, std::memory_order_relaxed);
+
+	uint64 MaxWait = MaxWaitMicroseconds.load(std::memory_order_relaxed);
+	while (WaitMicroseconds > MaxWait && !MaxWaitMicroseconds.compare_exchange_weak(MaxWait, WaitMicroseconds, std::memory_order_relaxed))
+	{
+	}
+}
+
+FOpenLogicPriorityQueueMetrics FOpenLogicPriorityQueueCounters::GetMetrics(EOpenLogicExecutionPriority Priority) const
+{
+	FOpenLogicPriorityQueueMetrics Metrics;
+	Metrics.Priority = Priority;
+	Metrics.QueueDepth = QueueDepth.load(std::memory_order_relaxed);
+	Metrics.DequeuedCount = DequeuedCount.load(std::memory_order_relaxed);
+	Metrics.MaxWaitMilliseconds = MaxWaitMicroseconds.load(std::memory_order_relaxed) / 1000.0f;
+
+	if (Metrics.DequeuedCount > 0)
+	{
+		Metrics.AverageWaitMilliseconds = TotalWaitMicroseconds.load(std::memory_order_relaxed) / 1000.0f / Metrics.DequeuedCount;
+	}
+
+	return Metrics;
 }
 
 bool FOpenLogicDefaultValueHandle::CommitChange()
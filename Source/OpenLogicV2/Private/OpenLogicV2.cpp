@@ -3,14 +3,30 @@
 #include "OpenLogicV2.h"
 
 #include "Core/OpenLogicTypes.h"
+#include "Profiling/OpenLogicStats.h"
+#include "Profiling/OpenLogicChromeTrace.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FOpenLogicV2Module"
 
 void FOpenLogicV2Module::StartupModule()
-{}
+{
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FOpenLogicStats::RecordFrame);
+
+	// -OpenLogicChromeTrace[=<file>] records from startup, for headless servers without a console
+	FString ChromeTraceFile;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-OpenLogicChromeTrace="), ChromeTraceFile) || FParse::Param(FCommandLine::Get(), TEXT("OpenLogicChromeTrace")))
+	{
+		FOpenLogicChromeTrace::Start(ChromeTraceFile);
+	}
+}
 
 void FOpenLogicV2Module::ShutdownModule()
-{}
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	FOpenLogicChromeTrace::Stop();
+}
 
 #undef LOCTEXT_NAMESPACE
 
@@ -0,0 +1,294 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Profiling/OpenLogicChromeTrace.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "OpenLogicV2.h"
+
+static TAutoConsoleVariable<bool> CVarChromeTraceCaptureArgs(
+	TEXT("OpenLogic.ChromeTrace.CaptureArgs"),
+	true,
+	TEXT("Adds the input and output pin values of every node activation to the Chrome trace."));
+
+static TAutoConsoleVariable<int32> CVarChromeTraceMaxArgLength(
+	TEXT("OpenLogic.ChromeTrace.MaxArgLength"),
+	256,
+	TEXT("Pin values longer than this are truncated in the Chrome trace."));
+
+namespace OpenLogicChromeTrace
+{
+	// Written to the file once this much is buffered
+	constexpr int32 FlushThreshold = 64 * 1024;
+
+	FCriticalSection Lock;
+	FArchive* Writer = nullptr;
+	TArray<ANSICHAR> Buffer;
+	uint64 StartCycles = 0;
+	bool bFirstEvent = true;
+	TSet<uint32> NamedProcesses;
+	uint64 NextFlowId = 1;
+}
+
+std::atomic<bool> FOpenLogicChromeTrace::bRecording{false};
+
+bool FOpenLogicChromeTrace::Start(const FString& FilePath)
+{
+	Stop();
+
+	const FString Path = FilePath.IsEmpty() ? GetDefaultFilePath() : FilePath;
+
+	FScopeLock ScopeLock(&OpenLogicChromeTrace::Lock);
+
+	OpenLogicChromeTrace::Writer = IFileManager::Get().CreateFileWriter(*Path);
+	if (!OpenLogicChromeTrace::Writer)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FOpenLogicChromeTrace::Start] Failed to open %s for writing."), *Path);
+		return false;
+	}
+
+	OpenLogicChromeTrace::Buffer.Reset();
+	OpenLogicChromeTrace::NamedProcesses.Reset();
+	OpenLogicChromeTrace::StartCycles = FPlatformTime::Cycles64();
+	OpenLogicChromeTrace::bFirstEvent = true;
+
+	const FTCHARToUTF8 Header(TEXT("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"));
+	OpenLogicChromeTrace::Buffer.Append(Header.Get(), Header.Length());
+
+	bRecording = true;
+
+	UE_LOG(OpenLogicLog, Display, TEXT("Recording OpenLogic Chrome trace to %s"), *Path);
+	return true;
+}
+
+void FOpenLogicChromeTrace::Stop()
+{
+	FScopeLock ScopeLock(&OpenLogicChromeTrace::Lock);
+
+	if (!OpenLogicChromeTrace::Writer)
+	{
+		return;
+	}
+
+	bRecording = false;
+
+	const FTCHARToUTF8 Footer(TEXT("\n]}\n"));
+	OpenLogicChromeTrace::Buffer.Append(Footer.Get(), Footer.Length());
+	FlushBuffer();
+
+	OpenLogicChromeTrace::Writer->Close();
+	delete OpenLogicChromeTrace::Writer;
+	OpenLogicChromeTrace::Writer = nullptr;
+
+	UE_LOG(OpenLogicLog, Display, TEXT("Stopped recording OpenLogic Chrome trace."));
+}
+
+double FOpenLogicChromeTrace::GetTimestamp()
+{
+	return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - OpenLogicChromeTrace::StartCycles) * 1000000.0;
+}
+
+FString FOpenLogicChromeTrace::GetDefaultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("OpenLogic") / TEXT("Traces") / FString::Printf(TEXT("%s.json"), *FDateTime::Now().ToString());
+}
+
+void FOpenLogicChromeTrace::OutputHandleCreated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FString& EventName)
+{
+	if (!IsRecording() || !Graph)
+	{
+		return;
+	}
+
+	WriteProcessName(Graph);
+
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%u,\"tid\":%d,\"args\":{\"name\":\"Handle %d (%s)\"}}"),
+		Graph->GetUniqueID(), HandleIndex, HandleIndex, *EscapeString(EventName)));
+}
+
+void FOpenLogicChromeTrace::OutputNodeActivation(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const UClass* TaskClass, const FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode* NodeData, double StartTimestamp, bool bPending)
+{
+	if (!IsRecording() || !Graph)
+	{
+		return;
+	}
+
+	const double EndTimestamp = GetTimestamp();
+
+	FString Args = FString::Printf(TEXT("\"node\":\"%s\""), *RuntimeNode.NodeID.ToString());
+	if (bPending)
+	{
+		Args += TEXT(",\"pending\":true");
+	}
+
+	if (NodeData && CVarChromeTraceCaptureArgs.GetValueOnAnyThread())
+	{
+		AppendPinArgs(Args, RuntimeNode, *NodeData);
+	}
+
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"X\",\"cat\":\"node\",\"name\":\"%s\",\"pid\":%u,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{%s}}"),
+		*EscapeString(GetNameSafe(TaskClass)), Graph->GetUniqueID(), HandleIndex, StartTimestamp, EndTimestamp - StartTimestamp, *Args));
+}
+
+void FOpenLogicChromeTrace::OutputNodeCompleted(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const UClass* TaskClass)
+{
+	if (!IsRecording() || !Graph)
+	{
+		return;
+	}
+
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"i\",\"s\":\"t\",\"cat\":\"node\",\"name\":\"%s completed\",\"pid\":%u,\"tid\":%d,\"ts\":%.3f}"),
+		*EscapeString(GetNameSafe(TaskClass)), Graph->GetUniqueID(), HandleIndex, GetTimestamp()));
+}
+
+void FOpenLogicChromeTrace::OutputThen(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, FName PinName)
+{
+	if (!IsRecording() || !Graph)
+	{
+		return;
+	}
+
+	uint64 FlowId;
+	{
+		FScopeLock ScopeLock(&OpenLogicChromeTrace::Lock);
+		FlowId = OpenLogicChromeTrace::NextFlowId++;
+	}
+
+	const double Timestamp = GetTimestamp();
+
+	// The start binds to the enclosing slice (the node calling Then), the end to the next slice on the handle (the node being executed)
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"s\",\"cat\":\"exec\",\"name\":\"%s\",\"id\":%llu,\"pid\":%u,\"tid\":%d,\"ts\":%.3f}"),
+		*EscapeString(PinName.ToString()), FlowId, Graph->GetUniqueID(), HandleIndex, Timestamp));
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"f\",\"cat\":\"exec\",\"name\":\"%s\",\"id\":%llu,\"pid\":%u,\"tid\":%d,\"ts\":%.3f}"),
+		*EscapeString(PinName.ToString()), FlowId, Graph->GetUniqueID(), HandleIndex, Timestamp));
+}
+
+void FOpenLogicChromeTrace::WriteEvent(const FString& Event)
+{
+	const FTCHARToUTF8 Utf8Event(*Event);
+
+	FScopeLock ScopeLock(&OpenLogicChromeTrace::Lock);
+
+	if (!OpenLogicChromeTrace::Writer)
+	{
+		return;
+	}
+
+	if (!OpenLogicChromeTrace::bFirstEvent)
+	{
+		OpenLogicChromeTrace::Buffer.Append(",\n", 2);
+	}
+	OpenLogicChromeTrace::bFirstEvent = false;
+
+	OpenLogicChromeTrace::Buffer.Append(Utf8Event.Get(), Utf8Event.Length());
+
+	if (OpenLogicChromeTrace::Buffer.Num() >= OpenLogicChromeTrace::FlushThreshold)
+	{
+		FlushBuffer();
+	}
+}
+
+void FOpenLogicChromeTrace::WriteProcessName(const UOpenLogicRuntimeGraph* Graph)
+{
+	bool bAlreadyNamed = false;
+	{
+		FScopeLock ScopeLock(&OpenLogicChromeTrace::Lock);
+		OpenLogicChromeTrace::NamedProcesses.Add(Graph->GetUniqueID(), &bAlreadyNamed);
+	}
+
+	if (bAlreadyNamed)
+	{
+		return;
+	}
+
+	WriteEvent(FString::Printf(TEXT("{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":%u,\"args\":{\"name\":\"%s\"}}"),
+		Graph->GetUniqueID(), *EscapeString(Graph->GetPathName())));
+}
+
+void FOpenLogicChromeTrace::FlushBuffer()
+{
+	// Called with the lock held
+	if (OpenLogicChromeTrace::Writer && OpenLogicChromeTrace::Buffer.Num() > 0)
+	{
+		OpenLogicChromeTrace::Writer->Serialize(OpenLogicChromeTrace::Buffer.GetData(), OpenLogicChromeTrace::Buffer.Num());
+		OpenLogicChromeTrace::Writer->Flush();
+	}
+
+	OpenLogicChromeTrace::Buffer.Reset();
+}
+
+FString FOpenLogicChromeTrace::EscapeString(const FString& Value)
+{
+	FString Result;
+	Result.Reserve(Value.Len());
+
+	for (const TCHAR Character : Value)
+	{
+		switch (Character)
+		{
+		case TEXT('"'):  Result += TEXT("\\\""); break;
+		case TEXT('\\'): Result += TEXT("\\\\"); break;
+		case TEXT('\n'): Result += TEXT("\\n"); break;
+		case TEXT('\r'): Result += TEXT("\\r"); break;
+		case TEXT('\t'): Result += TEXT("\\t"); break;
+		default:
+			if (Character < 0x20)
+			{
+				Result += FString::Printf(TEXT("\\u%04x"), Character);
+			}
+			else
+			{
+				Result.AppendChar(Character);
+			}
+		}
+	}
+
+	return Result;
+}
+
+void FOpenLogicChromeTrace::AppendPinArgs(FString& Args, const FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData)
+{
+	const int32 MaxArgLength = CVarChromeTraceMaxArgLength.GetValueOnAnyThread();
+
+	auto AppendValues = [&Args, &NodeData, MaxArgLength](const TMap<int32, TSharedPtr<void>>& Values, bool bIsInput)
+	{
+		for (const TPair<int32, TSharedPtr<void>>& ValuePair : Values)
+		{
+			const FOpenLogicPinData PinData = bIsInput ? NodeData.GetInputPinData(ValuePair.Key) : NodeData.GetOutputPinData(ValuePair.Key);
+			const UOpenLogicProperty* PropertyObject = PinData.PropertyClass ? PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+			if (!PropertyObject)
+			{
+				continue;
+			}
+
+			FString Value = PropertyObject->ExportValueToString(ValuePair.Value.Get());
+			if (MaxArgLength > 0 && Value.Len() > MaxArgLength)
+			{
+				Value = Value.Left(MaxArgLength) + TEXT("...");
+			}
+
+			Args += FString::Printf(TEXT(",\"%s %s\":\"%s\""), bIsInput ? TEXT("in") : TEXT("out"), *EscapeString(PinData.PinName.ToString()), *EscapeString(Value));
+		}
+	};
+
+	AppendValues(RuntimeNode.InputProperties, true);
+	AppendValues(RuntimeNode.OutputProperties, false);
+}
+
+static FAutoConsoleCommand ChromeTraceStartCommand(
+	TEXT("OpenLogic.ChromeTrace.Start"),
+	TEXT("Starts writing OpenLogic execution to a Chrome trace file. Usage: OpenLogic.ChromeTrace.Start [FilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FOpenLogicChromeTrace::Start(Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+static FAutoConsoleCommand ChromeTraceStopCommand(
+	TEXT("OpenLogic.ChromeTrace.Stop"),
+	TEXT("Stops writing the OpenLogic Chrome trace file."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FOpenLogicChromeTrace::Stop();
+	}));
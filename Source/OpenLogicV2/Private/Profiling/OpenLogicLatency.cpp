@@ -0,0 +1,202 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Profiling/OpenLogicLatency.h"
+#include "Tasks/OpenLogicTask.h"
+#include "HAL/IConsoleManager.h"
+#include "OpenLogicV2.h"
+
+void FOpenLogicLatencyHistogram::Record(uint64 Microseconds)
+{
+	if (Buckets.Num() == 0)
+	{
+		Buckets.SetNumZeroed(BucketCount);
+	}
+
+	Microseconds = FMath::Min<uint64>(Microseconds, (1ull << MaxValueBits) - 1);
+
+	Buckets[GetBucketIndex(Microseconds)]++;
+	SampleCount++;
+	SumMicroseconds += Microseconds;
+	MaxMicroseconds = FMath::Max(MaxMicroseconds, Microseconds);
+}
+
+void FOpenLogicLatencyHistogram::Reset()
+{
+	Buckets.Empty();
+	SampleCount = 0;
+	SumMicroseconds = 0;
+	MaxMicroseconds = 0;
+}
+
+FOpenLogicLatencyStats FOpenLogicLatencyHistogram::GetStats() const
+{
+	FOpenLogicLatencyStats Stats;
+	Stats.SampleCount = SampleCount;
+
+	if (SampleCount == 0)
+	{
+		return Stats;
+	}
+
+	Stats.MeanMilliseconds = SumMicroseconds / 1000.0 / SampleCount;
+	Stats.P50Milliseconds = GetValueAtPercentile(50.0) / 1000.0;
+	Stats.P95Milliseconds = GetValueAtPercentile(95.0) / 1000.0;
+	Stats.P99Milliseconds = GetValueAtPercentile(99.0) / 1000.0;
+	Stats.MaxMilliseconds = MaxMicroseconds / 1000.0;
+
+	return Stats;
+}
+
+uint64 FOpenLogicLatencyHistogram::GetValueAtPercentile(double Percentile) const
+{
+	if (SampleCount == 0)
+	{
+		return 0;
+	}
+
+	const int64 TargetCount = FMath::Max<int64>(1, FMath::CeilToInt64(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * SampleCount));
+
+	int64 Count = 0;
+	for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); BucketIndex++)
+	{
+		Count += Buckets[BucketIndex];
+		if (Count >= TargetCount)
+		{
+			// The bucket's upper bound, but never above what was actually recorded
+			return FMath::Min(GetBucketUpperBound(BucketIndex), MaxMicroseconds);
+		}
+	}
+
+	return MaxMicroseconds;
+}
+
+int32 FOpenLogicLatencyHistogram::GetBucketIndex(uint64 Value)
+{
+	// Values below the sub-bucket count get a bucket each
+	if (Value < SubBucketCount)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// Above that, each power of two is split into SubBucketHalfCount buckets
+	const int32 Magnitude = static_cast<int32>(FPlatformMath::FloorLog2_64(Value)) - (SubBucketBits - 1);
+	const int32 SubBucket = static_cast<int32>(Value >> Magnitude);
+
+	return Magnitude * SubBucketHalfCount + SubBucket;
+}
+
+uint64 FOpenLogicLatencyHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+	if (BucketIndex < SubBucketCount)
+	{
+		return BucketIndex;
+	}
+
+	const int32 Magnitude = BucketIndex / SubBucketHalfCount - 1;
+	const uint64 SubBucket = BucketIndex % SubBucketHalfCount + SubBucketHalfCount;
+
+	return ((SubBucket + 1) << Magnitude) - 1;
+}
+
+FOpenLogicLatencyTracker& FOpenLogicLatencyTracker::Get()
+{
+	static FOpenLogicLatencyTracker Tracker;
+	return Tracker;
+}
+
+void FOpenLogicLatencyTracker::Record(const FSoftObjectPath& EventClass, uint64 QueueWaitMicroseconds, uint64 ExecutionMicroseconds)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FEventHistograms& Histograms = Events.FindOrAdd(EventClass);
+	Histograms.Total.Record(QueueWaitMicroseconds + ExecutionMicroseconds);
+	Histograms.QueueWait.Record(QueueWaitMicroseconds);
+	Histograms.Execution.Record(ExecutionMicroseconds);
+}
+
+bool FOpenLogicLatencyTracker::GetEventLatency(const FSoftObjectPath& EventClass, FOpenLogicEventLatency& OutLatency) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FEventHistograms* Histograms = Events.Find(EventClass);
+	if (!Histograms)
+	{
+		return false;
+	}
+
+	OutLatency = MakeEventLatency(EventClass, *Histograms);
+	return true;
+}
+
+TArray<FOpenLogicEventLatency> FOpenLogicLatencyTracker::GetAllEventLatencies() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<FOpenLogicEventLatency> Latencies;
+	Latencies.Reserve(Events.Num());
+
+	for (const TPair<FSoftObjectPath, FEventHistograms>& EventPair : Events)
+	{
+		Latencies.Add(MakeEventLatency(EventPair.Key, EventPair.Value));
+	}
+
+	return Latencies;
+}
+
+void FOpenLogicLatencyTracker::Reset(const FSoftObjectPath& EventClass)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (EventClass.IsNull())
+	{
+		Events.Empty();
+		return;
+	}
+
+	Events.Remove(EventClass);
+}
+
+void FOpenLogicLatencyTracker::Dump() const
+{
+	TArray<FOpenLogicEventLatency> Latencies = GetAllEventLatencies();
+	Latencies.Sort([](const FOpenLogicEventLatency& A, const FOpenLogicEventLatency& B) { return A.Total.P99Milliseconds > B.Total.P99Milliseconds; });
+
+	UE_LOG(OpenLogicLog, Display, TEXT("Event latency for %d event classes (ms, p50/p95/p99/max):"), Latencies.Num());
+
+	for (const FOpenLogicEventLatency& Latency : Latencies)
+	{
+		UE_LOG(OpenLogicLog, Display, TEXT("  %s (%lld samples): total %.3f/%.3f/%.3f/%.3f | queue %.3f/%.3f/%.3f/%.3f | execution %.3f/%.3f/%.3f/%.3f"),
+			*GetNameSafe(Latency.EventClass.Get()),
+			Latency.Total.SampleCount,
+			Latency.Total.P50Milliseconds, Latency.Total.P95Milliseconds, Latency.Total.P99Milliseconds, Latency.Total.MaxMilliseconds,
+			Latency.QueueWait.P50Milliseconds, Latency.QueueWait.P95Milliseconds, Latency.QueueWait.P99Milliseconds, Latency.QueueWait.MaxMilliseconds,
+			Latency.Execution.P50Milliseconds, Latency.Execution.P95Milliseconds, Latency.Execution.P99Milliseconds, Latency.Execution.MaxMilliseconds);
+	}
+}
+
+FOpenLogicEventLatency FOpenLogicLatencyTracker::MakeEventLatency(const FSoftObjectPath& EventClass, const FEventHistograms& Histograms)
+{
+	FOpenLogicEventLatency Latency;
+	Latency.EventClass = Cast<UClass>(EventClass.ResolveObject());
+	Latency.Total = Histograms.Total.GetStats();
+	Latency.QueueWait = Histograms.QueueWait.GetStats();
+	Latency.Execution = Histograms.Execution.GetStats();
+
+	return Latency;
+}
+
+static FAutoConsoleCommand DumpLatencyCommand(
+	TEXT("OpenLogic.Latency.Dump"),
+	TEXT("Logs the trigger-to-completion latency of every event class."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FOpenLogicLatencyTracker::Get().Dump();
+	}));
+
+static FAutoConsoleCommand ResetLatencyCommand(
+	TEXT("OpenLogic.Latency.Reset"),
+	TEXT("Resets the latency histograms of every event class."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FOpenLogicLatencyTracker::Get().Reset();
+	}));
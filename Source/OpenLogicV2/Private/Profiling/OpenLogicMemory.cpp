@@ -0,0 +1,62 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Profiling/OpenLogicMemory.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "OpenLogicV2.h"
+
+LLM_DEFINE_TAG(OpenLogic);
+LLM_DEFINE_TAG(OpenLogic_RuntimeGraph, TEXT("RuntimeGraph"), TEXT("OpenLogic"));
+LLM_DEFINE_TAG(OpenLogic_TaskPool, TEXT("TaskPool"), TEXT("OpenLogic"));
+LLM_DEFINE_TAG(OpenLogic_Values, TEXT("Values"), TEXT("OpenLogic"));
+LLM_DEFINE_TAG(OpenLogic_Payloads, TEXT("Payloads"), TEXT("OpenLogic"));
+LLM_DEFINE_TAG(OpenLogic_Editor, TEXT("Editor"), TEXT("OpenLogic"));
+
+static FAutoConsoleCommand DumpMemoryCommand(
+	TEXT("OpenLogic.DumpMemory"),
+	TEXT("Logs the memory footprint of the N largest runtime graphs (default 10). Usage: OpenLogic.DumpMemory [N]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 MaxGraphs = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10;
+
+		TArray<TPair<const UOpenLogicRuntimeGraph*, FOpenLogicMemoryFootprint>> Footprints;
+
+		for (TObjectIterator<UOpenLogicRuntimeGraph> It; It; ++It)
+		{
+			const UOpenLogicRuntimeGraph* RuntimeGraph = *It;
+			if (!IsValid(RuntimeGraph) || RuntimeGraph->IsTemplate())
+			{
+				continue;
+			}
+
+			Footprints.Emplace(RuntimeGraph, RuntimeGraph->GetMemoryFootprint());
+		}
+
+		Footprints.Sort([](const auto& A, const auto& B) { return A.Value.TotalBytes > B.Value.TotalBytes; });
+
+		int64 TotalBytes = 0;
+		for (const auto& Footprint : Footprints)
+		{
+			TotalBytes += Footprint.Value.TotalBytes;
+		}
+
+		UE_LOG(OpenLogicLog, Display, TEXT("%d runtime graphs, %.2f KiB total. Top %d:"), Footprints.Num(), TotalBytes / 1024.0, FMath::Min(MaxGraphs, Footprints.Num()));
+
+		for (int32 Index = 0; Index < Footprints.Num() && Index < MaxGraphs; Index++)
+		{
+			const FOpenLogicMemoryFootprint& Footprint = Footprints[Index].Value;
+
+			UE_LOG(OpenLogicLog, Display, TEXT("  %8.2f KiB  %s  (graph data %.2f, handles %.2f, runtime nodes %.2f, values %.2f, task pools %.2f KiB | %d handles, %d nodes, %d pooled tasks)"),
+				Footprint.TotalBytes / 1024.0,
+				*Footprints[Index].Key->GetPathName(),
+				Footprint.GraphDataBytes / 1024.0,
+				Footprint.HandleBytes / 1024.0,
+				Footprint.RuntimeNodeBytes / 1024.0,
+				Footprint.ValueBytes / 1024.0,
+				Footprint.TaskPoolBytes / 1024.0,
+				Footprint.HandleCount,
+				Footprint.RuntimeNodeCount,
+				Footprint.PooledTaskCount);
+		}
+	}));
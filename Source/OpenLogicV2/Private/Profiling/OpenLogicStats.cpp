@@ -0,0 +1,56 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Profiling/OpenLogicStats.h"
+
+DEFINE_STAT(STAT_OpenLogic_ActivateNode);
+DEFINE_STAT(STAT_OpenLogic_ResolveConnectedPinValue);
+DEFINE_STAT(STAT_OpenLogic_InitializeTaskInstance);
+DEFINE_STAT(STAT_OpenLogic_Then);
+DEFINE_STAT(STAT_OpenLogic_ProcessQueue);
+DEFINE_STAT(STAT_OpenLogic_ActivateBatchedNode);
+DEFINE_STAT(STAT_OpenLogic_SaveState);
+DEFINE_STAT(STAT_OpenLogic_LoadState);
+
+DEFINE_STAT(STAT_OpenLogic_ActiveHandles);
+DEFINE_STAT(STAT_OpenLogic_RuntimeNodes);
+DEFINE_STAT(STAT_OpenLogic_QueuedActivations);
+DEFINE_STAT(STAT_OpenLogic_PooledTasksAvailable);
+DEFINE_STAT(STAT_OpenLogic_PooledTasksActive);
+
+DEFINE_STAT(STAT_OpenLogic_NodeActivations);
+DEFINE_STAT(STAT_OpenLogic_ValueCopies);
+DEFINE_STAT(STAT_OpenLogic_CancelledTasks);
+
+CSV_DEFINE_CATEGORY_MODULE(OPENLOGICV2_API, OpenLogic, true);
+
+std::atomic<int32> FOpenLogicStats::ActiveHandles{0};
+std::atomic<int32> FOpenLogicStats::RuntimeNodes{0};
+std::atomic<int32> FOpenLogicStats::QueuedActivations{0};
+std::atomic<int32> FOpenLogicStats::PooledTasksAvailable{0};
+std::atomic<int32> FOpenLogicStats::PooledTasksActive{0};
+std::atomic<int32> FOpenLogicStats::NodeActivations{0};
+std::atomic<int32> FOpenLogicStats::ValueCopies{0};
+std::atomic<int32> FOpenLogicStats::CancelledTasks{0};
+
+void FOpenLogicStats::RecordFrame()
+{
+	// Activations, copies and cancellations are per frame, everything else is a running total
+	const int32 FrameActivations = NodeActivations.exchange(0, std::memory_order_relaxed);
+	const int32 FrameValueCopies = ValueCopies.exchange(0, std::memory_order_relaxed);
+	const int32 FrameCancelledTasks = CancelledTasks.exchange(0, std::memory_order_relaxed);
+
+#if CSV_PROFILER
+	CSV_CUSTOM_STAT(OpenLogic, NodeActivations, FrameActivations, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, ValueCopies, FrameValueCopies, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, CancelledTasks, FrameCancelledTasks, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, ActiveHandles, ActiveHandles.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, RuntimeNodes, RuntimeNodes.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, QueuedActivations, QueuedActivations.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, PooledTasksAvailable, PooledTasksAvailable.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(OpenLogic, PooledTasksActive, PooledTasksActive.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+#else
+	(void)FrameActivations;
+	(void)FrameValueCopies;
+	(void)FrameCancelledTasks;
+#endif
+}
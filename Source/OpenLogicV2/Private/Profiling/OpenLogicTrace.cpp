@@ -0,0 +1,268 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Profiling/OpenLogicTrace.h"
+
+#if OPENLOGIC_TRACE_ENABLED
+
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(OpenLogicChannel)
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, GraphSpec, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, TaskClassSpec, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint64, ClassId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, HandleCreated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, HandleDestroyed)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, NodeActivated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(uint64, ClassId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, NodeActivationEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(bool, bPending)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, NodeCompleted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(uint64, ClassId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, PinWrite)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(int32, PinIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, PoolAccess)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, ClassId)
+	UE_TRACE_EVENT_FIELD(int32, AvailableCount)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(bool, bHit)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, QueueEnqueue)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OpenLogic, QueueDequeue)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, GraphId)
+	UE_TRACE_EVENT_FIELD(int32, HandleIndex)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+UE_TRACE_EVENT_END()
+
+namespace OpenLogicTrace
+{
+	static uint64 GetObjectId(const UObject* Object)
+	{
+		return static_cast<uint64>(reinterpret_cast<UPTRINT>(Object));
+	}
+
+	static const uint32* GetGuidData(const FGuid& Guid)
+	{
+		// FGuid is laid out as four consecutive uint32 components (A, B, C, D)
+		return &Guid.A;
+	}
+
+	// Emits the class name once per class so node events only need to carry an id
+	static uint64 OutputTaskClass(const UClass* TaskClass)
+	{
+		if (!TaskClass)
+		{
+			return 0;
+		}
+
+		static FCriticalSection KnownClassesLock;
+		static TSet<uint64> KnownClasses;
+
+		const uint64 ClassId = GetObjectId(TaskClass);
+
+		bool bAlreadyKnown = false;
+		{
+			FScopeLock Lock(&KnownClassesLock);
+			KnownClasses.Add(ClassId, &bAlreadyKnown);
+		}
+
+		if (!bAlreadyKnown)
+		{
+			const FString ClassName = TaskClass->GetName();
+
+			UE_TRACE_LOG(OpenLogic, TaskClassSpec, OpenLogicChannel)
+				<< TaskClassSpec.ClassId(ClassId)
+				<< TaskClassSpec.Name(*ClassName, ClassName.Len());
+		}
+
+		return ClassId;
+	}
+}
+
+void FOpenLogicTrace::OutputGraph(const UOpenLogicRuntimeGraph* Graph)
+{
+	if (!Graph || !UE_TRACE_CHANNELEXPR_IS_ENABLED(OpenLogicChannel))
+	{
+		return;
+	}
+
+	const FString GraphName = Graph->GetPathName();
+
+	UE_TRACE_LOG(OpenLogic, GraphSpec, OpenLogicChannel)
+		<< GraphSpec.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< GraphSpec.Name(*GraphName, GraphName.Len());
+}
+
+void FOpenLogicTrace::OutputHandleCreated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& EntryNodeID)
+{
+	UE_TRACE_LOG(OpenLogic, HandleCreated, OpenLogicChannel)
+		<< HandleCreated.Cycle(FPlatformTime::Cycles64())
+		<< HandleCreated.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< HandleCreated.HandleIndex(HandleIndex)
+		<< HandleCreated.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< HandleCreated.NodeGuid(OpenLogicTrace::GetGuidData(EntryNodeID), 4);
+}
+
+void FOpenLogicTrace::OutputHandleDestroyed(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex)
+{
+	UE_TRACE_LOG(OpenLogic, HandleDestroyed, OpenLogicChannel)
+		<< HandleDestroyed.Cycle(FPlatformTime::Cycles64())
+		<< HandleDestroyed.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< HandleDestroyed.HandleIndex(HandleIndex)
+		<< HandleDestroyed.ThreadId(FPlatformTLS::GetCurrentThreadId());
+}
+
+void FOpenLogicTrace::OutputNodeActivated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, const UClass* TaskClass)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(OpenLogicChannel))
+	{
+		return;
+	}
+
+	const uint64 ClassId = OpenLogicTrace::OutputTaskClass(TaskClass);
+
+	UE_TRACE_LOG(OpenLogic, NodeActivated, OpenLogicChannel)
+		<< NodeActivated.Cycle(FPlatformTime::Cycles64())
+		<< NodeActivated.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< NodeActivated.ClassId(ClassId)
+		<< NodeActivated.HandleIndex(HandleIndex)
+		<< NodeActivated.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< NodeActivated.NodeGuid(OpenLogicTrace::GetGuidData(NodeID), 4);
+}
+
+void FOpenLogicTrace::OutputNodeActivationEnd(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, bool bPending)
+{
+	UE_TRACE_LOG(OpenLogic, NodeActivationEnd, OpenLogicChannel)
+		<< NodeActivationEnd.Cycle(FPlatformTime::Cycles64())
+		<< NodeActivationEnd.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< NodeActivationEnd.HandleIndex(HandleIndex)
+		<< NodeActivationEnd.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< NodeActivationEnd.bPending(bPending)
+		<< NodeActivationEnd.NodeGuid(OpenLogicTrace::GetGuidData(NodeID), 4);
+}
+
+void FOpenLogicTrace::OutputNodeCompleted(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, const UClass* TaskClass)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(OpenLogicChannel))
+	{
+		return;
+	}
+
+	const uint64 ClassId = OpenLogicTrace::OutputTaskClass(TaskClass);
+
+	UE_TRACE_LOG(OpenLogic, NodeCompleted, OpenLogicChannel)
+		<< NodeCompleted.Cycle(FPlatformTime::Cycles64())
+		<< NodeCompleted.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< NodeCompleted.ClassId(ClassId)
+		<< NodeCompleted.HandleIndex(HandleIndex)
+		<< NodeCompleted.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< NodeCompleted.NodeGuid(OpenLogicTrace::GetGuidData(NodeID), 4);
+}
+
+void FOpenLogicTrace::OutputPinWrite(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, int32 PinIndex)
+{
+	UE_TRACE_LOG(OpenLogic, PinWrite, OpenLogicChannel)
+		<< PinWrite.Cycle(FPlatformTime::Cycles64())
+		<< PinWrite.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< PinWrite.HandleIndex(HandleIndex)
+		<< PinWrite.PinIndex(PinIndex)
+		<< PinWrite.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< PinWrite.NodeGuid(OpenLogicTrace::GetGuidData(NodeID), 4);
+}
+
+void FOpenLogicTrace::OutputPoolAccess(const UClass* TaskClass, bool bHit, int32 AvailableCount)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(OpenLogicChannel))
+	{
+		return;
+	}
+
+	const uint64 ClassId = OpenLogicTrace::OutputTaskClass(TaskClass);
+
+	UE_TRACE_LOG(OpenLogic, PoolAccess, OpenLogicChannel)
+		<< PoolAccess.Cycle(FPlatformTime::Cycles64())
+		<< PoolAccess.ClassId(ClassId)
+		<< PoolAccess.AvailableCount(AvailableCount)
+		<< PoolAccess.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< PoolAccess.bHit(bHit);
+}
+
+void FOpenLogicTrace::OutputQueueEnqueue(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex)
+{
+	UE_TRACE_LOG(OpenLogic, QueueEnqueue, OpenLogicChannel)
+		<< QueueEnqueue.Cycle(FPlatformTime::Cycles64())
+		<< QueueEnqueue.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< QueueEnqueue.HandleIndex(HandleIndex)
+		<< QueueEnqueue.ThreadId(FPlatformTLS::GetCurrentThreadId());
+}
+
+void FOpenLogicTrace::OutputQueueDequeue(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex)
+{
+	UE_TRACE_LOG(OpenLogic, QueueDequeue, OpenLogicChannel)
+		<< QueueDequeue.Cycle(FPlatformTime::Cycles64())
+		<< QueueDequeue.GraphId(OpenLogicTrace::GetObjectId(Graph))
+		<< QueueDequeue.HandleIndex(HandleIndex)
+		<< QueueDequeue.ThreadId(FPlatformTLS::GetCurrentThreadId());
+}
+
+#endif
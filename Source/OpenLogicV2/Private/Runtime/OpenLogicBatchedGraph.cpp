@@ -0,0 +1,544 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Runtime/OpenLogicBatchedGraph.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "Profiling/OpenLogicMemory.h"
+#include "Profiling/OpenLogicStats.h"
+#include "OpenLogicV2.h"
+#include "Serialization/StructuredArchive.h"
+
+FOpenLogicBatchColumn::FOpenLogicBatchColumn(const FProperty* InValueProperty, const TSharedPtr<void>& InDefaultValue)
+	: ValueProperty(InValueProperty), DefaultValue(InDefaultValue)
+{
+	Stride = ValueProperty ? ValueProperty->GetSize() : 0;
+
+	TArray<const FStructProperty*> EncounteredStructProperties;
+	bHasObjectReferences = ValueProperty && ValueProperty->ContainsObjectReference(EncounteredStructProperties);
+}
+
+FOpenLogicBatchColumn::FOpenLogicBatchColumn(const UScriptStruct* InStructType, int32 InStride, const TSharedPtr<void>& InDefaultValue)
+	: StructType(InStructType), DefaultValue(InDefaultValue), Stride(InStride)
+{
+	bHasObjectReferences = StructType && StructType->RefLink;
+}
+
+FOpenLogicBatchColumn::~FOpenLogicBatchColumn()
+{
+	SetNum(0);
+}
+
+void FOpenLogicBatchColumn::SetNum(int32 NewNum)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (Stride <= 0)
+	{
+		return;
+	}
+
+	const int32 OldNum = Num();
+
+	for (int32 Instance = NewNum; Instance < OldNum; Instance++)
+	{
+		DestroyValue(GetValuePtr(Instance));
+	}
+
+	Data.SetNumUninitialized(NewNum * Stride);
+
+	for (int32 Instance = OldNum; Instance < NewNum; Instance++)
+	{
+		InitializeValue(GetValuePtr(Instance));
+	}
+}
+
+void FOpenLogicBatchColumn::RemoveAtSwap(int32 Instance)
+{
+	if (Stride <= 0 || Instance < 0 || Instance >= Num())
+	{
+		return;
+	}
+
+	const int32 LastInstance = Num() - 1;
+
+	DestroyValue(GetValuePtr(Instance));
+
+	// Engine types are trivially relocatable, so the last value can be moved bitwise
+	if (Instance != LastInstance)
+	{
+		FMemory::Memcpy(GetValuePtr(Instance), GetValuePtr(LastInstance), Stride);
+	}
+
+	Data.SetNumUninitialized(LastInstance * Stride);
+}
+
+void FOpenLogicBatchColumn::AddReferencedObjects(FReferenceCollector& Collector) const
+{
+	if (!bHasObjectReferences)
+	{
+		return;
+	}
+
+	// The values are not UPROPERTYs of the graph, their references are serialized through the collector instead
+	FArchive& Ar = Collector.GetVerySlowReferenceCollectorArchive();
+
+	auto SerializeReferences = [this, &Ar](void* Value)
+	{
+		if (ValueProperty)
+		{
+			FStructuredArchiveFromArchive StructuredArchive(Ar);
+			ValueProperty->SerializeItem(StructuredArchive.GetSlot(), Value);
+		} else if (StructType)
+		{
+			const_cast<UScriptStruct*>(StructType)->SerializeItem(Ar, Value, nullptr);
+		}
+	};
+
+	for (int32 Instance = 0; Instance < Num(); Instance++)
+	{
+		SerializeReferences(const_cast<void*>(GetValuePtr(Instance)));
+	}
+
+	if (DefaultValue.IsValid())
+	{
+		SerializeReferences(DefaultValue.Get());
+	}
+}
+
+void FOpenLogicBatchColumn::InitializeValue(void* Value) const
+{
+	FMemory::Memzero(Value, Stride);
+
+	if (ValueProperty)
+	{
+		ValueProperty->InitializeValue(Value);
+		if (DefaultValue.IsValid())
+		{
+			ValueProperty->CopySingleValue(Value, DefaultValue.Get());
+		}
+	} else if (StructType)
+	{
+		StructType->InitializeStruct(Value);
+		if (DefaultValue.IsValid())
+		{
+			StructType->CopyScriptStruct(Value, DefaultValue.Get());
+		}
+	} else if (DefaultValue.IsValid())
+	{
+		FMemory::Memcpy(Value, DefaultValue.Get(), Stride);
+	}
+}
+
+void FOpenLogicBatchColumn::DestroyValue(void* Value) const
+{
+	if (ValueProperty)
+	{
+		ValueProperty->DestroyValue(Value);
+	} else if (StructType)
+	{
+		StructType->DestroyStruct(Value);
+	}
+}
+
+int32 FOpenLogicBatchContext::GetInstanceCount() const
+{
+	return Graph->GetInstanceCount();
+}
+
+UObject* FOpenLogicBatchContext::GetContext(int32 Instance) const
+{
+	return Graph->GetInstanceContext(Instance);
+}
+
+void FOpenLogicBatchContext::ExecutePin(int32 PinIndex) const
+{
+	Graph->ExecutePin(NodeIndex, PinIndex, Instances);
+}
+
+void FOpenLogicBatchContext::ExecutePin(int32 PinIndex, TConstArrayView<int32> InInstances) const
+{
+	Graph->ExecutePin(NodeIndex, PinIndex, InInstances);
+}
+
+bool UOpenLogicBatchedGraph::SetGraphData(const FOpenLogicGraphData& NewData)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	if (ExecutionDepth > 0)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[UOpenLogicBatchedGraph::SetGraphData] Cannot change the graph data while the graph runs."));
+		return false;
+	}
+
+	GraphData = NewData;
+
+	ResetColumns();
+	Nodes.Reset();
+	NodeIndices.Reset();
+	TaskInstances.Reset();
+	EventNodes.Reset();
+
+	bCompiled = true;
+
+	// One task instance runs every instance of a node
+	for (const TPair<FGuid, FOpenLogicNode>& NodePair : GraphData.Nodes)
+	{
+		UClass* TaskClass = NodePair.Value.TaskClass.LoadSynchronous();
+		if (!TaskClass)
+		{
+			UE_LOG(OpenLogicLog, Error, TEXT("[UOpenLogicBatchedGraph::SetGraphData] Invalid TaskClass for NodeID %s."), *NodePair.Key.ToString());
+			bCompiled = false;
+			continue;
+		}
+
+		UOpenLogicTask* Task = NewObject<UOpenLogicTask>(this, TaskClass);
+		Task->SetGuid(NodePair.Key);
+		UOpenLogicRuntimeGraph::ImportTaskProperties(Task, NodePair.Value);
+
+		FOpenLogicBatchNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.NodeID = NodePair.Key;
+		Node.Task = Task;
+		Node.bIsEvent = Task->TaskData.Type == ENodeType::Event;
+
+		if (!Node.bIsEvent && !Task->bSupportsBatchedExecution)
+		{
+			UE_LOG(OpenLogicLog, Error, TEXT("[UOpenLogicBatchedGraph::SetGraphData] %s does not support batched execution."), *TaskClass->GetName());
+			bCompiled = false;
+		}
+
+		NodeIndices.Add(NodePair.Key, Nodes.Num() - 1);
+		TaskInstances.Add(Task);
+	}
+
+	auto GetPinArraySize = [](const TMap<int32, FOpenLogicPinState>& Pins)
+	{
+		int32 MaxPinIndex = 0;
+		for (const TPair<int32, FOpenLogicPinState>& PinPair : Pins)
+		{
+			MaxPinIndex = FMath::Max(MaxPinIndex, PinPair.Key);
+		}
+		return MaxPinIndex + 1;
+	};
+
+	TArray<bool> HasExecutionInput;
+	HasExecutionInput.Init(false, Nodes.Num());
+
+	// Outputs first, so the inputs can point at the columns they are connected to
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		FOpenLogicBatchNode& Node = Nodes[NodeIndex];
+		const FOpenLogicNode& NodeData = GraphData.Nodes[Node.NodeID];
+
+		const int32 OutputPinArraySize = GetPinArraySize(NodeData.OutputPins);
+		Node.OutputColumns.Init(INDEX_NONE, OutputPinArraySize);
+		Node.FlowTargets.Init(INDEX_NONE, OutputPinArraySize);
+		Node.FlowTargetPins.Init(NAME_None, OutputPinArraySize);
+
+		for (const TPair<int32, FOpenLogicPinState>& PinPair : NodeData.OutputPins)
+		{
+			if (PinPair.Key < 0)
+			{
+				continue;
+			}
+
+			const FOpenLogicPinData PinData = NodeData.GetOutputPinData(PinPair.Key);
+
+			if (PinData.Role == EPinRole::DataProperty)
+			{
+				Node.OutputColumns[PinPair.Key] = AddColumn(PinData, nullptr);
+				continue;
+			}
+
+			if (Node.EntryPin == INDEX_NONE || PinPair.Key < Node.EntryPin)
+			{
+				Node.EntryPin = PinPair.Key;
+			}
+
+			if (PinPair.Value.Connections.IsEmpty())
+			{
+				continue;
+			}
+
+			const FOpenLogicPinConnection& Connection = PinPair.Value.Connections[0];
+			if (const int32* TargetIndex = NodeIndices.Find(Connection.NodeID))
+			{
+				Node.FlowTargets[PinPair.Key] = *TargetIndex;
+				Node.FlowTargetPins[PinPair.Key] = GraphData.Nodes[Connection.NodeID].GetInputPinData(Connection.PinID).PinName;
+			}
+		}
+
+		for (const TPair<int32, FOpenLogicPinState>& PinPair : NodeData.InputPins)
+		{
+			if (NodeData.GetInputPinData(PinPair.Key).Role == EPinRole::FlowControl)
+			{
+				HasExecutionInput[NodeIndex] = true;
+				break;
+			}
+		}
+	}
+
+	for (FOpenLogicBatchNode& Node : Nodes)
+	{
+		const FOpenLogicNode& NodeData = GraphData.Nodes[Node.NodeID];
+		Node.InputColumns.Init(INDEX_NONE, GetPinArraySize(NodeData.InputPins));
+
+		for (const TPair<int32, FOpenLogicPinState>& PinPair : NodeData.InputPins)
+		{
+			const FOpenLogicPinData PinData = NodeData.GetInputPinData(PinPair.Key);
+			if (PinPair.Key < 0 || PinData.Role != EPinRole::DataProperty)
+			{
+				continue;
+			}
+
+			// Connected inputs read the column of the output directly
+			if (!PinPair.Value.Connections.IsEmpty())
+			{
+				const FOpenLogicPinConnection& Connection = PinPair.Value.Connections[0];
+				const int32* SourceIndex = NodeIndices.Find(Connection.NodeID);
+				if (SourceIndex && Nodes[*SourceIndex].OutputColumns.IsValidIndex(Connection.PinID))
+				{
+					Node.InputColumns[PinPair.Key] = Nodes[*SourceIndex].OutputColumns[Connection.PinID];
+
+					if (!HasExecutionInput[*SourceIndex] && !Nodes[*SourceIndex].bIsEvent)
+					{
+						Node.DataDependencies.AddUnique(*SourceIndex);
+					}
+					continue;
+				}
+			}
+
+			const UOpenLogicProperty* PropertyInstance = PinData.PropertyClass ? PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+			const TSharedPtr<void> DefaultValue = PropertyInstance ? UOpenLogicRuntimeGraph::CreatePropertyValueFromDefault(PinPair.Value.DefaultValue, PropertyInstance) : nullptr;
+
+			Node.InputColumns[PinPair.Key] = AddColumn(PinData, DefaultValue);
+		}
+	}
+
+	for (const TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicEventContainer>& EventPair : GraphData.Events)
+	{
+		// Triggering a parent class also triggers the implementations of its subclasses
+		for (UClass* EventClass = EventPair.Key.Get(); EventClass && EventClass != UOpenLogicTask::StaticClass(); EventClass = EventClass->GetSuperClass())
+		{
+			TArray<int32>& EventNodeIndices = EventNodes.FindOrAdd(EventClass);
+			for (const FGuid& NodeID : EventPair.Value.NodeId)
+			{
+				if (const int32* NodeIndex = NodeIndices.Find(NodeID))
+				{
+					EventNodeIndices.AddUnique(*NodeIndex);
+				}
+			}
+		}
+	}
+
+	for (const TUniquePtr<FOpenLogicBatchColumn>& Column : Columns)
+	{
+		Column->SetNum(InstanceContexts.Num());
+	}
+
+	return bCompiled;
+}
+
+int32 UOpenLogicBatchedGraph::AddInstance(UObject* Context)
+{
+	if (ExecutionDepth > 0)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[UOpenLogicBatchedGraph::AddInstance] Cannot add an instance while the graph runs."));
+		return INDEX_NONE;
+	}
+
+	const int32 Instance = InstanceContexts.Add(Context);
+	AllInstances.Add(Instance);
+
+	for (const TUniquePtr<FOpenLogicBatchColumn>& Column : Columns)
+	{
+		Column->SetNum(InstanceContexts.Num());
+	}
+
+	return Instance;
+}
+
+void UOpenLogicBatchedGraph::RemoveInstance(int32 Instance)
+{
+	if (ExecutionDepth > 0)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[UOpenLogicBatchedGraph::RemoveInstance] Cannot remove an instance while the graph runs."));
+		return;
+	}
+
+	if (!InstanceContexts.IsValidIndex(Instance))
+	{
+		return;
+	}
+
+	InstanceContexts.RemoveAtSwap(Instance);
+	AllInstances.Pop();
+
+	for (const TUniquePtr<FOpenLogicBatchColumn>& Column : Columns)
+	{
+		Column->RemoveAtSwap(Instance);
+	}
+}
+
+UObject* UOpenLogicBatchedGraph::GetInstanceContext(int32 Instance) const
+{
+	return InstanceContexts.IsValidIndex(Instance) ? InstanceContexts[Instance].Get() : nullptr;
+}
+
+bool UOpenLogicBatchedGraph::TriggerEvent(TSubclassOf<UOpenLogicTask> EventClass)
+{
+	return TriggerEventForInstances(EventClass, AllInstances);
+}
+
+bool UOpenLogicBatchedGraph::TriggerEventForInstances(const UClass* EventClass, TConstArrayView<int32> Instances)
+{
+	const TArray<int32>* EventNodeIndices = bCompiled && EventClass ? EventNodes.Find(EventClass) : nullptr;
+	if (!EventNodeIndices)
+	{
+		return false;
+	}
+
+	ExecutionDepth++;
+
+	for (const int32 NodeIndex : *EventNodeIndices)
+	{
+		ActivateNode(NodeIndex, Instances, NAME_None);
+	}
+
+	ExecutionDepth--;
+	return true;
+}
+
+FOpenLogicBatchColumn* UOpenLogicBatchedGraph::FindPinColumn(const FGuid& NodeID, int32 PinIndex, bool bIsInput)
+{
+	const int32* NodeIndex = NodeIndices.Find(NodeID);
+	return NodeIndex ? GetNodeColumn(*NodeIndex, PinIndex, bIsInput) : nullptr;
+}
+
+FOpenLogicBatchColumn* UOpenLogicBatchedGraph::GetNodeColumn(int32 NodeIndex, int32 PinIndex, bool bIsInput)
+{
+	if (!Nodes.IsValidIndex(NodeIndex))
+	{
+		return nullptr;
+	}
+
+	const TArray<int32>& PinColumns = bIsInput ? Nodes[NodeIndex].InputColumns : Nodes[NodeIndex].OutputColumns;
+	if (!PinColumns.IsValidIndex(PinIndex) || PinColumns[PinIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return Columns[PinColumns[PinIndex]].Get();
+}
+
+void UOpenLogicBatchedGraph::ExecutePin(int32 NodeIndex, int32 PinIndex, TConstArrayView<int32> Instances)
+{
+	if (!Nodes.IsValidIndex(NodeIndex) || Instances.IsEmpty())
+	{
+		return;
+	}
+
+	const FOpenLogicBatchNode& Node = Nodes[NodeIndex];
+	if (!Node.FlowTargets.IsValidIndex(PinIndex) || Node.FlowTargets[PinIndex] == INDEX_NONE)
+	{
+		return;
+	}
+
+	ExecutionDepth++;
+	ActivateNode(Node.FlowTargets[PinIndex], Instances, Node.FlowTargetPins[PinIndex]);
+	ExecutionDepth--;
+}
+
+void UOpenLogicBatchedGraph::ActivateNode(int32 NodeIndex, TConstArrayView<int32> Instances, FName PinName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_ActivateBatchedNode);
+
+	if (Instances.IsEmpty())
+	{
+		return;
+	}
+
+	const FOpenLogicBatchNode& Node = Nodes[NodeIndex];
+
+	// Data nodes are evaluated again for every node reading them, like ReevaluateOnDemand
+	for (const int32 Dependency : Node.DataDependencies)
+	{
+		ActivateNode(Dependency, Instances, NAME_None);
+	}
+
+	OPENLOGIC_COUNTER_INC(NodeActivations, 1);
+
+	if (Node.bIsEvent && !Node.Task->bSupportsBatchedExecution)
+	{
+		ExecutePin(NodeIndex, Node.EntryPin, Instances);
+		return;
+	}
+
+	FOpenLogicBatchContext Context(this, NodeIndex, Instances, PinName);
+	Node.Task->OnTaskActivatedBatch(Context);
+}
+
+int32 UOpenLogicBatchedGraph::AddColumn(const FOpenLogicPinData& PinData, const TSharedPtr<void>& DefaultValue)
+{
+	if (!PinData.PropertyClass)
+	{
+		return INDEX_NONE;
+	}
+
+	const UOpenLogicProperty* PropertyObject = PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>();
+
+	if (const FProperty* ValueProperty = PropertyObject->GetValueProperty())
+	{
+		return Columns.Add(MakeUnique<FOpenLogicBatchColumn>(ValueProperty, DefaultValue));
+	}
+
+	// Built-in property classes describe their values by their underlying type instead
+	if (!PropertyObject->bResolvesTypeDynamically)
+	{
+		switch (PropertyObject->UnderlyingType)
+		{
+		case EOpenLogicUnderlyingType::Boolean:
+		case EOpenLogicUnderlyingType::Byte:
+		case EOpenLogicUnderlyingType::Int:
+		case EOpenLogicUnderlyingType::Enum:
+		case EOpenLogicUnderlyingType::Float:
+		case EOpenLogicUnderlyingType::Double:
+			return Columns.Add(MakeUnique<FOpenLogicBatchColumn>(nullptr, PropertyObject->GetValueSize(), DefaultValue));
+		case EOpenLogicUnderlyingType::Struct:
+			if (PropertyObject->StructType)
+			{
+				return Columns.Add(MakeUnique<FOpenLogicBatchColumn>(PropertyObject->StructType, PropertyObject->StructType->GetStructureSize(), DefaultValue));
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	UE_LOG(OpenLogicLog, Warning, TEXT("[UOpenLogicBatchedGraph::AddColumn] %s has no Value property, pin %s is not batched."), *PinData.PropertyClass->GetName(), *PinData.PinName.ToString());
+	return INDEX_NONE;
+}
+
+void UOpenLogicBatchedGraph::ResetColumns()
+{
+	Columns.Reset();
+}
+
+void UOpenLogicBatchedGraph::BeginDestroy()
+{
+	ResetColumns();
+
+	Super::BeginDestroy();
+}
+
+void UOpenLogicBatchedGraph::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	const UOpenLogicBatchedGraph* This = CastChecked<UOpenLogicBatchedGraph>(InThis);
+
+	for (const TUniquePtr<FOpenLogicBatchColumn>& Column : This->Columns)
+	{
+		Column->AddReferencedObjects(Collector);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
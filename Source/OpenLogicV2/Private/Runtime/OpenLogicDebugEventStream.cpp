@@ -0,0 +1,58 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Runtime/OpenLogicDebugEventStream.h"
+
+FOpenLogicDebugEventStream::FOpenLogicDebugEventStream(int32 InCapacity)
+{
+	Events.SetNum(FMath::Max(InCapacity, 1));
+}
+
+void FOpenLogicDebugEventStream::Push(EOpenLogicNodeDebugEventType Type, const FGuid& NodeID, int32 HandleIndex, UOpenLogicTask* Task)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	const int32 Capacity = Events.Num();
+
+	// Overwrite the oldest event once full
+	if (Count == Capacity)
+	{
+		Head = (Head + 1) % Capacity;
+		Count--;
+		DroppedCount++;
+	}
+
+	FOpenLogicNodeDebugEvent& Event = Events[(Head + Count) % Capacity];
+	Event.Type = Type;
+	Event.NodeID = NodeID;
+	Event.HandleIndex = HandleIndex;
+	Event.Task = Task;
+	Event.Timestamp = FPlatformTime::Seconds();
+
+	Count++;
+}
+
+int32 FOpenLogicDebugEventStream::Drain(TArray<FOpenLogicNodeDebugEvent>& OutEvents)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const int32 Capacity = Events.Num();
+
+	OutEvents.Reset(Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		OutEvents.Add(Events[(Head + Index) % Capacity]);
+	}
+
+	const int32 Dropped = DroppedCount;
+
+	Head = 0;
+	Count = 0;
+	DroppedCount = 0;
+
+	return Dropped;
+}
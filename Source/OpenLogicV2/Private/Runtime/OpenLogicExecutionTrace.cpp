@@ -0,0 +1,511 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Runtime/OpenLogicExecutionTrace.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/UObjectIterator.h"
+#include "OpenLogicV2.h"
+
+namespace OpenLogicExecutionTrace
+{
+	// "OLTR"
+	constexpr uint32 Magic = 0x52544C4F;
+	constexpr int32 Version = 1;
+}
+
+FArchive& operator<<(FArchive& Ar, FOpenLogicTraceRecord& Record)
+{
+	// The type and the inline flag share a byte, indices are stored packed and off by one so INDEX_NONE fits
+	uint8 TypeAndFlags = static_cast<uint8>(Record.Type) | (Record.bInline ? 0x80 : 0);
+	uint32 HandleIndex = static_cast<uint32>(Record.HandleIndex + 1);
+	uint32 NodeIndex = static_cast<uint32>(Record.NodeIndex + 1);
+	uint32 PinIndex = static_cast<uint32>(Record.PinIndex + 1);
+
+	Ar << TypeAndFlags;
+	Ar.SerializeIntPacked(HandleIndex);
+	Ar.SerializeIntPacked(NodeIndex);
+	Ar.SerializeIntPacked(PinIndex);
+	Ar << Record.Timestamp;
+
+	if (Ar.IsLoading())
+	{
+		Record.Type = static_cast<EOpenLogicTraceRecordType>(TypeAndFlags & 0x7F);
+		Record.bInline = (TypeAndFlags & 0x80) != 0;
+		Record.HandleIndex = static_cast<int32>(HandleIndex) - 1;
+		Record.NodeIndex = static_cast<int32>(NodeIndex) - 1;
+		Record.PinIndex = static_cast<int32>(PinIndex) - 1;
+	}
+
+	if (Record.Type == EOpenLogicTraceRecordType::SetOutput)
+	{
+		Ar << Record.Value;
+	}
+
+	return Ar;
+}
+
+void FOpenLogicExecutionTrace::Serialize(FArchive& Ar)
+{
+	uint32 FileMagic = OpenLogicExecutionTrace::Magic;
+	int32 FileVersion = OpenLogicExecutionTrace::Version;
+
+	Ar << FileMagic;
+	Ar << FileVersion;
+
+	if (Ar.IsLoading() && (FileMagic != OpenLogicExecutionTrace::Magic || FileVersion > OpenLogicExecutionTrace::Version))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	FOpenLogicGraphData::StaticStruct()->SerializeItem(Ar, &GraphData, nullptr);
+
+	Ar << NodeTable;
+	Ar << Duration;
+	Ar << Records;
+}
+
+bool FOpenLogicExecutionTrace::SaveToFile(const FString& FilePath)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data, true);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	Serialize(Ar);
+
+	if (Ar.IsError() || !FFileHelper::SaveArrayToFile(Data, *FilePath))
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FOpenLogicExecutionTrace::SaveToFile] Failed to write %s."), *FilePath);
+		return false;
+	}
+
+	UE_LOG(OpenLogicLog, Log, TEXT("Execution trace written to %s (%d records, %d bytes)."), *FilePath, Records.Num(), Data.Num());
+	return true;
+}
+
+bool FOpenLogicExecutionTrace::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FOpenLogicExecutionTrace::LoadFromFile] Failed to read %s."), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Data, true);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+
+	Serialize(Ar);
+
+	if (Ar.IsError())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FOpenLogicExecutionTrace::LoadFromFile] %s is not a valid execution trace."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+FString FOpenLogicExecutionTrace::GetDefaultFilePath(const FString& GraphName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("OpenLogic") / TEXT("Traces") / FString::Printf(TEXT("%s_%s.oltrace"), *GraphName, *FDateTime::Now().ToString());
+}
+
+bool FOpenLogicExecutionTrace::IsRecordedTask(const UOpenLogicTask* TaskInstance)
+{
+	if (!TaskInstance)
+	{
+		return false;
+	}
+
+	return TaskInstance->TaskData.Type == ENodeType::Event || TaskInstance->bIsLatent || TaskInstance->bIsNonDeterministic;
+}
+
+void FOpenLogicExecutionRecorder::Start(const FOpenLogicGraphData& GraphData)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Trace = FOpenLogicExecutionTrace();
+	Trace.GraphData = GraphData;
+	NodeIndices.Reset();
+	ActivationStack.Reset();
+	StartTime = FPlatformTime::Seconds();
+
+	bRecording = true;
+}
+
+FOpenLogicExecutionTrace FOpenLogicExecutionRecorder::Stop()
+{
+	bRecording = false;
+
+	FScopeLock ScopeLock(&Lock);
+
+	Trace.Duration = FPlatformTime::Seconds() - StartTime;
+
+	FOpenLogicExecutionTrace Result = MoveTemp(Trace);
+	Trace = FOpenLogicExecutionTrace();
+	NodeIndices.Reset();
+	ActivationStack.Reset();
+
+	return Result;
+}
+
+void FOpenLogicExecutionRecorder::RecordHandle(EOpenLogicTraceRecordType Type, int32 HandleIndex, const FGuid& NodeID)
+{
+	FOpenLogicTraceRecord Record;
+	Record.Type = Type;
+	Record.HandleIndex = HandleIndex;
+
+	FScopeLock ScopeLock(&Lock);
+	AddRecord(Record, NodeID);
+}
+
+void FOpenLogicExecutionRecorder::RecordActivationBegin(int32 HandleIndex, const FGuid& NodeID)
+{
+	FOpenLogicTraceRecord Record;
+	Record.Type = EOpenLogicTraceRecordType::Activate;
+	Record.HandleIndex = HandleIndex;
+
+	FScopeLock ScopeLock(&Lock);
+	ActivationStack.Emplace(HandleIndex, NodeID);
+	AddRecord(Record, NodeID);
+}
+
+void FOpenLogicExecutionRecorder::RecordActivationEnd(int32 HandleIndex, const FGuid& NodeID)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (ActivationStack.Num() > 0 && ActivationStack.Last() == TPair<int32, FGuid>(HandleIndex, NodeID))
+	{
+		ActivationStack.Pop();
+	}
+}
+
+void FOpenLogicExecutionRecorder::RecordOutput(int32 HandleIndex, const FGuid& NodeID, int32 PinIndex, const UOpenLogicProperty* Property, const TSharedPtr<void>& Value)
+{
+	FOpenLogicTraceRecord Record;
+	Record.Type = EOpenLogicTraceRecordType::SetOutput;
+	Record.HandleIndex = HandleIndex;
+	Record.PinIndex = PinIndex;
+
+	// Serialized before taking the lock, values can be large
+	FMemoryWriter Writer(Record.Value, true);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	TSharedPtr<void> SerializedValue = Value;
+	if (!Property || !Property->SerializeValue(Ar, SerializedValue))
+	{
+		Record.Value.Reset();
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	AddRecord(Record, NodeID);
+}
+
+void FOpenLogicExecutionRecorder::RecordThen(int32 HandleIndex, const FGuid& NodeID, int32 PinIndex)
+{
+	FOpenLogicTraceRecord Record;
+	Record.Type = EOpenLogicTraceRecordType::Then;
+	Record.HandleIndex = HandleIndex;
+	Record.PinIndex = PinIndex;
+
+	FScopeLock ScopeLock(&Lock);
+	AddRecord(Record, NodeID);
+}
+
+void FOpenLogicExecutionRecorder::RecordComplete(int32 HandleIndex, const FGuid& NodeID)
+{
+	FOpenLogicTraceRecord Record;
+	Record.Type = EOpenLogicTraceRecordType::Complete;
+	Record.HandleIndex = HandleIndex;
+
+	FScopeLock ScopeLock(&Lock);
+	AddRecord(Record, NodeID);
+}
+
+void FOpenLogicExecutionRecorder::AddRecord(FOpenLogicTraceRecord& Record, const FGuid& NodeID)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	Record.Timestamp = FPlatformTime::Seconds() - StartTime;
+
+	if (NodeID.IsValid())
+	{
+		if (const int32* NodeIndex = NodeIndices.Find(NodeID))
+		{
+			Record.NodeIndex = *NodeIndex;
+		}
+		else
+		{
+			Record.NodeIndex = Trace.NodeTable.Add(NodeID);
+			NodeIndices.Add(NodeID, Record.NodeIndex);
+		}
+	}
+
+	switch (Record.Type)
+	{
+	case EOpenLogicTraceRecordType::Activate:
+		Record.bInline = true;
+		break;
+	case EOpenLogicTraceRecordType::SetOutput:
+	case EOpenLogicTraceRecordType::Then:
+	case EOpenLogicTraceRecordType::Complete:
+		Record.bInline = ActivationStack.Num() > 0 && ActivationStack.Last() == TPair<int32, FGuid>(Record.HandleIndex, NodeID);
+		break;
+	default:
+		break;
+	}
+
+	Trace.Records.Add(MoveTemp(Record));
+}
+
+FOpenLogicExecutionReplayer::FOpenLogicExecutionReplayer(UOpenLogicRuntimeGraph* InGraph, const FOpenLogicExecutionTrace& InTrace)
+	: Graph(InGraph)
+	, Trace(InTrace)
+{
+}
+
+bool FOpenLogicExecutionReplayer::Run()
+{
+	if (!Graph)
+	{
+		return false;
+	}
+
+	while (Trace.Records.IsValidIndex(Cursor))
+	{
+		const FOpenLogicTraceRecord& Record = Trace.Records[Cursor++];
+
+		if (Record.Type == EOpenLogicTraceRecordType::Activate)
+		{
+			// The replay never reached this activation, skip what happened inside it
+			DivergenceCount++;
+			UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicExecutionReplayer] Node %s was activated at %.3fs in the recording but not during the replay."), *GetNodeID(Record).ToString(), Record.Timestamp);
+
+			while (Trace.Records.IsValidIndex(Cursor) && Trace.Records[Cursor].bInline && Trace.Records[Cursor].Type != EOpenLogicTraceRecordType::Activate)
+			{
+				Cursor++;
+			}
+			continue;
+		}
+
+		ApplyRecord(Record);
+	}
+
+	return DivergenceCount == 0;
+}
+
+void FOpenLogicExecutionReplayer::ReplayActivation(UOpenLogicTask* TaskInstance, int32 HandleIndex)
+{
+	if (!IsValid(TaskInstance))
+	{
+		return;
+	}
+
+	const FOpenLogicTraceRecord* Activation = Trace.Records.IsValidIndex(Cursor) ? &Trace.Records[Cursor] : nullptr;
+	const int32* ReplayHandleIndex = Activation ? HandleIndices.Find(Activation->HandleIndex) : nullptr;
+
+	if (!Activation || Activation->Type != EOpenLogicTraceRecordType::Activate || GetNodeID(*Activation) != TaskInstance->GetGuid() || !ReplayHandleIndex || *ReplayHandleIndex != HandleIndex)
+	{
+		DivergenceCount++;
+		UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicExecutionReplayer] %s was activated during the replay but not at this point of the recording."), *TaskInstance->GetName());
+		return;
+	}
+
+	Cursor++;
+
+	// Apply what the task did before returning from its activation; anything it does later is a top-level record
+	while (Trace.Records.IsValidIndex(Cursor))
+	{
+		const FOpenLogicTraceRecord& Record = Trace.Records[Cursor];
+		if (!Record.bInline || Record.Type == EOpenLogicTraceRecordType::Activate || Record.NodeIndex != Activation->NodeIndex || Record.HandleIndex != Activation->HandleIndex)
+		{
+			break;
+		}
+
+		Cursor++;
+		ApplyRecord(Record);
+	}
+}
+
+void FOpenLogicExecutionReplayer::ApplyRecord(const FOpenLogicTraceRecord& Record)
+{
+	switch (Record.Type)
+	{
+	case EOpenLogicTraceRecordType::CreateHandle:
+		{
+			const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = Graph->CreateExecutionHandle(GetNodeID(Record));
+			if (!ExecutionHandle.IsValid())
+			{
+				DivergenceCount++;
+				UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicExecutionReplayer] Failed to create an execution handle for node %s."), *GetNodeID(Record).ToString());
+				break;
+			}
+
+			HandleIndices.Add(Record.HandleIndex, ExecutionHandle->HandleIndex);
+			break;
+		}
+	case EOpenLogicTraceRecordType::ProcessHandle:
+	case EOpenLogicTraceRecordType::DestroyHandle:
+		{
+			const int32* ReplayHandleIndex = HandleIndices.Find(Record.HandleIndex);
+			TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = ReplayHandleIndex ? Graph->GetExecutionHandle(*ReplayHandleIndex) : nullptr;
+			if (!ExecutionHandle.IsValid())
+			{
+				break;
+			}
+
+			if (Record.Type == EOpenLogicTraceRecordType::ProcessHandle)
+			{
+				Graph->ProcessExecutionHandle(ExecutionHandle);
+			}
+			else
+			{
+				Graph->DestroyExecutionHandle(ExecutionHandle);
+				HandleIndices.Remove(Record.HandleIndex);
+			}
+			break;
+		}
+	case EOpenLogicTraceRecordType::SetOutput:
+	case EOpenLogicTraceRecordType::Then:
+	case EOpenLogicTraceRecordType::Complete:
+		{
+			UOpenLogicTask* TaskInstance = FindTaskInstance(Record);
+			if (!TaskInstance)
+			{
+				DivergenceCount++;
+				UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicExecutionReplayer] Node %s is not running at %.3fs of the recording."), *GetNodeID(Record).ToString(), Record.Timestamp);
+				break;
+			}
+
+			if (Record.Type == EOpenLogicTraceRecordType::Then)
+			{
+				Graph->Then(TaskInstance, Record.PinIndex);
+			}
+			else if (Record.Type == EOpenLogicTraceRecordType::Complete)
+			{
+				Graph->CompleteNode(TaskInstance);
+			}
+			else
+			{
+				const FOpenLogicPinData PinData = Graph->GetNodeData(TaskInstance->GetGuid()).GetOutputPinData(Record.PinIndex);
+				const UOpenLogicProperty* PropertyObject = PinData.PropertyClass ? PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+
+				FMemoryReader Reader(Record.Value, true);
+				FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+
+				TSharedPtr<void> Value;
+				if (!PropertyObject || Record.Value.IsEmpty() || !PropertyObject->SerializeValue(Ar, Value))
+				{
+					UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicExecutionReplayer] No recorded value for pin %s of %s."), *PinData.PinName.ToString(), *TaskInstance->GetName());
+					break;
+				}
+
+				Graph->SetDataPropertyValue(TaskInstance, PinData.PinName, Value);
+			}
+			break;
+		}
+	default:
+		break;
+	}
+}
+
+UOpenLogicTask* FOpenLogicExecutionReplayer::FindTaskInstance(const FOpenLogicTraceRecord& Record) const
+{
+	const int32* ReplayHandleIndex = HandleIndices.Find(Record.HandleIndex);
+	const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = ReplayHandleIndex ? Graph->GetExecutionHandle(*ReplayHandleIndex) : nullptr;
+	if (!ExecutionHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FOpenLogicRuntimeNode>* RuntimeNode = ExecutionHandle->RuntimeNodes.Find(GetNodeID(Record));
+	if (!RuntimeNode || !RuntimeNode->IsValid())
+	{
+		return nullptr;
+	}
+
+	return (*RuntimeNode)->TaskInstance;
+}
+
+FGuid FOpenLogicExecutionReplayer::GetNodeID(const FOpenLogicTraceRecord& Record) const
+{
+	return Trace.NodeTable.IsValidIndex(Record.NodeIndex) ? Trace.NodeTable[Record.NodeIndex] : FGuid();
+}
+
+static FAutoConsoleCommand ExecutionTraceStartCommand(
+	TEXT("OpenLogic.ExecutionTrace.Start"),
+	TEXT("Starts recording an execution trace on every runtime graph."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		int32 GraphCount = 0;
+		for (TObjectIterator<UOpenLogicRuntimeGraph> It; It; ++It)
+		{
+			It->StartRecording();
+			GraphCount++;
+		}
+
+		UE_LOG(OpenLogicLog, Log, TEXT("Recording execution traces on %d runtime graph(s)."), GraphCount);
+	}));
+
+static FAutoConsoleCommand ExecutionTraceStopCommand(
+	TEXT("OpenLogic.ExecutionTrace.Stop"),
+	TEXT("Stops recording and writes one execution trace per runtime graph. Usage: OpenLogic.ExecutionTrace.Stop [Directory]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		for (TObjectIterator<UOpenLogicRuntimeGraph> It; It; ++It)
+		{
+			if (!It->IsRecording())
+			{
+				continue;
+			}
+
+			const FString FilePath = FOpenLogicExecutionTrace::GetDefaultFilePath(It->GetName());
+			It->StopRecording(Args.Num() > 0 ? Args[0] / FPaths::GetCleanFilename(FilePath) : FilePath);
+		}
+	}));
+
+static FAutoConsoleCommand ExecutionTraceReplayCommand(
+	TEXT("OpenLogic.ExecutionTrace.Replay"),
+	TEXT("Replays an execution trace on a new runtime graph and reports how long it took. Usage: OpenLogic.ExecutionTrace.Replay <FilePath> [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(OpenLogicLog, Warning, TEXT("Usage: OpenLogic.ExecutionTrace.Replay <FilePath> [Iterations]"));
+			return;
+		}
+
+		FOpenLogicExecutionTrace Trace;
+		if (!Trace.LoadFromFile(Args[0]))
+		{
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 1;
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			UOpenLogicRuntimeGraph* Graph = NewObject<UOpenLogicRuntimeGraph>(GetTransientPackage());
+
+			const double StartTime = FPlatformTime::Seconds();
+			const bool bMatched = Graph->ReplayTrace(Trace);
+			const double ReplayTime = FPlatformTime::Seconds() - StartTime;
+
+			UE_LOG(OpenLogicLog, Log, TEXT("Replay %d/%d: %d records in %.3f ms (recorded over %.3f s)%s"),
+				Iteration + 1, Iterations, Trace.Records.Num(), ReplayTime * 1000.0, Trace.Duration, bMatched ? TEXT("") : TEXT(", diverged from the recording"));
+
+			Graph->DestroyWorker();
+			Graph->MarkAsGarbage();
+		}
+	}));
@@ -2,6 +2,9 @@
 
 #include "Runtime/OpenLogicGraphRunnable.h"
 #include "Runtime/OpenLogicRuntimeEventContext.h"
+#include "Profiling/OpenLogicTrace.h"
+#include "Profiling/OpenLogicStats.h"
+#include "UObject/GarbageCollection.h"
 
 bool FOpenLogicGraphRunnable::Init()
 {
@@ -33,21 +36,99 @@ void FOpenLogicGraphRunnable::Stop()
 
 void FOpenLogicGraphRunnable::AddExecutionHandle(const FOpenLogicQueuedExecutionHandle& QueueData)
 {
+	const int32 PriorityIndex = FMath::Clamp(static_cast<int32>(QueueData.Priority), 0, OpenLogicExecutionPriorityCount - 1);
+
+	FOpenLogicQueuedExecutionHandle QueuedHandle = QueueData;
+	QueuedHandle.EnqueueCycles = FPlatformTime::Cycles64();
+
 	FScopeLock Lock(&QueueLock);
-	Queue.Enqueue(QueueData);
+	Queues[PriorityIndex].Enqueue(QueuedHandle);
+	QueueCounters[PriorityIndex].RecordEnqueue();
 
 	QueueEvent->Trigger();
 }
 
+void FOpenLogicGraphRunnable::GetQueueMetrics(TArray<FOpenLogicPriorityQueueMetrics>& OutMetrics) const
+{
+	OutMetrics.Reset(OpenLogicExecutionPriorityCount);
+
+	for (int32 PriorityIndex = 0; PriorityIndex < OpenLogicExecutionPriorityCount; PriorityIndex++)
+	{
+		OutMetrics.Add(QueueCounters[PriorityIndex].GetMetrics(static_cast<EOpenLogicExecutionPriority>(PriorityIndex)));
+	}
+}
+
+bool FOpenLogicGraphRunnable::DequeueNext(FOpenLogicQueuedExecutionHandle& OutQueueData)
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	int32 SelectedIndex = INDEX_NONE;
+	double SelectedPriority = 0.0;
+
+	// Only the oldest handle of each queue can have aged the most, ties go to the higher priority
+	for (int32 PriorityIndex = OpenLogicExecutionPriorityCount - 1; PriorityIndex >= 0; PriorityIndex--)
+	{
+		const FOpenLogicQueuedExecutionHandle* OldestHandle = Queues[PriorityIndex].Peek();
+		if (!OldestHandle)
+		{
+			continue;
+		}
+
+		const double WaitSeconds = FPlatformTime::ToSeconds64(NowCycles - OldestHandle->EnqueueCycles);
+		const double AgedPriority = PriorityIndex + (PriorityAgingSeconds > 0.0 ? WaitSeconds / PriorityAgingSeconds : 0.0);
+
+		if (SelectedIndex == INDEX_NONE || AgedPriority > SelectedPriority)
+		{
+			SelectedIndex = PriorityIndex;
+			SelectedPriority = AgedPriority;
+		}
+	}
+
+	if (SelectedIndex == INDEX_NONE || !Queues[SelectedIndex].Dequeue(OutQueueData))
+	{
+		return false;
+	}
+
+	const uint64 WaitMicroseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(NowCycles - OutQueueData.EnqueueCycles) * 1000000.0);
+	QueueCounters[SelectedIndex].RecordDequeue(WaitMicroseconds);
+
+	return true;
+}
+
+bool FOpenLogicGraphRunnable::AreQueuesEmpty() const
+{
+	for (const TQueue<FOpenLogicQueuedExecutionHandle, EQueueMode::Mpsc>& Queue : Queues)
+	{
+		if (!Queue.IsEmpty())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void FOpenLogicGraphRunnable::ProcessQueue()
 {
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_ProcessQueue);
+	CSV_SCOPED_TIMING_STAT(OpenLogic, ProcessQueue);
+
 	FOpenLogicQueuedExecutionHandle QueuedNode;
 	bool bHasProcessed = false;
 
-	while (Queue.Dequeue(QueuedNode))
+	while (DequeueNext(QueuedNode))
 	{
 		bHasProcessed = true;
 
+		OPENLOGIC_TRACE_QUEUE_DEQUEUE(Graph, QueuedNode.HandleIndex);
+		OPENLOGIC_COUNTER_DEC(QueuedActivations, 1);
+
+		// Graph data patches wait for the handle to finish running
+		FScopeLock ProcessScopeLock(&ProcessLock);
+
+		// Task instances are created, pooled and run on this thread, the garbage collector must not run meanwhile
+		FGCScopeGuard GCGuard;
+
 		TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle= Graph->GetExecutionHandle(QueuedNode.HandleIndex);
 		if (!ExecutionHandle.IsValid())
 		{
@@ -66,7 +147,7 @@ void FOpenLogicGraphRunnable::ProcessQueue()
 	if (bHasProcessed)
 	{
 		FScopeLock Lock(&QueueLock);
-		if (Queue.IsEmpty())
+		if (AreQueuesEmpty())
 		{
 			QueueEvent->Reset();
 		}
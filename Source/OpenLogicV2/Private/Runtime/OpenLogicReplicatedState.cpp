@@ -0,0 +1,188 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Runtime/OpenLogicReplicatedState.h"
+#include "Runtime/OpenLogicRuntimeGraphComponent.h"
+#include "UObject/CoreNet.h"
+
+FOpenLogicReplicatedPinValue FOpenLogicReplicatedPinValue::FromValue(int32 InPinIndex, const UOpenLogicProperty* Property, const void* Value)
+{
+	FOpenLogicReplicatedPinValue PinValue;
+	PinValue.PinIndex = InPinIndex;
+
+	if (!Property || !Value)
+	{
+		return PinValue;
+	}
+
+	PinValue.Type = Property->UnderlyingType;
+
+	switch (PinValue.Type)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		PinValue.Number = *static_cast<const bool*>(Value) ? 1.0 : 0.0;
+		break;
+	case EOpenLogicUnderlyingType::Byte:
+		PinValue.Number = *static_cast<const uint8*>(Value);
+		break;
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		PinValue.Number = *static_cast<const int32*>(Value);
+		break;
+	case EOpenLogicUnderlyingType::Float:
+		PinValue.Number = *static_cast<const float*>(Value);
+		break;
+	case EOpenLogicUnderlyingType::Double:
+		PinValue.Number = *static_cast<const double*>(Value);
+		break;
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		PinValue.Object = *static_cast<UObject* const*>(Value);
+		break;
+	default:
+		PinValue.Text = Property->ExportValueToString(Value);
+		break;
+	}
+
+	// Quantize on the server too, so unchanged values compare equal to what clients already have
+	if (PinValue.Type == EOpenLogicUnderlyingType::Float || PinValue.Type == EOpenLogicUnderlyingType::Double)
+	{
+		const double Steps = FMath::RoundToDouble(PinValue.Number / QuantizationStep);
+		if (FMath::Abs(Steps) <= MAX_int32)
+		{
+			PinValue.Number = Steps * QuantizationStep;
+		}
+	}
+
+	return PinValue;
+}
+
+bool FOpenLogicReplicatedPinValue::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint32 PackedPinIndex = static_cast<uint32>(PinIndex + 1);
+	Ar.SerializeIntPacked(PackedPinIndex);
+
+	uint8 PackedType = static_cast<uint8>(Type);
+	Ar << PackedType;
+
+	if (Ar.IsLoading())
+	{
+		PinIndex = static_cast<int32>(PackedPinIndex) - 1;
+		Type = static_cast<EOpenLogicUnderlyingType>(PackedType);
+		Number = 0.0;
+		Object = nullptr;
+		Text.Reset();
+	}
+
+	switch (Type)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		{
+			uint8 bValue = Number != 0.0;
+			Ar.SerializeBits(&bValue, 1);
+			Number = bValue ? 1.0 : 0.0;
+			break;
+		}
+	case EOpenLogicUnderlyingType::Byte:
+		{
+			uint8 Value = static_cast<uint8>(Number);
+			Ar << Value;
+			Number = Value;
+			break;
+		}
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		{
+			// Zigzag encoding keeps small negative values small
+			const int32 Value = static_cast<int32>(Number);
+			uint32 Packed = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+			Ar.SerializeIntPacked(Packed);
+			Number = static_cast<int32>((Packed >> 1) ^ (0u - (Packed & 1)));
+			break;
+		}
+	case EOpenLogicUnderlyingType::Float:
+	case EOpenLogicUnderlyingType::Double:
+		{
+			const double Steps = FMath::RoundToDouble(Number / QuantizationStep);
+			uint8 bQuantized = FMath::Abs(Steps) <= MAX_int32;
+			Ar.SerializeBits(&bQuantized, 1);
+
+			if (bQuantized)
+			{
+				const int32 Value = static_cast<int32>(Steps);
+				uint32 Packed = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+				Ar.SerializeIntPacked(Packed);
+				Number = static_cast<int32>((Packed >> 1) ^ (0u - (Packed & 1))) * QuantizationStep;
+			}
+			else
+			{
+				Ar << Number;
+			}
+			break;
+		}
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		{
+			UObject* Value = Object;
+			bOutSuccess = Map ? Map->SerializeObject(Ar, UObject::StaticClass(), Value) : false;
+			Object = Value;
+			break;
+		}
+	default:
+		Ar << Text;
+		break;
+	}
+
+	return true;
+}
+
+void FOpenLogicReplicatedNodeState::PostReplicatedAdd(const FOpenLogicReplicatedGraphState& InArraySerializer)
+{
+	InArraySerializer.NodeIndices.Add(NodeID, static_cast<int32>(this - InArraySerializer.Nodes.GetData()));
+
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedNodeState(*this);
+	}
+}
+
+void FOpenLogicReplicatedNodeState::PostReplicatedChange(const FOpenLogicReplicatedGraphState& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleReplicatedNodeState(*this);
+	}
+}
+
+bool FOpenLogicReplicatedGraphState::SetNodeState(const FGuid& NodeID, EOpenLogicTaskState TaskState, TArray<FOpenLogicReplicatedPinValue>&& PinValues)
+{
+	if (const int32* NodeIndex = NodeIndices.Find(NodeID))
+	{
+		FOpenLogicReplicatedNodeState& NodeState = Nodes[*NodeIndex];
+		if (NodeState.TaskState == TaskState && NodeState.PinValues == PinValues)
+		{
+			return false;
+		}
+
+		NodeState.TaskState = TaskState;
+		NodeState.PinValues = MoveTemp(PinValues);
+		MarkItemDirty(NodeState);
+		return true;
+	}
+
+	FOpenLogicReplicatedNodeState& NodeState = Nodes.AddDefaulted_GetRef();
+	NodeState.NodeID = NodeID;
+	NodeState.TaskState = TaskState;
+	NodeState.PinValues = MoveTemp(PinValues);
+
+	NodeIndices.Add(NodeID, Nodes.Num() - 1);
+	MarkItemDirty(NodeState);
+	return true;
+}
+
+const FOpenLogicReplicatedNodeState* FOpenLogicReplicatedGraphState::FindNodeState(const FGuid& NodeID) const
+{
+	const int32* NodeIndex = NodeIndices.Find(NodeID);
+	return NodeIndex && Nodes.IsValidIndex(*NodeIndex) ? &Nodes[*NodeIndex] : nullptr;
+}
@@ -122,7 +122,15 @@ void UOpenLogicRuntimeEventContext::ProcessNodeByGuid(FGuid NodeGuid)
 	RuntimeNodes[NodeGuid] = RuntimeNode;
 	
 	// Alert the runtime graph that the node has been initialized
-	GetWorker()->OnNodeActivated.Broadcast(TaskInstance);
+	if (GetWorker()->OnNodeActivatedNative.IsBound())
+	{
+		GetWorker()->OnNodeActivatedNative.Broadcast(TaskInstance);
+	}
+
+	if (GetWorker()->OnNodeActivated.IsBound())
+	{
+		GetWorker()->OnNodeActivated.Broadcast(TaskInstance);
+	}
 	
 	// Execute the node
 	if (GetWorker()->GetThreadSettings().NodeExecutionThread == EOpenLogicRuntimeThreadType::GameThread)
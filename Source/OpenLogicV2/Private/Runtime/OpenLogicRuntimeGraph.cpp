@@ -3,21 +3,33 @@
 #include "Runtime/OpenLogicRuntimeGraph.h"
 #include "Runtime/OpenLogicRuntimeEventContext.h"
 #include "Runtime/OpenLogicGraphRunnable.h"
+#include "Runtime/OpenLogicDebugEventStream.h"
+#include "Profiling/OpenLogicTrace.h"
+#include "Profiling/OpenLogicMemory.h"
+#include "Profiling/OpenLogicStats.h"
+#include "Profiling/OpenLogicLatency.h"
+#include "Profiling/OpenLogicChromeTrace.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "Tasks/OpenLogicStructTask.h"
+#include "Subsystems/OpenLogicRuntimeSubsystem.h"
 #include "Templates/SubclassOf.h"
 #include "OpenLogicV2.h"
 #include "Async/Async.h"
 #include "Misc/OutputDeviceNull.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
-bool UOpenLogicRuntimeGraph::TriggerEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess, FOpenLogicGraphExecutionHandle& OutExecutionHandle)
+bool UOpenLogicRuntimeGraph::TriggerEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess, FOpenLogicGraphExecutionHandle& OutExecutionHandle, EOpenLogicExecutionPriority Priority)
 {
-	TArray<FGuid> EventImplementations = GetEventImplementations(TaskClass);
-	if (EventImplementations.IsEmpty())
+	const TArray<FGuid>* EventImplementations = FindEventImplementations(TaskClass);
+	if (!EventImplementations || EventImplementations->IsEmpty())
 	{
 		OutExecutionHandle = FOpenLogicGraphExecutionHandle();
 		return false;
 	}
 
-	TSharedPtr<FOpenLogicGraphExecutionHandle> EventExecutionHandle = CreateExecutionHandle(EventImplementations[0]);
+	TSharedPtr<FOpenLogicGraphExecutionHandle> EventExecutionHandle = CreateExecutionHandle((*EventImplementations)[0], Priority);
 	if (!EventExecutionHandle || !EventExecutionHandle->IsValid())
 	{
 		OutExecutionHandle = FOpenLogicGraphExecutionHandle();
@@ -33,13 +45,19 @@ bool UOpenLogicRuntimeGraph::TriggerEvent(TSubclassOf<UOpenLogicTask> TaskClass,
 	return true;
 }
 
-TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::TriggerAllEvents(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess)
+TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::TriggerAllEvents(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess, EOpenLogicExecutionPriority Priority)
 {
 	TArray<FOpenLogicGraphExecutionHandle> EventExecutionHandles;
 
-	for (FGuid NodeID : GetEventImplementations(TaskClass))
+	const TArray<FGuid>* EventImplementations = FindEventImplementations(TaskClass);
+	if (!EventImplementations)
 	{
-		TSharedPtr<FOpenLogicGraphExecutionHandle> EventExecutionHandle = CreateExecutionHandle(NodeID);
+		return EventExecutionHandles;
+	}
+
+	for (const FGuid& NodeID : *EventImplementations)
+	{
+		TSharedPtr<FOpenLogicGraphExecutionHandle> EventExecutionHandle = CreateExecutionHandle(NodeID, Priority);
 		if (!EventExecutionHandle || !EventExecutionHandle->IsValid())
 		{
 			continue;
@@ -56,14 +74,49 @@ TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::TriggerAllEvents(
 	return EventExecutionHandles;
 }
 
-TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::CreateExecutionHandle(FGuid NodeID)
+int32 UOpenLogicRuntimeGraph::CreateEventExecutionHandles(const UClass* EventClass, TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>>& OutExecutionHandles, EOpenLogicExecutionPriority Priority)
+{
+	const TArray<FGuid>* EventImplementations = FindEventImplementations(EventClass);
+	if (!EventImplementations)
+	{
+		return 0;
+	}
+
+	int32 CreatedHandles = 0;
+	for (const FGuid& NodeID : *EventImplementations)
+	{
+		TSharedPtr<FOpenLogicGraphExecutionHandle> EventExecutionHandle = CreateExecutionHandle(NodeID, Priority);
+		if (!EventExecutionHandle || !EventExecutionHandle->IsValid())
+		{
+			continue;
+		}
+
+		OutExecutionHandles.Add(EventExecutionHandle);
+		CreatedHandles++;
+	}
+
+	return CreatedHandles;
+}
+
+void UOpenLogicRuntimeGraph::ProcessExecutionHandles(TArrayView<TSharedPtr<FOpenLogicGraphExecutionHandle>> ExecutionHandles)
+{
+	for (TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle : ExecutionHandles)
+	{
+		ProcessExecutionHandle(ExecutionHandle);
+	}
+}
+
+TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::CreateExecutionHandle(FGuid NodeID, EOpenLogicExecutionPriority Priority)
 {
-	if (!NodeID.IsValid() || !GetGraphData().Nodes.Contains(NodeID))
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	const FOpenLogicNode* NodeData = NodeID.IsValid() ? WorkerGraphData.Nodes.Find(NodeID) : nullptr;
+	if (!NodeData)
 	{
 		return nullptr;
 	}
 
-	TSoftClassPtr<UOpenLogicTask> TaskClass = GetNodeData(NodeID).TaskClass;
+	TSoftClassPtr<UOpenLogicTask> TaskClass = NodeData->TaskClass;
 
 	if (!TaskClass.IsValid())
 	{
@@ -75,8 +128,29 @@ TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::CreateExecuti
 	NewHandle->TaskClass = TaskClass;
 	NewHandle->NodeID = NodeID;
 	NewHandle->RuntimeGraph = this;
+	NewHandle->Priority = Priority;
+	NewHandle->CancellationToken = FOpenLogicCancellationToken::Create();
+	NewHandle->TriggerCycles = FPlatformTime::Cycles64();
 
 	HandleRegistry.Add(NewHandle->HandleIndex, NewHandle);
+	OPENLOGIC_COUNTER_INC(ActiveHandles, 1);
+
+	if (ExecutionHandleTimeoutSeconds > 0.0f)
+	{
+		SetExecutionHandleTimeout(NewHandle, ExecutionHandleTimeoutSeconds);
+	}
+
+	OPENLOGIC_TRACE_HANDLE_CREATED(this, NewHandle->HandleIndex, NodeID);
+
+	if (IsRecording())
+	{
+		Recorder->RecordHandle(EOpenLogicTraceRecordType::CreateHandle, NewHandle->HandleIndex, NodeID);
+	}
+
+	if (FOpenLogicChromeTrace::IsRecording())
+	{
+		FOpenLogicChromeTrace::OutputHandleCreated(this, NewHandle->HandleIndex, TaskClass.GetAssetName());
+	}
 
 	return NewHandle;
 }
@@ -98,44 +172,81 @@ void UOpenLogicRuntimeGraph::DestroyExecutionHandle(TSharedPtr<FOpenLogicGraphEx
 		return;
 	}
 
+	if (IsRecording())
+	{
+		Recorder->RecordHandle(EOpenLogicTraceRecordType::DestroyHandle, ExecutionHandle->HandleIndex);
+	}
+
 	// Iterate over each runtime node in the execution handle
 	for (auto& NodePair : ExecutionHandle->RuntimeNodes)
 	{
-		TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = NodePair.Value;
-		if (!RuntimeNode.IsValid())
+		if (NodePair.Value.IsValid())
 		{
-			continue;
+			ReleaseRuntimeNode(*NodePair.Value);
 		}
+	}
 
-		UOpenLogicTask* TaskInstance = RuntimeNode->TaskInstance;
-		if (IsValid(TaskInstance))
-		{
-			// Cancel any latent actions if the task hasn't completed
-			if (RuntimeNode->TaskState != EOpenLogicTaskState::Completed)
-			{
-				if (UWorld* World = GetWorld())
-				{
-					World->GetLatentActionManager().RemoveActionsForObject(TaskInstance);
-				}
-				TaskInstance->OnTaskCompleted();	
-			}
+	if (HandleRegistry.Remove(ExecutionHandle->HandleIndex) > 0)
+	{
+		OPENLOGIC_COUNTER_DEC(ActiveHandles, 1);
+	}
+
+	{
+		FScopeLock Lock(&TimeoutLock);
+		HandleTimeouts.Remove(ExecutionHandle->HandleIndex);
+	}
+
+	OPENLOGIC_COUNTER_DEC(RuntimeNodes, ExecutionHandle->RuntimeNodes.Num());
+	ExecutionHandle->RuntimeNodes.Empty();
+
+	OPENLOGIC_TRACE_HANDLE_DESTROYED(this, ExecutionHandle->HandleIndex);
+}
 
-			// If the task is not persistent, return it to the pool
-			if (RuntimeNode->TaskInstance->NodeLifecycle != ENodeLifecycle::Persistent)
+void UOpenLogicRuntimeGraph::ReleaseRuntimeNode(FOpenLogicRuntimeNode& RuntimeNode)
+{
+	UOpenLogicTask* TaskInstance = RuntimeNode.TaskInstance;
+	if (IsValid(TaskInstance))
+	{
+		// Cancel any latent actions if the task hasn't completed
+		if (RuntimeNode.TaskState != EOpenLogicTaskState::Completed)
+		{
+			if (UWorld* World = GetWorld())
 			{
-				FOpenLogicTaskPool& TaskPool = TaskPools.FindOrAdd(RuntimeNode->TaskInstance->GetClass());
-				TaskPool.ReturnTaskInstance(TaskInstance);
+				World->GetLatentActionManager().RemoveActionsForObject(TaskInstance);
 			}
+			TaskInstance->OnTaskCompleted();	
 		}
 
-		// Clear out stored properties
-		RuntimeNode->InputProperties.Empty();
-		RuntimeNode->OutputProperties.Empty();
-		RuntimeNode->TaskInstance = nullptr;
+		// If the task is not persistent, return it to the pool
+		if (TaskInstance->NodeLifecycle != ENodeLifecycle::Persistent)
+		{
+			FScopeLock Lock(&TaskPoolLock);
+			FOpenLogicTaskPool& TaskPool = TaskPools.FindOrAdd(TaskInstance->GetClass());
+			TaskPool.ReturnTaskInstance(TaskInstance, MaxAvailableTasksPerClass);
+		}
+	}
+	else if (RuntimeNode.StructTask)
+	{
+		CompleteStructNode(RuntimeNode);
 	}
 
-	HandleRegistry.Remove(ExecutionHandle->HandleIndex);
-	ExecutionHandle->RuntimeNodes.Empty();
+	// Clear out stored properties
+	RuntimeNode.InputProperties.Empty();
+	RuntimeNode.OutputProperties.Empty();
+	RuntimeNode.OutputSlots.Empty();
+	RuntimeNode.InstanceData.Reset();
+	RuntimeNode.TaskInstance = nullptr;
+}
+
+void UOpenLogicRuntimeGraph::ReleasePersistentTask(UOpenLogicTask* TaskInstance)
+{
+	FScopeLock Lock(&TaskPoolLock);
+
+	FOpenLogicTaskPool* TaskPool = TaskInstance ? TaskPools.Find(TaskInstance->GetClass()) : nullptr;
+	if (TaskPool && TaskPool->ActiveTasks.Remove(TaskInstance) > 0)
+	{
+		OPENLOGIC_COUNTER_DEC(PooledTasksActive, 1);
+	}
 }
 
 void UOpenLogicRuntimeGraph::BP_DestroyExecutionHandle(FOpenLogicGraphExecutionHandle ExecutionHandle)
@@ -152,708 +263,2440 @@ void UOpenLogicRuntimeGraph::BP_DestroyExecutionHandle(FOpenLogicGraphExecutionH
 	}
 }
 
-TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::GetExecutionHandles() const
+bool UOpenLogicRuntimeGraph::CancelExecutionHandle(TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, EOpenLogicCancellationReason Reason)
 {
-	TArray<FOpenLogicGraphExecutionHandle> Handles;
-	Handles.Reserve(HandleRegistry.Num());
+	if (!ExecutionHandle.IsValid() || !ExecutionHandle->CancellationToken.Cancel(Reason))
+	{
+		return false;
+	}
 
-	for (auto& HandlePair : HandleRegistry)
+	// The token is set first so the tasks notified below cannot run anything else in this handle
+	TArray<TSharedPtr<FOpenLogicRuntimeNode>> PendingNodes;
+	for (const TPair<FGuid, TSharedPtr<FOpenLogicRuntimeNode>>& NodePair : ExecutionHandle->RuntimeNodes)
 	{
-		Handles.Add(*HandlePair.Value);
+		if (NodePair.Value.IsValid() && NodePair.Value->bPendingCompletion && IsValid(NodePair.Value->TaskInstance))
+		{
+			PendingNodes.Add(NodePair.Value);
+		}
 	}
 
-	return Handles;
+	for (const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode : PendingNodes)
+	{
+		if (RuntimeNode->TaskState == EOpenLogicTaskState::Running && IsValid(RuntimeNode->TaskInstance))
+		{
+			OPENLOGIC_COUNTER_INC(CancelledTasks, 1);
+			RuntimeNode->TaskInstance->OnTaskCancelled(Reason);
+		}
+	}
+
+	// Releasing the nodes removes their latent actions, calls OnTaskCompleted and returns the tasks to their pools
+	DestroyExecutionHandle(ExecutionHandle);
+
+	return true;
 }
 
-TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::ProcessNodeByGUID(FGuid NodeID, TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle)
+bool UOpenLogicRuntimeGraph::BP_CancelExecutionHandle(FOpenLogicGraphExecutionHandle ExecutionHandle)
 {
-	if (!NodeID.IsValid() || !ExecutionHandle.IsValid())
+	if (!ExecutionHandle.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessNodeByGUID] Invalid NodeID or ExecutionHandle."));
-		return nullptr;
+		return false;
 	}
-	
-	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetOrCreateRuntimeNode(NodeID, ExecutionHandle);
-	if (!RuntimeNode.IsValid())
+
+	TSharedPtr<FOpenLogicGraphExecutionHandle> Handle = GetExecutionHandle(ExecutionHandle.HandleIndex);
+	return Handle.IsValid() && CancelExecutionHandle(Handle);
+}
+
+void UOpenLogicRuntimeGraph::CancelRuntimeNode(FOpenLogicRuntimeNode& RuntimeNode, EOpenLogicCancellationReason Reason)
+{
+	UOpenLogicTask* TaskInstance = RuntimeNode.TaskInstance;
+	if (!RuntimeNode.bPendingCompletion || RuntimeNode.TaskState != EOpenLogicTaskState::Running || !IsValid(TaskInstance))
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessNodeByGUID] Failed to create or retrieve RuntimeNode."));
-		return nullptr;
+		return;
 	}
 
-	FOpenLogicNode NodeData = GetNodeData(NodeID);
-
-	// Initialize the runtime node
-	RuntimeNode->InputPinsCount = NodeData.InputPins.Num();
-	RuntimeNode->OutputPinsCount = NodeData.OutputPins.Num();
+	OPENLOGIC_COUNTER_INC(CancelledTasks, 1);
+	TaskInstance->OnTaskCancelled(Reason);
 
-	return RuntimeNode;
+	// The task may have completed itself when notified
+	if (RuntimeNode.TaskInstance == TaskInstance && RuntimeNode.TaskState == EOpenLogicTaskState::Running)
+	{
+		CompleteNode(TaskInstance);
+	}
 }
 
-void UOpenLogicRuntimeGraph::ActivateNode(TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode, const FName& PinName)
+void UOpenLogicRuntimeGraph::SetExecutionHandleTimeout(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, float TimeoutSeconds)
 {
-	if (!RuntimeNode.IsValid() || !RuntimeNode->TaskInstance)
+	if (!ExecutionHandle.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] Invalid RuntimeNode or TaskInstance."));
 		return;
 	}
 
-	UOpenLogicTask* TaskInstance = RuntimeNode->TaskInstance;
+	FScopeLock Lock(&TimeoutLock);
 
-	if (!IsValid(TaskInstance))
+	if (TimeoutSeconds <= 0.0f)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] Invalid TaskInstance."));
+		HandleTimeouts.Remove(ExecutionHandle->HandleIndex);
 		return;
 	}
 
-	RuntimeNode->TaskState = EOpenLogicTaskState::Running;
+	const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+	HandleTimeouts.Add(ExecutionHandle->HandleIndex, Deadline);
+	ScheduleTimeoutCheck(Deadline);
+}
 
-	const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = FindExecutionHandleForTask(TaskInstance);
+void UOpenLogicRuntimeGraph::BP_SetExecutionHandleTimeout(FOpenLogicGraphExecutionHandle ExecutionHandle, float TimeoutSeconds)
+{
 	if (!ExecutionHandle.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] ExecutionHandle not found for TaskInstance."));
 		return;
 	}
 
-	PreloadInputPropertiesForNode(RuntimeNode, ExecutionHandle);
-
-	// Call the OnNodeActivated runtime graph delegate
-	OnNodeActivated.Broadcast(TaskInstance);
-
-	TaskInstance->OnTaskActivated(GetContext(), PinName);
+	SetExecutionHandleTimeout(GetExecutionHandle(ExecutionHandle.HandleIndex), TimeoutSeconds);
 }
 
-void UOpenLogicRuntimeGraph::CompleteNode(UOpenLogicTask* TaskInstance)
+void UOpenLogicRuntimeGraph::SetNodeTimeout(FGuid NodeID, float TimeoutSeconds)
 {
-	if (!IsValid(TaskInstance))
-    {
-        return;
-    }
+	FScopeLock Lock(&TimeoutLock);
 
-	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
-	if (!RuntimeNode.IsValid())
-    {
-        return;
-    }
+	if (TimeoutSeconds < 0.0f)
+	{
+		NodeTimeoutOverrides.Remove(NodeID);
+		return;
+	}
 
-	// Call the OnNodeCompleted runtime graph delegate
-	OnNodeCompleted.Broadcast(RuntimeNode->TaskInstance);
+	NodeTimeoutOverrides.Add(NodeID, TimeoutSeconds);
+}
 
-	// Call the OnTaskCompleted event
-	RuntimeNode->TaskInstance->OnTaskCompleted();
-	
-	// Set the task state to completed
-	RuntimeNode->TaskState = EOpenLogicTaskState::Completed;
+void UOpenLogicRuntimeGraph::StartNodeTimeout(const FOpenLogicGraphExecutionHandle& ExecutionHandle, FOpenLogicRuntimeNode& RuntimeNode)
+{
+	RuntimeNode.TimeoutDeadline = 0.0;
 
-	// Cancel any latent actions
-	if (UWorld* World = GetWorld())
+	if (!RuntimeNode.TaskInstance)
 	{
-		World->GetLatentActionManager().RemoveActionsForObject(RuntimeNode->TaskInstance);
+		return;
 	}
-	
-	// Return the task instance to the pool
-	FOpenLogicTaskPool& TaskPool = TaskPools.FindOrAdd(RuntimeNode->TaskInstance->GetClass());
 
-	if (RuntimeNode->TaskInstance->NodeLifecycle != ENodeLifecycle::Persistent)
+	FScopeLock Lock(&TimeoutLock);
+
+	const float* TimeoutOverride = NodeTimeoutOverrides.Find(RuntimeNode.NodeID);
+	const float TimeoutSeconds = TimeoutOverride ? *TimeoutOverride : RuntimeNode.TaskInstance->TimeoutSeconds;
+	if (TimeoutSeconds <= 0.0f)
 	{
-		TaskPool.ReturnTaskInstance(RuntimeNode->TaskInstance);
-		RuntimeNode->TaskInstance = nullptr;
+		return;
 	}
+
+	RuntimeNode.TimeoutDeadline = FPlatformTime::Seconds() + TimeoutSeconds;
+	NodeTimeouts.Add({ExecutionHandle.HandleIndex, RuntimeNode.NodeID, RuntimeNode.TimeoutDeadline});
+	ScheduleTimeoutCheck(RuntimeNode.TimeoutDeadline);
 }
 
-bool UOpenLogicRuntimeGraph::Then(UOpenLogicTask* TaskInstance, int32 NextPinIndex)
+void UOpenLogicRuntimeGraph::ScheduleTimeoutCheck(double Deadline)
 {
-	if (!IsValid(TaskInstance))
+	NextTimeoutDeadline = FMath::Min(NextTimeoutDeadline, Deadline);
+
+	if (!TimeoutTickerHandle.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] Invalid TaskInstance."));
-		return false;
+		TimeoutTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UOpenLogicRuntimeGraph::TickTimeouts));
 	}
+}
+
+bool UOpenLogicRuntimeGraph::TickTimeouts(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<int32> ExpiredHandles;
+	TArray<FNodeTimeout> ExpiredNodes;
+	bool bHasTimeouts = true;
 
-	TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = FindExecutionHandleForTask(TaskInstance);
-	if (!ExecutionHandle.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: ExecutionHandle not found."), *TaskInstance->GetName());
-		return false;
+		FScopeLock Lock(&TimeoutLock);
+
+		if (Now < NextTimeoutDeadline)
+		{
+			return true;
+		}
+
+		NextTimeoutDeadline = TNumericLimits<double>::Max();
+
+		for (auto It = HandleTimeouts.CreateIterator(); It; ++It)
+		{
+			if (It.Value() <= Now)
+			{
+				ExpiredHandles.Add(It.Key());
+				It.RemoveCurrent();
+			} else
+			{
+				NextTimeoutDeadline = FMath::Min(NextTimeoutDeadline, It.Value());
+			}
+		}
+
+		for (int32 Index = NodeTimeouts.Num() - 1; Index >= 0; Index--)
+		{
+			if (NodeTimeouts[Index].Deadline <= Now)
+			{
+				ExpiredNodes.Add(NodeTimeouts[Index]);
+				NodeTimeouts.RemoveAtSwap(Index);
+			} else
+			{
+				NextTimeoutDeadline = FMath::Min(NextTimeoutDeadline, NodeTimeouts[Index].Deadline);
+			}
+		}
+
+		// Stop ticking until the next timeout is scheduled
+		if (HandleTimeouts.Num() == 0 && NodeTimeouts.Num() == 0)
+		{
+			TimeoutTickerHandle.Reset();
+			bHasTimeouts = false;
+		}
 	}
 
-	const FGuid NodeID = TaskInstance->GetGuid();
-	if (!NodeID.IsValid())
+	if (ExpiredHandles.Num() == 0 && ExpiredNodes.Num() == 0)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: NodeID not valid."), *TaskInstance->GetName());
-		return false;
+		return bHasTimeouts;
 	}
 
-	TSharedPtr<FOpenLogicRuntimeNode>* RuntimeNode = ExecutionHandle->RuntimeNodes.Find(NodeID);
-	if (!RuntimeNode || !RuntimeNode->IsValid())
+	// The graph thread may be running the handles being cancelled, so it is paused until they are released
+	TOptional<FScopeLock> GraphThreadLock;
+	if (Runnable)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: RuntimeNode not found."), *TaskInstance->GetName());
-		return false;
+		GraphThreadLock.Emplace(&Runnable->GetProcessLock());
 	}
 
-	FOpenLogicNode NodeData = GetNodeData(NodeID);
-
-	const FOpenLogicPinState* PinState = NodeData.OutputPins.Find(NextPinIndex);
-	if (!PinState || PinState->Connections.IsEmpty())
+	for (const FNodeTimeout& NodeTimeout : ExpiredNodes)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: PinState not found or has no connections."), *TaskInstance->GetName());
-		return false;
+		const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = GetExecutionHandle(NodeTimeout.HandleIndex);
+		const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = ExecutionHandle.IsValid() ? ExecutionHandle->RuntimeNodes.FindRef(NodeTimeout.NodeID) : nullptr;
+
+		// Only the activation the deadline was set for, the node may have completed and be pending again since
+		if (RuntimeNode.IsValid() && RuntimeNode->TimeoutDeadline == NodeTimeout.Deadline)
+		{
+			UE_LOG(OpenLogicLog, Verbose, TEXT("[TickTimeouts] Node %s of handle %d timed out."), *NodeTimeout.NodeID.ToString(), NodeTimeout.HandleIndex);
+			CancelRuntimeNode(*RuntimeNode, EOpenLogicCancellationReason::NodeTimedOut);
+		}
 	}
 
-	const FGuid NextNodeGuid = PinState->Connections[0].NodeID;
-	if (!NextNodeGuid.IsValid())
+	for (const int32 HandleIndex : ExpiredHandles)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: NextNodeGuid not valid."), *TaskInstance->GetName());
-		return false;
+		// Handles that finished in time are kept until destroyed, they are not cancelled
+		TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = GetExecutionHandle(HandleIndex);
+		if (ExecutionHandle.IsValid() && !ExecutionHandle->IsFinished())
+		{
+			UE_LOG(OpenLogicLog, Verbose, TEXT("[TickTimeouts] Execution handle %d timed out."), HandleIndex);
+			CancelExecutionHandle(ExecutionHandle, EOpenLogicCancellationReason::HandleTimedOut);
+		}
 	}
 
-	TSharedPtr<FOpenLogicRuntimeNode> NextRuntimeNode = ProcessNodeByGUID(NextNodeGuid, ExecutionHandle);
-	if (!NextRuntimeNode.IsValid())
+	return bHasTimeouts;
+}
+
+TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::GetExecutionHandles() const
+{
+	TArray<FOpenLogicGraphExecutionHandle> Handles;
+	Handles.Reserve(HandleRegistry.Num());
+
+	for (auto& HandlePair : HandleRegistry)
 	{
-		return false;
+		Handles.Add(*HandlePair.Value);
 	}
 
-	FOpenLogicNode NextNodeData = GetNodeData(NextNodeGuid);
-	ActivateNode(NextRuntimeNode, NextNodeData.GetInputPinData(PinState->Connections[0].PinID).PinName);
-	return true;
+	return Handles;
 }
 
-void UOpenLogicRuntimeGraph::SetDataPropertyValue(UOpenLogicTask* TaskInstance, FName PinName, const TSharedPtr<void>& Value) const
+TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::ProcessNodeByGUID(FGuid NodeID, TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle)
 {
-	if (!IsValid(TaskInstance) || !PinName.IsValid() || !Value.IsValid())
+	if (!NodeID.IsValid() || !ExecutionHandle.IsValid())
 	{
-		return;
+		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessNodeByGUID] Invalid NodeID or ExecutionHandle."));
+		return nullptr;
 	}
-
-	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
-	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	
+	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetOrCreateRuntimeNode(NodeID, ExecutionHandle);
+	if (!RuntimeNode.IsValid())
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[SetDataPropertyValue] Invalid RuntimeNode or TaskState."));
-		return;
+		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessNodeByGUID] Failed to create or retrieve RuntimeNode."));
+		return nullptr;
 	}
 
-	const FOpenLogicNode& NodeData = GetNodeData(RuntimeNode->NodeID);
-	const int32 PinIndex = NodeData.GetOutputPinIndexFromName(PinName);
+	FOpenLogicNode NodeData = GetNodeData(NodeID);
 
-	if (PinIndex == INDEX_NONE)
-	{
-		UE_LOG(OpenLogicLog, Warning, TEXT("[SetDataPropertyValue] PinName %s not found."), *PinName.ToString());
-		return;
-	}
+	// Initialize the runtime node
+	RuntimeNode->InputPinsCount = NodeData.InputPins.Num();
+	RuntimeNode->OutputPinsCount = NodeData.OutputPins.Num();
 
-	RuntimeNode->OutputProperties.Add(PinIndex, Value);
+	return RuntimeNode;
 }
 
-void UOpenLogicRuntimeGraph::SetDataPropertyValueByAddress(UOpenLogicTask* TaskInstance, FName PinName, FProperty* Property, void* SourceAddress) const
+void UOpenLogicRuntimeGraph::ActivateNode(TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode, const FName& PinName)
 {
-	if (!IsValid(TaskInstance) || !PinName.IsValid() || !Property || !SourceAddress)
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_ActivateNode);
+
+	if (!RuntimeNode.IsValid() || (!RuntimeNode->TaskInstance && !RuntimeNode->StructTask))
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[SetDataPropertyValueByAddress] Invalid parameters."));
+		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] Invalid RuntimeNode or TaskInstance."));
 		return;
 	}
 
-	// Allocate memory and copy the property value
-	void* CopiedValue = FMemory::Malloc(Property->GetElementSize() * Property->ArrayDim);
-	FMemory::Memzero(CopiedValue, Property->GetElementSize() * Property->ArrayDim);
-	Property->InitializeValue(CopiedValue);
+	// Struct tasks run from their class default object and have no task instance
+	const UOpenLogicStructTask* StructTask = RuntimeNode->StructTask;
+	UOpenLogicTask* TaskInstance = RuntimeNode->TaskInstance;
+
+	if (!StructTask && !IsValid(TaskInstance))
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] Invalid TaskInstance."));
+		return;
+	}
+
+	const UOpenLogicTask* TaskObject = StructTask ? StructTask : TaskInstance;
+	const UClass* TaskClass = TaskObject->GetClass();
+
+	UE_CLOG(!IsInGameThread() && !TaskObject->bIsThreadSafe, OpenLogicLog, Verbose, TEXT("[ActivateNode] %s is not thread-safe but runs on the graph thread."), *TaskClass->GetName());
+
+	const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = StructTask ? GetExecutionHandle(RuntimeNode->ExecutionHandleIndex) : FindExecutionHandleForTask(TaskInstance);
+	if (!ExecutionHandle.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateNode] ExecutionHandle not found for TaskInstance."));
+		return;
+	}
+
+	// Nothing else runs in a cancelled handle, it is being released
+	if (ExecutionHandle->CancellationToken.IsCancellationRequested())
+	{
+		return;
+	}
+
+	RuntimeNode->TaskState = EOpenLogicTaskState::Running;
+	OPENLOGIC_COUNTER_INC(NodeActivations, 1);
+
+	if (ExecutionHandle->StartCycles == 0)
+	{
+		ExecutionHandle->StartCycles = FPlatformTime::Cycles64();
+	}
+
+	ExecutionHandle->ActivationDepth++;
+
+	const bool bChromeTrace = FOpenLogicChromeTrace::IsRecording();
+	const double ChromeTraceStart = bChromeTrace ? FOpenLogicChromeTrace::GetTimestamp() : 0.0;
+
+	PreloadInputPropertiesForNode(RuntimeNode, ExecutionHandle);
+
+	OPENLOGIC_TRACE_NODE_ACTIVATED(this, ExecutionHandle->HandleIndex, RuntimeNode->NodeID, TaskClass);
+
+	// Call the OnNodeActivated runtime graph delegates, which only report task instances
+	if (TaskInstance && OnNodeActivatedNative.IsBound())
+	{
+		OnNodeActivatedNative.Broadcast(TaskInstance);
+	}
+
+	if (TaskInstance && OnNodeActivated.IsBound())
+	{
+		OnNodeActivated.Broadcast(TaskInstance);
+	}
+
+	PushDebugEvent(EOpenLogicNodeDebugEventType::Activated, RuntimeNode->NodeID, ExecutionHandle->HandleIndex, TaskInstance);
+
+	// Events, latent and non-deterministic tasks are captured by execution traces and not run again on replay
+	const bool bRecordedTask = TaskInstance && (IsRecording() || IsReplaying()) && FOpenLogicExecutionTrace::IsRecordedTask(TaskInstance);
+
+	if (bRecordedTask && IsRecording())
+	{
+		Recorder->RecordActivationBegin(ExecutionHandle->HandleIndex, RuntimeNode->NodeID);
+	}
+
+	if (bRecordedTask && IsReplaying())
+	{
+		Replayer->ReplayActivation(TaskInstance, ExecutionHandle->HandleIndex);
+	}
+	else if (StructTask)
+	{
+		ActivateStructNode(*RuntimeNode, PinName, PinName != NAME_None || RuntimeNode->NodeID == ExecutionHandle->NodeID);
+	}
+	else
+	{
+		TaskInstance->OnTaskActivated(GetContext(), PinName);
+	}
+
+	if (bRecordedTask && IsRecording())
+	{
+		Recorder->RecordActivationEnd(ExecutionHandle->HandleIndex, RuntimeNode->NodeID);
+	}
+
+	if (TaskInstance && OnNodeActivationEndNative.IsBound())
+	{
+		OnNodeActivationEndNative.Broadcast(TaskInstance);
+	}
+
+	// Nodes entered through an execution pin that are still running are waiting on a latent completion
+	const bool bPending = RuntimeNode->TaskState == EOpenLogicTaskState::Running && (PinName != NAME_None || RuntimeNode->NodeID == ExecutionHandle->NodeID);
+
+	OPENLOGIC_TRACE_NODE_ACTIVATION_END(this, ExecutionHandle->HandleIndex, RuntimeNode->NodeID, bPending);
+
+	if (bChromeTrace)
+	{
+		FOpenLogicChromeTrace::OutputNodeActivation(this, ExecutionHandle->HandleIndex, TaskClass, *RuntimeNode, WorkerGraphData.Nodes.Find(RuntimeNode->NodeID), ChromeTraceStart, bPending);
+	}
+
+	if (bPending && !RuntimeNode->bPendingCompletion)
+	{
+		RuntimeNode->bPendingCompletion = true;
+		ExecutionHandle->PendingNodes++;
+		StartNodeTimeout(*ExecutionHandle, *RuntimeNode);
+	}
+
+	// Nodes done with this activation no longer read their inputs. Releasing them lets their producers write the next
+	// value in place, as loops do on every iteration
+	if (!bPending)
+	{
+		RuntimeNode->InputProperties.Reset();
+	}
+
+	ExecutionHandle->ActivationDepth--;
+	TryFinishExecutionHandle(ExecutionHandle);
+}
+
+void UOpenLogicRuntimeGraph::CompleteNode(UOpenLogicTask* TaskInstance)
+{
+	if (!IsValid(TaskInstance))
+    {
+        return;
+    }
+
+	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid())
+    {
+        return;
+    }
+
+	OPENLOGIC_TRACE_NODE_COMPLETED(this, TaskInstance->GetExecutionHandleIndex(), RuntimeNode->NodeID, TaskInstance->GetClass());
+
+	if (IsRecording() && FOpenLogicExecutionTrace::IsRecordedTask(TaskInstance))
+	{
+		Recorder->RecordComplete(TaskInstance->GetExecutionHandleIndex(), RuntimeNode->NodeID);
+	}
+
+	// Call the OnNodeCompleted runtime graph delegates
+	if (OnNodeCompletedNative.IsBound())
+	{
+		OnNodeCompletedNative.Broadcast(RuntimeNode->TaskInstance);
+	}
+
+	if (OnNodeCompleted.IsBound())
+	{
+		OnNodeCompleted.Broadcast(RuntimeNode->TaskInstance);
+	}
+
+	PushDebugEvent(EOpenLogicNodeDebugEventType::Completed, RuntimeNode->NodeID, TaskInstance->GetExecutionHandleIndex(), TaskInstance);
+
+	// Call the OnTaskCompleted event
+	RuntimeNode->TaskInstance->OnTaskCompleted();
+	
+	// Set the task state to completed
+	RuntimeNode->TaskState = EOpenLogicTaskState::Completed;
+
+	// A latent node completing can be the last thing its execution handle was waiting on
+	if (RuntimeNode->bPendingCompletion)
+	{
+		RuntimeNode->bPendingCompletion = false;
+		RuntimeNode->InputProperties.Reset();
+
+		if (FOpenLogicChromeTrace::IsRecording())
+		{
+			FOpenLogicChromeTrace::OutputNodeCompleted(this, TaskInstance->GetExecutionHandleIndex(), TaskInstance->GetClass());
+		}
+
+		const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = GetExecutionHandle(TaskInstance->GetExecutionHandleIndex());
+		if (ExecutionHandle.IsValid())
+		{
+			ExecutionHandle->PendingNodes--;
+			TryFinishExecutionHandle(ExecutionHandle);
+		}
+	}
+
+	// Cancel any latent actions
+	if (UWorld* World = GetWorld())
+	{
+		World->GetLatentActionManager().RemoveActionsForObject(RuntimeNode->TaskInstance);
+	}
+	
+	// Return the task instance to the pool
+	if (RuntimeNode->TaskInstance->NodeLifecycle != ENodeLifecycle::Persistent)
+	{
+		FScopeLock Lock(&TaskPoolLock);
+		TaskPools.FindOrAdd(RuntimeNode->TaskInstance->GetClass()).ReturnTaskInstance(RuntimeNode->TaskInstance, MaxAvailableTasksPerClass);
+		RuntimeNode->TaskInstance = nullptr;
+	}
+}
+
+void UOpenLogicRuntimeGraph::ActivateStructNode(FOpenLogicRuntimeNode& RuntimeNode, const FName& PinName, bool bEnteredThroughExecution)
+{
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode.NodeID);
+	if (!NodeData || !RuntimeNode.StructTask->Functions.Activate)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ActivateStructNode] %s has no Activate function."), *RuntimeNode.StructTask->GetClass()->GetName());
+		RuntimeNode.TaskState = EOpenLogicTaskState::Completed;
+		return;
+	}
+
+	FOpenLogicStructTaskContext Context(*this, RuntimeNode, *NodeData, PinName);
+	RuntimeNode.StructTask->Functions.Activate(Context);
+
+	// Struct tasks have no instance to resume them later, so they cannot be left waiting on a latent completion
+	if (bEnteredThroughExecution && RuntimeNode.TaskState == EOpenLogicTaskState::Running)
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[ActivateStructNode] %s did not complete before returning and was completed."), *RuntimeNode.StructTask->GetClass()->GetName());
+		CompleteStructNode(RuntimeNode);
+	}
+}
+
+void UOpenLogicRuntimeGraph::CompleteStructNode(FOpenLogicRuntimeNode& RuntimeNode)
+{
+	if (!RuntimeNode.StructTask || RuntimeNode.TaskState != EOpenLogicTaskState::Running)
+	{
+		return;
+	}
+
+	OPENLOGIC_TRACE_NODE_COMPLETED(this, RuntimeNode.ExecutionHandleIndex, RuntimeNode.NodeID, RuntimeNode.StructTask->GetClass());
+	PushDebugEvent(EOpenLogicNodeDebugEventType::Completed, RuntimeNode.NodeID, RuntimeNode.ExecutionHandleIndex, nullptr);
+
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode.NodeID);
+	if (NodeData && RuntimeNode.StructTask->Functions.Completed)
+	{
+		FOpenLogicStructTaskContext Context(*this, RuntimeNode, *NodeData, NAME_None);
+		RuntimeNode.StructTask->Functions.Completed(Context);
+	}
+
+	RuntimeNode.TaskState = EOpenLogicTaskState::Completed;
+}
+
+bool UOpenLogicRuntimeGraph::Then(UOpenLogicTask* TaskInstance, int32 NextPinIndex)
+{
+	if (!IsValid(TaskInstance))
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] Invalid TaskInstance."));
+		return false;
+	}
+
+	TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = FindExecutionHandleForTask(TaskInstance);
+	if (!ExecutionHandle.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: ExecutionHandle not found."), *TaskInstance->GetName());
+		return false;
+	}
+
+	const FGuid NodeID = TaskInstance->GetGuid();
+	if (!NodeID.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: NodeID not valid."), *TaskInstance->GetName());
+		return false;
+	}
+
+	if (IsRecording() && FOpenLogicExecutionTrace::IsRecordedTask(TaskInstance))
+	{
+		Recorder->RecordThen(ExecutionHandle->HandleIndex, NodeID, NextPinIndex);
+	}
+
+	return ExecuteOutputPin(ExecutionHandle, NodeID, NextPinIndex);
+}
+
+bool UOpenLogicRuntimeGraph::ExecuteOutputPin(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, const FGuid& NodeID, int32 NextPinIndex)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_Then);
+
+	TSharedPtr<FOpenLogicRuntimeNode>* RuntimeNode = ExecutionHandle->RuntimeNodes.Find(NodeID);
+	if (!RuntimeNode || !RuntimeNode->IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: RuntimeNode not found."), *NodeID.ToString());
+		return false;
+	}
+
+	FOpenLogicNode NodeData = GetNodeData(NodeID);
+
+	const FOpenLogicPinState* PinState = NodeData.OutputPins.Find(NextPinIndex);
+	if (!PinState || PinState->Connections.IsEmpty())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: PinState not found or has no connections."), *NodeID.ToString());
+		return false;
+	}
+
+	const FGuid NextNodeGuid = PinState->Connections[0].NodeID;
+	if (!NextNodeGuid.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[Then] %s: NextNodeGuid not valid."), *NodeID.ToString());
+		return false;
+	}
+
+	if (FOpenLogicChromeTrace::IsRecording())
+	{
+		FOpenLogicChromeTrace::OutputThen(this, ExecutionHandle->HandleIndex, NodeData.GetOutputPinData(NextPinIndex).PinName);
+	}
+
+	TSharedPtr<FOpenLogicRuntimeNode> NextRuntimeNode = ProcessNodeByGUID(NextNodeGuid, ExecutionHandle);
+	if (!NextRuntimeNode.IsValid())
+	{
+		return false;
+	}
+
+	// The node already ran in this handle and gave its task back to the pool (e.g. a loop body)
+	if (!NextRuntimeNode->TaskInstance && !NextRuntimeNode->StructTask)
+	{
+		NextRuntimeNode->TaskInstance = GetOrCreateTaskInstance(NextRuntimeNode, ExecutionHandle);
+		InitializeTaskInstance(NextRuntimeNode->TaskInstance, NextRuntimeNode, ExecutionHandle);
+	}
+
+	FOpenLogicNode NextNodeData = GetNodeData(NextNodeGuid);
+	ActivateNode(NextRuntimeNode, NextNodeData.GetInputPinData(PinState->Connections[0].PinID).PinName);
+	return true;
+}
+
+void UOpenLogicRuntimeGraph::SetDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const TSharedPtr<void>& Value) const
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (!IsValid(TaskInstance) || !Pin.PinName.IsValid() || !Value.IsValid())
+	{
+		return;
+	}
+
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[SetDataPropertyValue] Invalid RuntimeNode or TaskState."));
+		return;
+	}
+
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode->NodeID);
+	const int32 PinIndex = NodeData ? ResolvePinIndex(TaskInstance, *NodeData, Pin, false) : INDEX_NONE;
+
+	if (PinIndex == INDEX_NONE)
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[SetDataPropertyValue] PinName %s not found."), *Pin.PinName.ToString());
+		return;
+	}
+
+	CommitOutputValue(TaskInstance, *RuntimeNode, *NodeData, PinIndex, Value);
+}
+
+void UOpenLogicRuntimeGraph::SetDataPropertyValueByAddress(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, FProperty* Property, void* SourceAddress) const
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (!IsValid(TaskInstance) || !Pin.PinName.IsValid() || !Property || !SourceAddress)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[SetDataPropertyValueByAddress] Invalid parameters."));
+		return;
+	}
+
+	const bool bWritten = WriteOutputSlot(TaskInstance, Pin, [Property, SourceAddress](const UOpenLogicProperty* PropertyObject, void* Dest)
+	{
+		if (!PropertyObject->CanCopyValueFrom(Property))
+		{
+			return false;
+		}
+
+		Property->CopyCompleteValue(Dest, SourceAddress);
+		return true;
+	});
+
+	if (bWritten)
+	{
+		return;
+	}
+
+	// Allocate memory and copy the property value
+	void* CopiedValue = FMemory::Malloc(Property->GetElementSize() * Property->ArrayDim);
+	FMemory::Memzero(CopiedValue, Property->GetElementSize() * Property->ArrayDim);
+	Property->InitializeValue(CopiedValue);
 	Property->CopyCompleteValue(CopiedValue, SourceAddress);
 
-	// Wrap in a TSharedPtr with correct destroy callback
-	TSharedPtr<void> Value(CopiedValue, [Property](void* Ptr)
+	// Wrap in a TSharedPtr with correct destroy callback
+	TSharedPtr<void> Value(CopiedValue, [Property](void* Ptr)
+	{
+		if (Property && Ptr)
+		{
+			Property->DestroyValue(Ptr);
+		}
+		FMemory::Free(Ptr);
+	});
+
+	SetDataPropertyValue(TaskInstance, Pin, Value);
+}
+
+bool UOpenLogicRuntimeGraph::WriteOutputSlot(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const
+{
+	if (!IsValid(TaskInstance) || !Pin.PinName.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	{
+		return false;
+	}
+
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode->NodeID);
+	const int32 PinIndex = NodeData ? ResolvePinIndex(TaskInstance, *NodeData, Pin, false) : INDEX_NONE;
+
+	if (PinIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	return WriteNodeOutputSlot(TaskInstance, *RuntimeNode, *NodeData, PinIndex, Writer);
+}
+
+bool UOpenLogicRuntimeGraph::WriteNodeOutputSlot(UOpenLogicTask* TaskInstance, FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData, int32 PinIndex, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const
+{
+	if (!RuntimeNode.OutputSlots.IsValidIndex(PinIndex - 1))
+	{
+		return false;
+	}
+
+	FOpenLogicOutputSlot& Slot = RuntimeNode.OutputSlots[PinIndex - 1];
+	if (!Slot.PropertyObject || !Slot.Value.IsValid())
+	{
+		return false;
+	}
+
+	// Values are immutable once other pins hold them, so write into a new value instead of changing theirs. Consumers
+	// release their inputs once activated, so only running latent nodes, traces and snapshots keep a value shared
+	const TSharedPtr<void>* CommittedValue = RuntimeNode.OutputProperties.Find(PinIndex);
+	const int32 OwnReferences = CommittedValue && *CommittedValue == Slot.Value ? 2 : 1;
+
+	if (Slot.Value.GetSharedReferenceCount() > OwnReferences)
+	{
+		LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+		TSharedPtr<void> NewValue = Slot.PropertyObject->AllocateValue();
+		if (!NewValue.IsValid())
+		{
+			return false;
+		}
+
+		Slot.Value = MoveTemp(NewValue);
+	}
+
+	if (!Writer(Slot.PropertyObject, Slot.Value.Get()))
+	{
+		return false;
+	}
+
+	CommitOutputValue(TaskInstance, RuntimeNode, NodeData, PinIndex, Slot.Value);
+	return true;
+}
+
+void UOpenLogicRuntimeGraph::CommitOutputValue(UOpenLogicTask* TaskInstance, FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData, int32 PinIndex, const TSharedPtr<void>& Value) const
+{
+	RuntimeNode.OutputProperties.Add(PinIndex, Value);
+
+	if (TaskInstance && IsRecording() && FOpenLogicExecutionTrace::IsRecordedTask(TaskInstance))
+	{
+		const UClass* PropertyClass = NodeData.GetOutputPinData(PinIndex).PropertyClass;
+		Recorder->RecordOutput(RuntimeNode.ExecutionHandleIndex, RuntimeNode.NodeID, PinIndex, PropertyClass ? PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr, Value);
+	}
+
+	OPENLOGIC_TRACE_PIN_WRITE(this, RuntimeNode.ExecutionHandleIndex, RuntimeNode.NodeID, PinIndex);
+}
+
+void UOpenLogicRuntimeGraph::AllocateOutputSlots(FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	RuntimeNode.OutputSlots.Reset();
+
+	for (const TPair<int32, FOpenLogicPinState>& OutputPinPair : NodeData.OutputPins)
+	{
+		const FOpenLogicPinData PinData = NodeData.GetOutputPinData(OutputPinPair.Key);
+		if (PinData.Role != EPinRole::DataProperty || !PinData.PropertyClass || OutputPinPair.Key < 1)
+		{
+			continue;
+		}
+
+		// Wildcards only know their type once written
+		const UOpenLogicProperty* PropertyObject = PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>();
+		TSharedPtr<void> Value = PropertyObject ? PropertyObject->AllocateValue() : nullptr;
+		if (!Value.IsValid())
+		{
+			continue;
+		}
+
+		if (RuntimeNode.OutputSlots.Num() < OutputPinPair.Key)
+		{
+			RuntimeNode.OutputSlots.SetNum(OutputPinPair.Key);
+		}
+
+		FOpenLogicOutputSlot& Slot = RuntimeNode.OutputSlots[OutputPinPair.Key - 1];
+		Slot.PropertyObject = PropertyObject;
+		Slot.Value = MoveTemp(Value);
+	}
+}
+
+TSharedPtr<void> UOpenLogicRuntimeGraph::GetDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const UClass* ExpectedPropertyClass)
+{
+	if (!IsValid(TaskInstance) || !Pin.PinName.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[GetDataPropertyValue] Invalid RuntimeNode or TaskState."));
+		return nullptr;
+	}
+
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode->NodeID);
+	const int32 PinIndex = NodeData ? ResolvePinIndex(TaskInstance, *NodeData, Pin, true) : INDEX_NONE;
+
+	if (PinIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	if (ExpectedPropertyClass && !CheckInputPinClass(*NodeData, PinIndex, ExpectedPropertyClass))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<void> FoundValue = RuntimeNode->InputProperties.FindRef(PinIndex);
+	if (!FoundValue.IsValid())
+	{
+		return nullptr;
+	}
+
+	return FoundValue;
+}
+
+void* UOpenLogicRuntimeGraph::GetMutableDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const UClass* ExpectedPropertyClass)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (!IsValid(TaskInstance) || !Pin.PinName.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[GetMutableDataPropertyValue] Invalid RuntimeNode or TaskState."));
+		return nullptr;
+	}
+
+	const FOpenLogicNode* NodeData = FindNodeData(RuntimeNode->NodeID);
+	const int32 PinIndex = NodeData ? ResolvePinIndex(TaskInstance, *NodeData, Pin, true) : INDEX_NONE;
+
+	if (PinIndex != INDEX_NONE && ExpectedPropertyClass && !CheckInputPinClass(*NodeData, PinIndex, ExpectedPropertyClass))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<void>* FoundValue = PinIndex != INDEX_NONE ? RuntimeNode->InputProperties.Find(PinIndex) : nullptr;
+	if (!FoundValue || !FoundValue->IsValid())
+	{
+		return nullptr;
+	}
+
+	// The value is shared with the output it comes from and the other pins reading it, copy it before the first change
+	if (FoundValue->GetSharedReferenceCount() > 1)
+	{
+		const UClass* PropertyClass = NodeData->GetInputPinData(PinIndex).PropertyClass;
+		const UOpenLogicProperty* PropertyObject = PropertyClass ? PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+
+		TSharedPtr<void> Copy = PropertyObject ? PropertyObject->CloneValue(FoundValue->Get()) : nullptr;
+		if (!Copy.IsValid())
+		{
+			UE_LOG(OpenLogicLog, Warning, TEXT("[GetMutableDataPropertyValue] The value of pin %s cannot be copied."), *Pin.PinName.ToString());
+			return nullptr;
+		}
+
+		*FoundValue = MoveTemp(Copy);
+		OPENLOGIC_COUNTER_INC(ValueCopies, 1);
+	}
+
+	return FoundValue->Get();
+}
+
+int32 UOpenLogicRuntimeGraph::ResolvePinIndex(const UOpenLogicTask* TaskInstance, const FOpenLogicNode& NodeData, const FOpenLogicPinHandle& Pin, bool bIsInput) const
+{
+	if (Pin.PinIndex != INDEX_NONE && Pin.SchemaHash != 0 && TaskInstance && Pin.SchemaHash == TaskInstance->GetPinSchemaHash())
+	{
+		// User created pins are not part of the schema, so their indices are never baked
+		const FOpenLogicPinState* PinState = (bIsInput ? NodeData.InputPins : NodeData.OutputPins).Find(Pin.PinIndex);
+		if (PinState && !PinState->IsUserCreated)
+		{
+			return Pin.PinIndex;
+		}
+	}
+
+	return bIsInput ? NodeData.GetInputPinIndexFromName(Pin.PinName) : NodeData.GetOutputPinIndexFromName(Pin.PinName);
+}
+
+bool UOpenLogicRuntimeGraph::CheckInputPinClass(const FOpenLogicNode& NodeData, int32 PinIndex, const UClass* ExpectedPropertyClass) const
+{
+	// The pin was checked when the typed pin was bound, but user created pins and patched graphs can change its type
+	const UClass* PropertyClass = NodeData.GetInputPinData(PinIndex).PropertyClass;
+	return ensureMsgf(PropertyClass && PropertyClass->IsChildOf(ExpectedPropertyClass), TEXT("[CheckInputPinClass] Input pin %d of %s is a %s pin, expected %s."),
+		PinIndex, *NodeData.TaskClass.GetAssetName(), PropertyClass ? *PropertyClass->GetName() : TEXT("None"), *ExpectedPropertyClass->GetName());
+}
+
+void UOpenLogicRuntimeGraph::PreloadInputPropertiesForNode(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
+	{
+		return;
+	}
+
+	RuntimeNode->InputProperties.Empty();
+
+	const FOpenLogicNode& NodeData = GetNodeData(RuntimeNode->NodeID);
+
+	for (const auto& InputPinPair : NodeData.InputPins)
+	{
+		const int32 InputPinIndex = InputPinPair.Key;
+		const FOpenLogicPinState& InputPinState = InputPinPair.Value;
+
+		const FOpenLogicPinData& PinData = NodeData.GetInputPinData(InputPinIndex);
+		if (PinData.Role != EPinRole::DataProperty)
+		{
+			continue;
+		}
+
+		TSharedPtr<void> PropertyValue;
+
+		if (InputPinState.Connections.Num() > 0)
+		{
+			PropertyValue = ResolveConnectedPinValue(RuntimeNode, ExecutionHandle, InputPinState.Connections[0]);
+		}
+
+		// Fallback to default value if no connection is found
+		if (!PropertyValue.IsValid())
+		{
+			if (const UOpenLogicProperty* PropertyInstance = Cast<UOpenLogicProperty>(PinData.PropertyClass->GetDefaultObject()))
+			{
+				PropertyValue = CreatePropertyValueFromDefault(InputPinState.DefaultValue, PropertyInstance);
+			}
+		}
+
+		if (PropertyValue.IsValid())
+		{
+			RuntimeNode->InputProperties.Add(InputPinIndex, PropertyValue);
+		}
+	}
+}
+
+TSharedPtr<void> UOpenLogicRuntimeGraph::ResolveConnectedPinValue(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, const FOpenLogicPinConnection& Connection)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_ResolveConnectedPinValue);
+
+	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid() || !Connection.NodeID.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ResolveConnectedPinValue] Invalid parameters."));
+		return nullptr;
+	}
+
+	bool bConnectionNodeFound = ExecutionHandle->RuntimeNodes.Contains(Connection.NodeID);
+
+	TSharedPtr<FOpenLogicRuntimeNode> ConnectionRuntimeNode = ProcessNodeByGUID(Connection.NodeID, ExecutionHandle);
+	if (!ConnectionRuntimeNode.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ResolveConnectedPinValue] ConnectionRuntimeNode not valid."));
+		return nullptr;
+	}
+
+	if (!bConnectionNodeFound || ConnectionRuntimeNode->bReevaluateOnDemand)
+	{
+		UOpenLogicTask* TaskInstance = ConnectionRuntimeNode->TaskInstance;
+		if (!TaskInstance && !ConnectionRuntimeNode->StructTask)
+		{
+			ConnectionRuntimeNode->TaskInstance = GetOrCreateTaskInstance(ConnectionRuntimeNode, ExecutionHandle);
+			InitializeTaskInstance(ConnectionRuntimeNode->TaskInstance, ConnectionRuntimeNode, ExecutionHandle);
+		}
+
+		ActivateNode(ConnectionRuntimeNode, NAME_None);
+	}
+
+	if (const TSharedPtr<void>* FoundValue = ConnectionRuntimeNode->OutputProperties.Find(Connection.PinID))
+	{
+		return *FoundValue;
+	}
+	return nullptr;
+}
+
+TSharedPtr<void> UOpenLogicRuntimeGraph::CreatePropertyValueFromDefault(const FOpenLogicDefaultValue& DefaultValue, const UOpenLogicProperty* PropertyInstance)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_Values);
+
+	if (!PropertyInstance)
+	{
+		return nullptr;
+	}
+
+	switch (PropertyInstance->UnderlyingType)
+	{
+		case EOpenLogicUnderlyingType::Boolean:
+		{
+			bool Value = false;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<bool>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Byte:
+		{
+			uint8 Value = 0;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<uint8>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Int:
+		{
+			int32 Value = 0;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<int32>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Float:
+		{
+			float Value = 0.0f;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<float>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Double:
+		{
+			double Value = 0.0;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<double>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::String:
+		{
+			FString Value;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<FString>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Name:
+		{
+			FName Value;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<FName>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Text:
+		{
+			FText Value;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<FText>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Object:
+		case EOpenLogicUnderlyingType::Class:
+		{
+			UObject* Value = nullptr;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<UObject*>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Enum:
+		{
+			int32 Value = 0;
+			if (DefaultValue.GetValue(Value))
+			{
+				return MakeShared<int32>(Value);
+			}
+			break;
+		}
+		case EOpenLogicUnderlyingType::Struct:
+		{
+			if (!PropertyInstance || !PropertyInstance->StructType)
+			{
+				UE_LOG(OpenLogicLog, Error, TEXT("StructType is not set for property."));
+				break;
+			}
+
+			FOpenLogicDefaultValue StructValue = DefaultValue;
+
+			return StructValue.DeserializeToStruct(PropertyInstance->StructType);
+		}
+		case EOpenLogicUnderlyingType::Wildcard:
+		{
+			// Property classes described by a Value property, such as arrays, have no default value and start empty
+			if (PropertyInstance->GetValueProperty())
+			{
+				return PropertyInstance->AllocateValue();
+			}
+
+			// Wildcard — not enough info to safely deserialize
+			UE_LOG(OpenLogicLog, Error, TEXT("Wildcard type cannot be deserialized."));
+			break;
+		}
+	}
+
+	return nullptr;
+}
+
+FOpenLogicDefaultValue UOpenLogicRuntimeGraph::GetDefaultValue(UOpenLogicTask* TaskInstance, FName PinName)
+{
+	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
+	if (!RuntimeNode.IsValid() || !PinName.IsValid())
+	{
+		return FOpenLogicDefaultValue();
+	}
+
+	FOpenLogicNode NodeData = GetNodeData(RuntimeNode->NodeID);
+	int32 InputPinIndex = NodeData.GetInputPinIndexFromName(PinName);
+
+	if (InputPinIndex == -1 || !NodeData.InputPins.Contains(InputPinIndex))
+	{
+		return FOpenLogicDefaultValue();
+	}
+
+	return NodeData.InputPins[InputPinIndex].DefaultValue;
+}
+
+TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::FindExecutionHandleForTask(const UOpenLogicTask* TaskInstance) const
+{
+	if (!TaskInstance || TaskInstance->GetExecutionHandleIndex() == INDEX_NONE)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FindExecutionHandleForTask] Invalid TaskInstance or ExecutionHandleIndex."));
+		return nullptr;
+	}
+
+	// Instances activated by this graph know their handle, the registry is only searched for the others
+	if (TSharedPtr<FOpenLogicGraphExecutionHandle> BoundHandle = TaskInstance->GetBoundExecutionHandle())
+	{
+		return BoundHandle;
+	}
+
+	int32 HandleIndex = TaskInstance->GetExecutionHandleIndex();
+
+	const TSharedPtr<FOpenLogicGraphExecutionHandle>* FoundHandle = HandleRegistry.Find(HandleIndex);
+	if (!FoundHandle || !FoundHandle->IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FindExecutionHandleForTask] ExecutionHandle not found for TaskInstance %s."), *TaskInstance->GetName());
+		return nullptr;
+	}
+
+	return *FoundHandle;
+}
+
+TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::FindRuntimeNodeForTask( const UOpenLogicTask* TaskInstance) const
+{
+	if (!TaskInstance)
+	{
+		return nullptr;
+	}
+
+	if (TSharedPtr<FOpenLogicRuntimeNode> BoundNode = TaskInstance->GetBoundRuntimeNode())
+	{
+		return BoundNode;
+	}
+
+	TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = FindExecutionHandleForTask(TaskInstance);
+	if (!ExecutionHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (ExecutionHandle->RuntimeNodes.Contains(TaskInstance->GetGuid()))
+	{
+		return ExecutionHandle->RuntimeNodes[TaskInstance->GetGuid()];
+	}
+
+	return nullptr;
+}
+
+void UOpenLogicRuntimeGraph::ProcessExecutionHandle(TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+	if (!ExecutionHandle.IsValid() || ExecutionHandle->IsProcessed)
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessExecutionHandle] Invalid Handle."));
+		return;
+	}
+
+	// Set the execution handle as processed and running
+	ExecutionHandle->IsProcessed = true;
+	ExecutionHandle->IsRunning = true;
+
+	if (IsRecording())
+	{
+		Recorder->RecordHandle(EOpenLogicTraceRecordType::ProcessHandle, ExecutionHandle->HandleIndex);
+	}
+
+	// Run the entry node (replays stay on the calling thread to keep the recorded order)
+	if (GetThreadSettings().NodeExecutionThread == EOpenLogicRuntimeThreadType::GameThread || !IsInGameThread() || IsReplaying())
+	{
+		TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetOrCreateRuntimeNode(ExecutionHandle->NodeID, ExecutionHandle);
+		if (!RuntimeNode.IsValid())
+		{
+			return;
+		}
+
+		ActivateNode(RuntimeNode, NAME_None);
+	} else
+	{
+		AddExecutionHandleToQueue(ExecutionHandle);
+	}
+}
+
+void UOpenLogicRuntimeGraph::TryFinishExecutionHandle(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+	if (!ExecutionHandle.IsValid() || ExecutionHandle->bLatencyRecorded || ExecutionHandle->StartCycles == 0)
+	{
+		return;
+	}
+
+	if (ExecutionHandle->ActivationDepth > 0 || ExecutionHandle->PendingNodes > 0)
+	{
+		return;
+	}
+
+	ExecutionHandle->bLatencyRecorded = true;
+	ExecutionHandle->IsRunning = false;
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	const uint64 QueueWaitMicroseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(ExecutionHandle->StartCycles - ExecutionHandle->TriggerCycles) * 1000000.0);
+	const uint64 ExecutionMicroseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(EndCycles - ExecutionHandle->StartCycles) * 1000000.0);
+
+	FOpenLogicLatencyTracker::Get().Record(ExecutionHandle->TaskClass.ToSoftObjectPath(), QueueWaitMicroseconds, ExecutionMicroseconds);
+}
+
+bool UOpenLogicRuntimeGraph::IsExecutionHandleValid(const FOpenLogicGraphExecutionHandle& ExecutionHandle)
+{
+	return ExecutionHandle.IsValid();
+}
+
+TArray<FGuid> UOpenLogicRuntimeGraph::GetEventImplementations(TSubclassOf<UOpenLogicTask> TaskClass) const
+{
+	const TArray<FGuid>* EventImplementations = FindEventImplementations(TaskClass);
+	return EventImplementations ? *EventImplementations : TArray<FGuid>();
+}
+
+const TArray<FGuid>* UOpenLogicRuntimeGraph::FindEventImplementations(const UClass* EventClass) const
+{
+	return EventClass ? EventDispatchIndex.Find(EventClass) : nullptr;
+}
+
+void UOpenLogicRuntimeGraph::BuildEventDispatchIndex()
+{
+	EventDispatchIndex.Reset();
+
+	for (const TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicEventContainer>& EventPair : WorkerGraphData.Events)
+	{
+		// Triggering a parent class also triggers the implementations of its subclasses
+		for (UClass* EventClass = EventPair.Key.Get(); EventClass && EventClass != UOpenLogicTask::StaticClass(); EventClass = EventClass->GetSuperClass())
+		{
+			TArray<FGuid>& EntryNodes = EventDispatchIndex.FindOrAdd(EventClass);
+			for (const FGuid& NodeID : EventPair.Value.NodeId)
+			{
+				EntryNodes.AddUnique(NodeID);
+			}
+		}
+	}
+}
+
+void UOpenLogicRuntimeGraph::BuildSnapshotNodeTable()
+{
+	WorkerGraphData.Nodes.GenerateKeyArray(SnapshotNodeTable);
+	SnapshotNodeTable.Sort([](const FGuid& A, const FGuid& B) { return A < B; });
+
+	SnapshotNodeIndices.Reset();
+	SnapshotNodeIndices.Reserve(SnapshotNodeTable.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < SnapshotNodeTable.Num(); NodeIndex++)
+	{
+		SnapshotNodeIndices.Add(SnapshotNodeTable[NodeIndex], NodeIndex);
+	}
+
+	SnapshotNodeTableHash = FCrc::MemCrc32(SnapshotNodeTable.GetData(), SnapshotNodeTable.Num() * sizeof(FGuid));
+}
+
+void UOpenLogicRuntimeGraph::SetDispatchSubsystem(UOpenLogicRuntimeSubsystem* Subsystem)
+{
+	DispatchSubsystem = Subsystem;
+}
+
+TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::GetOrCreateRuntimeNode(FGuid NodeID, TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	if (!NodeID.IsValid() || !ExecutionHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Check if the runtime node already exists
+	if (TSharedPtr<FOpenLogicRuntimeNode>* ExistingRuntimeNode = ExecutionHandle->RuntimeNodes.Find(NodeID))
+	{
+		return *ExistingRuntimeNode;
+	}
+
+	const FOpenLogicNode* NodeData = FindNodeData(NodeID);
+
+	if (!NodeData || NodeData->TaskClass.IsNull())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[GetOrCreateRuntimeNode] Invalid TaskClass for NodeID %s."), *NodeID.ToString());
+		return nullptr;
+	}
+
+	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = MakeShared<FOpenLogicRuntimeNode>();
+	RuntimeNode->TaskClass = NodeData->TaskClass;
+	RuntimeNode->TaskState = EOpenLogicTaskState::None;
+	RuntimeNode->NodeID = NodeID;
+	RuntimeNode->ExecutionHandleIndex = ExecutionHandle->HandleIndex;
+
+	// Struct tasks run from their class default object, with their state kept in the node instead of a pooled instance
+	const UClass* TaskClass = NodeData->TaskClass.Get();
+	RuntimeNode->StructTask = TaskClass ? Cast<UOpenLogicStructTask>(TaskClass->GetDefaultObject()) : nullptr;
+
+	if (const UOpenLogicStructTask* StructTask = RuntimeNode->StructTask)
+	{
+		RuntimeNode->bReevaluateOnDemand = StructTask->ReevaluateOnDemand;
+
+		if (StructTask->InstanceDataType)
+		{
+			RuntimeNode->InstanceData.InitializeAs(StructTask->InstanceDataType);
+		}
+	}
+	else
+	{
+		RuntimeNode->TaskInstance = GetOrCreateTaskInstance(RuntimeNode, ExecutionHandle);
+		RuntimeNode->bReevaluateOnDemand = RuntimeNode->TaskInstance->ReevaluateOnDemand;
+		InitializeTaskInstance(RuntimeNode->TaskInstance, RuntimeNode, ExecutionHandle);
+	}
+
+	AllocateOutputSlots(*RuntimeNode, *NodeData);
+
+	ExecutionHandle->RuntimeNodes.Add(NodeID, RuntimeNode);
+	OPENLOGIC_COUNTER_INC(RuntimeNodes, 1);
+
+	return RuntimeNode;
+}
+ 
+UOpenLogicTask* UOpenLogicRuntimeGraph::GetOrCreateTaskInstance(TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (RuntimeNode->TaskInstance)
+	{
+		return RuntimeNode->TaskInstance;
+	}
+
+	TSubclassOf<UOpenLogicTask> TaskClass = RuntimeNode->TaskClass.Get();
+	if (!TaskClass)
+	{
+		return nullptr;
+	}
+
+	if (PersistentNodes.Contains(RuntimeNode->NodeID))
+	{
+		RuntimeNode->TaskInstance = PersistentNodes[RuntimeNode->NodeID];
+		return RuntimeNode->TaskInstance;
+	}
+
+	// Get the task instance from the pool
+	UOpenLogicTask* TaskInstance = nullptr;
+	{
+		FScopeLock Lock(&TaskPoolLock);
+		TaskInstance = TaskPools.FindOrAdd(TaskClass).GetTaskInstance(TaskClass, this);
+	}
+
+	if (TaskInstance->NodeLifecycle == ENodeLifecycle::Persistent)
+	{
+		PersistentNodes.Add(RuntimeNode->NodeID, TaskInstance);
+	}
+
+	return TaskInstance;
+}
+
+void UOpenLogicRuntimeGraph::InitializeTaskInstance(UOpenLogicTask* TaskInstance, const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_InitializeTaskInstance);
+
+	if (!TaskInstance || !RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
+	{
+		return;
+	}
+
+	TaskInstance->SetGuid(RuntimeNode->NodeID);
+	TaskInstance->SetRuntimeGraph(this);
+	TaskInstance->SetExecutionHandleIndex(ExecutionHandle->HandleIndex);
+	TaskInstance->BindRuntimeNode(RuntimeNode, ExecutionHandle);
+
+	// Loading task properties
+	if (const FOpenLogicNode* NodeData = WorkerGraphData.Nodes.Find(RuntimeNode->NodeID))
+	{
+		ImportTaskProperties(TaskInstance, *NodeData);
+	}
+}
+
+void UOpenLogicRuntimeGraph::ImportTaskProperties(UOpenLogicTask* TaskInstance, const FOpenLogicNode& NodeData)
+{
+	if (!TaskInstance)
+	{
+		return;
+	}
+
+	for (const TPair<FGuid, FString>& BlueprintContent : NodeData.BlueprintContent)
+	{
+		FProperty* Property = FindFProperty<FProperty>(TaskInstance->GetClass(), TaskInstance->GetPropertyNameByGUID(BlueprintContent.Key));
+		if (!Property)
+		{
+			continue;
+		}
+		
+		// Capture any import errors
+		FOutputDeviceNull ErrorText;
+	
+		Property->ImportText_Direct(*BlueprintContent.Value, Property->ContainerPtrToValuePtr<void>(TaskInstance), TaskInstance->GetOuter(), PPF_None, &ErrorText);
+	}
+
+	for (const TPair<FName, FString>& CppContent : NodeData.CppContent)
+	{
+		FProperty* Property = FindFProperty<FProperty>(TaskInstance->GetClass(), CppContent.Key);
+		if (!Property)
+		{
+			continue;
+		}
+
+		// Capture any import errors
+		FOutputDeviceNull ErrorText;
+
+		Property->ImportText_Direct(*CppContent.Value, Property->ContainerPtrToValuePtr<void>(TaskInstance), TaskInstance->GetOuter(), PPF_None, &ErrorText);
+	}
+}
+
+/* Executes all the events associated with a specific Task class */
+void UOpenLogicRuntimeGraph::MultiExecuteEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool& bSuccess)
+{
+	FOpenLogicGraphExecutionHandle EventExecutionHandle;
+	bSuccess = TriggerEvent(TaskClass, true, EventExecutionHandle);
+}
+
+void UOpenLogicRuntimeGraph::SetGraphData(FOpenLogicGraphData NewData)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	WorkerGraphData = NewData;
+
+	for (auto& NodePair : WorkerGraphData.Nodes)
+	{
+		TSoftClassPtr<UOpenLogicTask> TaskClass = NodePair.Value.TaskClass;
+		if (TaskClass.IsNull())
+		{
+			continue;
+		}
+		
+		TaskClass.LoadSynchronous();
+	}
+
+	BuildEventDispatchIndex();
+	BuildSnapshotNodeTable();
+
+	// Let the subsystem pick up the new event classes
+	if (UOpenLogicRuntimeSubsystem* Subsystem = DispatchSubsystem.Get())
+	{
+		Subsystem->RegisterRuntimeGraph(this);
+	}
+
+	OPENLOGIC_TRACE_GRAPH(this);
+}
+
+namespace OpenLogicGraphPatch
+{
+	// Whether a node runs differently with the new data. Moving it in the editor does not count.
+	bool HasRuntimeChanges(const FOpenLogicNode& OldNode, const FOpenLogicNode& NewNode)
+	{
+		for (TFieldIterator<FProperty> It(FOpenLogicNode::StaticStruct()); It; ++It)
+		{
+			if (It->GetFName() != GET_MEMBER_NAME_CHECKED(FOpenLogicNode, Position) && !It->Identical_InContainer(&OldNode, &NewNode))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+FOpenLogicGraphPatchResult UOpenLogicRuntimeGraph::ApplyGraphDataPatch(const FOpenLogicGraphData& NewData)
+{
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	FOpenLogicGraphPatchResult Result;
+
+	if (!IsInGameThread())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ApplyGraphDataPatch] Graph data can only be patched on the game thread."));
+		return Result;
+	}
+
+	// The graph thread holds nodes and graph data while it runs a handle, so it is paused until the patch is applied
+	TOptional<FScopeLock> GraphThreadLock;
+	if (Runnable)
+	{
+		GraphThreadLock.Emplace(&Runnable->GetProcessLock());
+	}
+
+	// A node whose task class changed is a different node, it is removed and added again
+	TSet<FGuid> RemovedNodes;
+	TSet<FGuid> ChangedNodes;
+
+	for (const TPair<FGuid, FOpenLogicNode>& OldNodePair : WorkerGraphData.Nodes)
+	{
+		const FOpenLogicNode* NewNode = NewData.Nodes.Find(OldNodePair.Key);
+		if (!NewNode || NewNode->TaskClass != OldNodePair.Value.TaskClass)
+		{
+			RemovedNodes.Add(OldNodePair.Key);
+		}
+		else if (OpenLogicGraphPatch::HasRuntimeChanges(OldNodePair.Value, *NewNode))
+		{
+			ChangedNodes.Add(OldNodePair.Key);
+		}
+	}
+
+	for (const TPair<FGuid, FOpenLogicNode>& NewNodePair : NewData.Nodes)
+	{
+		if (!WorkerGraphData.Nodes.Contains(NewNodePair.Key) || RemovedNodes.Contains(NewNodePair.Key))
+		{
+			Result.AddedNodes++;
+
+			if (!NewNodePair.Value.TaskClass.IsNull())
+			{
+				NewNodePair.Value.TaskClass.LoadSynchronous();
+			}
+		}
+	}
+
+	Result.RemovedNodes = RemovedNodes.Num();
+	Result.ChangedNodes = ChangedNodes.Num();
+
+	TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>> Handles;
+	HandleRegistry.GenerateValueArray(Handles);
+
+	for (TSharedPtr<FOpenLogicGraphExecutionHandle>& Handle : Handles)
+	{
+		if (!Handle.IsValid())
+		{
+			continue;
+		}
+
+		if (RemovedNodes.Contains(Handle->NodeID))
+		{
+			DestroyExecutionHandle(Handle);
+			Result.DestroyedHandles++;
+			continue;
+		}
+
+		for (auto It = Handle->RuntimeNodes.CreateIterator(); It; ++It)
+		{
+			TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = It->Value;
+			const bool bRemoved = RemovedNodes.Contains(It->Key);
+
+			if (!RuntimeNode.IsValid() || (!bRemoved && !ChangedNodes.Contains(It->Key)))
+			{
+				continue;
+			}
+
+			// Running nodes keep going, only the values of outputs whose type changed are dropped
+			if (!bRemoved && RuntimeNode->bPendingCompletion)
+			{
+				const FOpenLogicNode& OldNode = WorkerGraphData.Nodes[It->Key];
+				const FOpenLogicNode& NewNode = NewData.Nodes[It->Key];
+
+				for (auto OutputIt = RuntimeNode->OutputProperties.CreateIterator(); OutputIt; ++OutputIt)
+				{
+					if (OldNode.GetOutputPinData(OutputIt->Key).PropertyClass != NewNode.GetOutputPinData(OutputIt->Key).PropertyClass)
+					{
+						OutputIt.RemoveCurrent();
+					}
+				}
+
+				AllocateOutputSlots(*RuntimeNode, NewNode);
+				continue;
+			}
+
+			// Removed nodes are cancelled, idle changed nodes are dropped so they are evaluated again with the new data
+			if (RuntimeNode->bPendingCompletion)
+			{
+				RuntimeNode->bPendingCompletion = false;
+				Handle->PendingNodes--;
+				Result.CancelledNodes++;
+			}
+
+			ReleaseRuntimeNode(*RuntimeNode);
+			It.RemoveCurrent();
+			OPENLOGIC_COUNTER_DEC(RuntimeNodes, 1);
+		}
+
+		Result.PreservedHandles++;
+	}
+
+	// Persistent tasks keep their state unless their node is gone
+	for (auto It = PersistentNodes.CreateIterator(); It; ++It)
+	{
+		if (RemovedNodes.Contains(It->Key))
+		{
+			ReleasePersistentTask(It->Value);
+			It.RemoveCurrent();
+		}
+		else if (ChangedNodes.Contains(It->Key) && It->Value)
+		{
+			ImportTaskProperties(It->Value, NewData.Nodes[It->Key]);
+		}
+	}
+
+	WorkerGraphData = NewData;
+
+	BuildEventDispatchIndex();
+	BuildSnapshotNodeTable();
+
+	// Handles only waiting on cancelled nodes are done
+	for (TSharedPtr<FOpenLogicGraphExecutionHandle>& Handle : Handles)
+	{
+		if (Handle.IsValid() && HandleRegistry.Contains(Handle->HandleIndex))
+		{
+			TryFinishExecutionHandle(Handle);
+		}
+	}
+
+	if (UOpenLogicRuntimeSubsystem* Subsystem = DispatchSubsystem.Get())
+	{
+		Subsystem->RegisterRuntimeGraph(this);
+	}
+
+	OPENLOGIC_TRACE_GRAPH(this);
+
+	UE_LOG(OpenLogicLog, Verbose, TEXT("[ApplyGraphDataPatch] %s: %d added, %d removed, %d changed nodes, %d cancelled nodes, %d destroyed and %d preserved handles."),
+		*GetName(), Result.AddedNodes, Result.RemovedNodes, Result.ChangedNodes, Result.CancelledNodes, Result.DestroyedHandles, Result.PreservedHandles);
+
+	return Result;
+}
+
+FOpenLogicNode UOpenLogicRuntimeGraph::GetNodeData(FGuid NodeID) const
+{
+	const FOpenLogicNode* NodeData = NodeID.IsValid() ? WorkerGraphData.Nodes.Find(NodeID) : nullptr;
+	if (!NodeData)
+	{
+		return FOpenLogicNode();
+	}
+	
+	return *NodeData;
+}
+
+FOpenLogicMemoryFootprint UOpenLogicRuntimeGraph::GetMemoryFootprint() const
+{
+	FOpenLogicMemoryFootprint Footprint;
+
+	// Graph data
+	Footprint.GraphDataBytes = WorkerGraphData.Nodes.GetAllocatedSize() + WorkerGraphData.Events.GetAllocatedSize();
+
+	for (const TPair<FGuid, FOpenLogicNode>& NodePair : WorkerGraphData.Nodes)
+	{
+		const FOpenLogicNode& Node = NodePair.Value;
+
+		Footprint.GraphDataBytes += Node.InputPins.GetAllocatedSize() + Node.OutputPins.GetAllocatedSize();
+		Footprint.GraphDataBytes += Node.BlueprintContent.GetAllocatedSize() + Node.CppContent.GetAllocatedSize();
+
+		for (const TMap<int32, FOpenLogicPinState>* Pins : { &Node.InputPins, &Node.OutputPins })
+		{
+			for (const TPair<int32, FOpenLogicPinState>& PinPair : *Pins)
+			{
+				Footprint.GraphDataBytes += PinPair.Value.Connections.GetAllocatedSize() + PinPair.Value.DefaultValue.SerializedData.GetAllocatedSize();
+			}
+		}
+
+		for (const TPair<FGuid, FString>& Content : Node.BlueprintContent)
+		{
+			Footprint.GraphDataBytes += Content.Value.GetAllocatedSize();
+		}
+
+		for (const TPair<FName, FString>& Content : Node.CppContent)
+		{
+			Footprint.GraphDataBytes += Content.Value.GetAllocatedSize();
+		}
+	}
+
+	for (const TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicEventContainer>& EventPair : WorkerGraphData.Events)
+	{
+		Footprint.GraphDataBytes += EventPair.Value.NodeId.GetAllocatedSize();
+	}
+
+	// Execution handles, runtime nodes and values
+	Footprint.HandleCount = HandleRegistry.Num();
+	Footprint.HandleBytes = HandleRegistry.GetAllocatedSize();
+
+	// The same value can be shared between a producer's output and its consumers' inputs
+	TSet<const void*> CountedValues;
+
+	auto AccumulateValues = [this, &Footprint, &CountedValues](const FOpenLogicNode* NodeData, const TMap<int32, TSharedPtr<void>>& Values, bool bIsInput)
+	{
+		for (const TPair<int32, TSharedPtr<void>>& ValuePair : Values)
+		{
+			bool bAlreadyCounted = false;
+			CountedValues.Add(ValuePair.Value.Get(), &bAlreadyCounted);
+
+			if (bAlreadyCounted || !NodeData)
+			{
+				continue;
+			}
+
+			const FOpenLogicPinData PinData = bIsInput ? NodeData->GetInputPinData(ValuePair.Key) : NodeData->GetOutputPinData(ValuePair.Key);
+			const UOpenLogicProperty* PropertyObject = PinData.PropertyClass ? PinData.PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+
+			Footprint.ValueBytes += PropertyObject ? PropertyObject->GetValueAllocatedSize(ValuePair.Value.Get()) : 0;
+		}
+	};
+
+	for (const TPair<int32, TSharedPtr<FOpenLogicGraphExecutionHandle>>& HandlePair : HandleRegistry)
+	{
+		const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle = HandlePair.Value;
+		if (!ExecutionHandle.IsValid())
+		{
+			continue;
+		}
+
+		Footprint.HandleBytes += sizeof(FOpenLogicGraphExecutionHandle) + ExecutionHandle->RuntimeNodes.GetAllocatedSize();
+
+		for (const TPair<FGuid, TSharedPtr<FOpenLogicRuntimeNode>>& NodePair : ExecutionHandle->RuntimeNodes)
+		{
+			const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode = NodePair.Value;
+			if (!RuntimeNode.IsValid())
+			{
+				continue;
+			}
+
+			Footprint.RuntimeNodeCount++;
+			Footprint.RuntimeNodeBytes += sizeof(FOpenLogicRuntimeNode) + RuntimeNode->InputProperties.GetAllocatedSize() + RuntimeNode->OutputProperties.GetAllocatedSize() + RuntimeNode->OutputSlots.GetAllocatedSize();
+
+			const FOpenLogicNode* NodeData = WorkerGraphData.Nodes.Find(NodePair.Key);
+			AccumulateValues(NodeData, RuntimeNode->InputProperties, true);
+			AccumulateValues(NodeData, RuntimeNode->OutputProperties, false);
+
+			// Slots that were not written yet
+			for (const FOpenLogicOutputSlot& Slot : RuntimeNode->OutputSlots)
+			{
+				bool bAlreadyCounted = true;
+				if (Slot.Value.IsValid())
+				{
+					CountedValues.Add(Slot.Value.Get(), &bAlreadyCounted);
+				}
+
+				if (!bAlreadyCounted)
+				{
+					Footprint.ValueBytes += Slot.PropertyObject->GetValueAllocatedSize(Slot.Value.Get());
+				}
+			}
+		}
+	}
+
+	// Task pools
+	FScopeLock Lock(&TaskPoolLock);
+	Footprint.TaskPoolBytes = TaskPools.GetAllocatedSize() + PersistentNodes.GetAllocatedSize();
+
+	for (const TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicTaskPool>& PoolPair : TaskPools)
 	{
-		if (Property && Ptr)
+		const FOpenLogicTaskPool& TaskPool = PoolPair.Value;
+		const int32 TaskCount = TaskPool.AvailableTasks.Num() + TaskPool.ActiveTasks.Num();
+		const int64 TaskSize = PoolPair.Key ? PoolPair.Key->GetStructureSize() : 0;
+
+		Footprint.PooledTaskCount += TaskCount;
+		Footprint.TaskPoolBytes += TaskPool.AvailableTasks.GetAllocatedSize() + TaskPool.ActiveTasks.GetAllocatedSize() + TaskCount * TaskSize;
+	}
+
+	Footprint.GCObjectCount = CountGCObjects();
+	Footprint.TotalBytes = Footprint.GraphDataBytes + Footprint.HandleBytes + Footprint.RuntimeNodeBytes + Footprint.ValueBytes + Footprint.TaskPoolBytes;
+
+	return Footprint;
+}
+
+int32 UOpenLogicRuntimeGraph::GetGCObjectCount() const
+{
+	FScopeLock Lock(&TaskPoolLock);
+	return CountGCObjects();
+}
+
+int32 UOpenLogicRuntimeGraph::CountGCObjects() const
+{
+	int32 ObjectCount = 0;
+
+	for (const TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicTaskPool>& PoolPair : TaskPools)
+	{
+		ObjectCount += PoolPair.Value.AvailableTasks.Num() + PoolPair.Value.ActiveTasks.Num();
+	}
+
+	// Persistent tasks stay in their pool until released (e.g. by a graph patch)
+	for (const TPair<FGuid, UOpenLogicTask*>& PersistentPair : PersistentNodes)
+	{
+		const FOpenLogicTaskPool* TaskPool = PersistentPair.Value ? TaskPools.Find(PersistentPair.Value->GetClass()) : nullptr;
+		if (PersistentPair.Value && (!TaskPool || !TaskPool->ActiveTasks.Contains(PersistentPair.Value)))
 		{
-			Property->DestroyValue(Ptr);
+			ObjectCount++;
 		}
-		FMemory::Free(Ptr);
-	});
+	}
 
-	SetDataPropertyValue(TaskInstance, PinName, Value);
+	return ObjectCount;
 }
 
-TSharedPtr<void> UOpenLogicRuntimeGraph::GetDataPropertyValue(UOpenLogicTask* TaskInstance, FName PinName)
+TArray<FOpenLogicPriorityQueueMetrics> UOpenLogicRuntimeGraph::GetQueueMetrics() const
 {
-	if (!IsValid(TaskInstance) || !PinName.IsValid())
+	TArray<FOpenLogicPriorityQueueMetrics> Metrics;
+
+	if (Runnable)
 	{
-		return nullptr;
+		Runnable->GetQueueMetrics(Metrics);
+		return Metrics;
 	}
 
-	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
-	if (!RuntimeNode.IsValid() || RuntimeNode->TaskState != EOpenLogicTaskState::Running)
+	for (int32 PriorityIndex = 0; PriorityIndex < OpenLogicExecutionPriorityCount; PriorityIndex++)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[GetDataPropertyValue] Invalid RuntimeNode or TaskState."));
-		return nullptr;
+		FOpenLogicPriorityQueueMetrics& PriorityMetrics = Metrics.AddDefaulted_GetRef();
+		PriorityMetrics.Priority = static_cast<EOpenLogicExecutionPriority>(PriorityIndex);
 	}
 
-	const FOpenLogicNode& NodeData = GetNodeData(RuntimeNode->NodeID);
-	const int32 PinIndex = NodeData.GetInputPinIndexFromName(PinName);
+	return Metrics;
+}
 
-	if (PinIndex == INDEX_NONE)
+int32 UOpenLogicRuntimeGraph::TrimTaskPools(int32 MaxAvailableTasks)
+{
+	if (!IsInGameThread())
 	{
-		return nullptr;
+		UE_LOG(OpenLogicLog, Error, TEXT("[TrimTaskPools] Task pools can only be trimmed on the game thread."));
+		return 0;
 	}
 
-	TSharedPtr<void> FoundValue = RuntimeNode->InputProperties.FindRef(PinIndex);
-	if (!FoundValue.IsValid())
+	FScopeLock Lock(&TaskPoolLock);
+
+	int32 ReleasedCount = 0;
+	for (TPair<TSubclassOf<UOpenLogicTask>, FOpenLogicTaskPool>& PoolPair : TaskPools)
 	{
-		return nullptr;
+		ReleasedCount += PoolPair.Value.Trim(MaxAvailableTasks);
 	}
 
-	return FoundValue;
+	return ReleasedCount;
 }
 
-void UOpenLogicRuntimeGraph::PreloadInputPropertiesForNode(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+void UOpenLogicRuntimeGraph::StartRecording()
 {
-	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
+	if (!Recorder.IsValid())
 	{
-		return;
+		Recorder = MakeUnique<FOpenLogicExecutionRecorder>();
 	}
 
-	RuntimeNode->InputProperties.Empty();
+	Recorder->Start(WorkerGraphData);
+}
 
-	const FOpenLogicNode& NodeData = GetNodeData(RuntimeNode->NodeID);
+bool UOpenLogicRuntimeGraph::StopRecording(const FString& FilePath)
+{
+	FOpenLogicExecutionTrace Trace;
+	if (!StopRecordingTrace(Trace))
+	{
+		return false;
+	}
 
-	for (const auto& InputPinPair : NodeData.InputPins)
+	return Trace.SaveToFile(FilePath.IsEmpty() ? FOpenLogicExecutionTrace::GetDefaultFilePath(GetName()) : FilePath);
+}
+
+bool UOpenLogicRuntimeGraph::StopRecordingTrace(FOpenLogicExecutionTrace& OutTrace)
+{
+	if (!IsRecording())
 	{
-		const int32 InputPinIndex = InputPinPair.Key;
-		const FOpenLogicPinState& InputPinState = InputPinPair.Value;
+		return false;
+	}
 
-		const FOpenLogicPinData& PinData = NodeData.GetInputPinData(InputPinIndex);
-		if (PinData.Role != EPinRole::DataProperty)
-		{
-			continue;
-		}
+	OutTrace = Recorder->Stop();
+	return true;
+}
 
-		TSharedPtr<void> PropertyValue;
+bool UOpenLogicRuntimeGraph::IsRecording() const
+{
+	return Recorder.IsValid() && Recorder->IsRecording();
+}
 
-		if (InputPinState.Connections.Num() > 0)
-		{
-			PropertyValue = ResolveConnectedPinValue(RuntimeNode, ExecutionHandle, InputPinState.Connections[0]);
-		}
+bool UOpenLogicRuntimeGraph::ReplayTrace(const FOpenLogicExecutionTrace& Trace)
+{
+	if (IsReplaying())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ReplayTrace] %s is already replaying a trace."), *GetName());
+		return false;
+	}
 
-		// Fallback to default value if no connection is found
-		if (!PropertyValue.IsValid())
-		{
-			if (const UOpenLogicProperty* PropertyInstance = Cast<UOpenLogicProperty>(PinData.PropertyClass->GetDefaultObject()))
-			{
-				PropertyValue = CreatePropertyValueFromDefault(InputPinState.DefaultValue, PropertyInstance);
-			}
-		}
+	SetGraphData(Trace.GraphData);
 
-		if (PropertyValue.IsValid())
-		{
-			RuntimeNode->InputProperties.Add(InputPinIndex, PropertyValue);
-		}
+	FOpenLogicExecutionReplayer TraceReplayer(this, Trace);
+
+	Replayer = &TraceReplayer;
+	const bool bMatched = TraceReplayer.Run();
+	Replayer = nullptr;
+
+	if (!bMatched)
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[ReplayTrace] %s diverged from the recording %d time(s)."), *GetName(), TraceReplayer.GetDivergenceCount());
 	}
+
+	return bMatched;
 }
 
-TSharedPtr<void> UOpenLogicRuntimeGraph::ResolveConnectedPinValue(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, const FOpenLogicPinConnection& Connection)
+bool UOpenLogicRuntimeGraph::ReplayTraceFromFile(const FString& FilePath)
 {
-	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid() || !Connection.NodeID.IsValid())
+	FOpenLogicExecutionTrace Trace;
+	if (!Trace.LoadFromFile(FilePath))
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ResolveConnectedPinValue] Invalid parameters."));
-		return nullptr;
+		return false;
 	}
 
-	bool bConnectionNodeFound = ExecutionHandle->RuntimeNodes.Contains(Connection.NodeID);
+	return ReplayTrace(Trace);
+}
 
-	TSharedPtr<FOpenLogicRuntimeNode> ConnectionRuntimeNode = ProcessNodeByGUID(Connection.NodeID, ExecutionHandle);
-	if (!ConnectionRuntimeNode.IsValid())
+namespace OpenLogicGraphSnapshot
+{
+	// "OLSS"
+	constexpr uint32 Magic = 0x53534C4F;
+	constexpr int32 Version = 3;
+
+	enum ENodeFlags : uint8
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ResolveConnectedPinValue] ConnectionRuntimeNode not valid."));
-		return nullptr;
+		PendingCompletion = 1 << 0,
+		HasTaskInstance = 1 << 1,
+		// Version 2
+		HasInstanceData = 1 << 2
+	};
+
+	// Version 3: the priority of an execution handle is stored in its flags, after IsProcessed and IsRunning
+	constexpr uint8 HandlePriorityShift = 2;
+	constexpr uint8 HandlePriorityMask = 0x3;
+
+	// Task state is prefixed with its size, so a task reading back less than it wrote does not shift the rest of the snapshot
+	void SaveTaskState(FArchive& Ar, TFunctionRef<void(FArchive&)> SerializeState)
+	{
+		const int64 SizeOffset = Ar.Tell();
+		uint32 Size = 0;
+		Ar << Size;
+
+		const int64 StateOffset = Ar.Tell();
+		SerializeState(Ar);
+
+		const int64 EndOffset = Ar.Tell();
+		Size = static_cast<uint32>(EndOffset - StateOffset);
+		Ar.Seek(SizeOffset);
+		Ar << Size;
+		Ar.Seek(EndOffset);
 	}
 
-	if (!bConnectionNodeFound || ConnectionRuntimeNode->bReevaluateOnDemand)
+	void LoadTaskState(FArchive& Ar, TFunctionRef<void(FArchive&)> SerializeState)
 	{
-		UOpenLogicTask* TaskInstance = ConnectionRuntimeNode->TaskInstance;
-		if (!TaskInstance)
+		uint32 Size = 0;
+		Ar << Size;
+
+		const int64 EndOffset = Ar.Tell() + Size;
+		if (EndOffset > Ar.TotalSize())
 		{
-			ConnectionRuntimeNode->TaskInstance = GetOrCreateTaskInstance(ConnectionRuntimeNode, ExecutionHandle);
-			InitializeTaskInstance(ConnectionRuntimeNode->TaskInstance, ConnectionRuntimeNode, ExecutionHandle);
+			Ar.SetError();
+			return;
 		}
 
-		ActivateNode(ConnectionRuntimeNode, NAME_None);
+		SerializeState(Ar);
+		Ar.Seek(EndOffset);
 	}
 
-	if (const TSharedPtr<void>* FoundValue = ConnectionRuntimeNode->OutputProperties.Find(Connection.PinID))
+	// Returns the index of a node in the snapshot node table, INDEX_NONE after flagging the archive if it is out of range
+	int32 LoadNodeIndex(FArchive& Ar, int32 TableSize)
 	{
-		return *FoundValue;
+		uint32 NodeIndex = 0;
+		Ar.SerializeIntPacked(NodeIndex);
+
+		if (NodeIndex >= static_cast<uint32>(TableSize))
+		{
+			Ar.SetError();
+			return INDEX_NONE;
+		}
+
+		return static_cast<int32>(NodeIndex);
 	}
-	return nullptr;
 }
 
-TSharedPtr<void> UOpenLogicRuntimeGraph::CreatePropertyValueFromDefault(const FOpenLogicDefaultValue& DefaultValue, const UOpenLogicProperty* PropertyInstance)
+void UOpenLogicRuntimeGraph::SaveState(TArray<uint8>& OutData)
 {
-	if (!PropertyInstance)
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_SaveState);
+
+	OutData.Reset();
+
+	if (!IsInGameThread())
 	{
-		return nullptr;
+		UE_LOG(OpenLogicLog, Error, TEXT("[SaveState] The state of a runtime graph can only be saved on the game thread."));
+		return;
 	}
 
-	switch (PropertyInstance->UnderlyingType)
+	// The graph thread changes nodes and handles while it runs, so it is paused until the whole state is captured
+	TOptional<FScopeLock> GraphThreadLock;
+	if (Runnable)
 	{
-		case EOpenLogicUnderlyingType::Boolean:
-		{
-			bool Value = false;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<bool>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Byte:
-		{
-			uint8 Value = 0;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<uint8>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Int:
-		{
-			int32 Value = 0;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<int32>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Float:
-		{
-			float Value = 0.0f;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<float>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Double:
-		{
-			double Value = 0.0;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<double>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::String:
-		{
-			FString Value;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<FString>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Name:
-		{
-			FName Value;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<FName>(Value);
-			}
-			break;
-		}
-		case EOpenLogicUnderlyingType::Text:
+		GraphThreadLock.Emplace(&Runnable->GetProcessLock());
+	}
+
+	FMemoryWriter Writer(OutData);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	uint32 Magic = OpenLogicGraphSnapshot::Magic;
+	int32 Version = OpenLogicGraphSnapshot::Version;
+	uint32 NodeTableHash = SnapshotNodeTableHash;
+	uint32 NextHandleIndex = static_cast<uint32>(HandleCounter);
+
+	Ar << Magic;
+	Ar << Version;
+	Ar << NodeTableHash;
+	Ar.SerializeIntPacked(NextHandleIndex);
+
+	// Persistent tasks first, so they exist when the runtime nodes using them are restored
+	TArray<TPair<uint32, UOpenLogicTask*>, TInlineAllocator<16>> SavedPersistentNodes;
+	for (const TPair<FGuid, UOpenLogicTask*>& PersistentPair : PersistentNodes)
+	{
+		const int32* NodeIndex = SnapshotNodeIndices.Find(PersistentPair.Key);
+		if (NodeIndex && IsValid(PersistentPair.Value))
 		{
-			FText Value;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<FText>(Value);
-			}
-			break;
+			SavedPersistentNodes.Emplace(static_cast<uint32>(*NodeIndex), PersistentPair.Value);
 		}
-		case EOpenLogicUnderlyingType::Object:
-		case EOpenLogicUnderlyingType::Class:
+	}
+
+	uint32 PersistentCount = SavedPersistentNodes.Num();
+	Ar.SerializeIntPacked(PersistentCount);
+
+	for (TPair<uint32, UOpenLogicTask*>& PersistentNode : SavedPersistentNodes)
+	{
+		Ar.SerializeIntPacked(PersistentNode.Key);
+		UOpenLogicTask* PersistentTask = PersistentNode.Value;
+		OpenLogicGraphSnapshot::SaveTaskState(Ar, [PersistentTask](FArchive& StateAr) { PersistentTask->SerializeTaskState(StateAr); });
+	}
+
+	// Finished handles have nothing left to resume
+	TArray<FOpenLogicGraphExecutionHandle*, TInlineAllocator<16>> SavedHandles;
+	for (const TPair<int32, TSharedPtr<FOpenLogicGraphExecutionHandle>>& HandlePair : HandleRegistry)
+	{
+		FOpenLogicGraphExecutionHandle* Handle = HandlePair.Value.Get();
+		if (Handle && (!Handle->IsProcessed || Handle->IsRunning) && SnapshotNodeIndices.Contains(Handle->NodeID))
 		{
-			UObject* Value = nullptr;
-			if (DefaultValue.GetValue(Value))
-			{
-				return MakeShared<UObject*>(Value);
-			}
-			break;
+			SavedHandles.Add(Handle);
 		}
-		case EOpenLogicUnderlyingType::Enum:
+	}
+
+	uint32 HandleCount = SavedHandles.Num();
+	Ar.SerializeIntPacked(HandleCount);
+
+	TArray<const FOpenLogicRuntimeNode*, TInlineAllocator<32>> SavedNodes;
+
+	for (FOpenLogicGraphExecutionHandle* Handle : SavedHandles)
+	{
+		uint32 HandleIndex = static_cast<uint32>(Handle->HandleIndex);
+		uint32 EntryNodeIndex = static_cast<uint32>(SnapshotNodeIndices[Handle->NodeID]);
+		uint8 HandleFlags = (Handle->IsProcessed ? 1 : 0) | (Handle->IsRunning ? 2 : 0)
+			| ((static_cast<uint8>(Handle->Priority) & OpenLogicGraphSnapshot::HandlePriorityMask) << OpenLogicGraphSnapshot::HandlePriorityShift);
+
+		Ar.SerializeIntPacked(HandleIndex);
+		Ar.SerializeIntPacked(EntryNodeIndex);
+		Ar << HandleFlags;
+
+		SavedNodes.Reset();
+		for (const TPair<FGuid, TSharedPtr<FOpenLogicRuntimeNode>>& NodePair : Handle->RuntimeNodes)
 		{
-			int32 Value = 0;
-			if (DefaultValue.GetValue(Value))
+			if (NodePair.Value.IsValid() && SnapshotNodeIndices.Contains(NodePair.Key))
 			{
-				return MakeShared<int32>(Value);
+				SavedNodes.Add(NodePair.Value.Get());
 			}
-			break;
 		}
-		case EOpenLogicUnderlyingType::Struct:
+
+		uint32 NodeCount = SavedNodes.Num();
+		Ar.SerializeIntPacked(NodeCount);
+
+		for (const FOpenLogicRuntimeNode* RuntimeNode : SavedNodes)
 		{
-			if (!PropertyInstance || !PropertyInstance->StructType)
+			uint32 NodeIndex = static_cast<uint32>(SnapshotNodeIndices[RuntimeNode->NodeID]);
+			uint8 TaskState = static_cast<uint8>(RuntimeNode->TaskState);
+			uint8 NodeFlags = (RuntimeNode->bPendingCompletion ? OpenLogicGraphSnapshot::PendingCompletion : 0)
+				| (RuntimeNode->TaskInstance ? OpenLogicGraphSnapshot::HasTaskInstance : 0)
+				| (RuntimeNode->InstanceData.IsValid() ? OpenLogicGraphSnapshot::HasInstanceData : 0);
+
+			Ar.SerializeIntPacked(NodeIndex);
+			Ar << TaskState;
+			Ar << NodeFlags;
+
+			// Output values, as pin index and value pairs ended by pin 0 (pin indices start at 1)
+			const FOpenLogicNode& NodeData = WorkerGraphData.Nodes[RuntimeNode->NodeID];
+			for (const TPair<int32, TSharedPtr<void>>& OutputProperty : RuntimeNode->OutputProperties)
 			{
-				UE_LOG(OpenLogicLog, Error, TEXT("StructType is not set for property."));
-				break;
+				const UClass* PropertyClass = NodeData.GetOutputPinData(OutputProperty.Key).PropertyClass;
+				const UOpenLogicProperty* Property = PropertyClass ? PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+				if (!Property || !OutputProperty.Value.IsValid() || OutputProperty.Key <= 0)
+				{
+					continue;
+				}
+
+				const int64 PinOffset = Ar.Tell();
+				uint32 PinIndex = static_cast<uint32>(OutputProperty.Key);
+				Ar.SerializeIntPacked(PinIndex);
+
+				// Values that cannot be serialized (wildcards) are dropped
+				TSharedPtr<void> Value = OutputProperty.Value;
+				if (!Property->SerializeValue(Ar, Value))
+				{
+					Ar.Seek(PinOffset);
+				}
 			}
 
-			FOpenLogicDefaultValue StructValue = DefaultValue;
+			uint32 EndOfPins = 0;
+			Ar.SerializeIntPacked(EndOfPins);
 
-			return StructValue.DeserializeToStruct(PropertyInstance->StructType);
-		}
-		case EOpenLogicUnderlyingType::Wildcard:
-		{
-			// Wildcard — not enough info to safely deserialize
-			UE_LOG(OpenLogicLog, Error, TEXT("Wildcard type cannot be deserialized."));
-			break;
+			// Persistent tasks were saved above
+			if (RuntimeNode->TaskInstance && RuntimeNode->TaskInstance->NodeLifecycle != ENodeLifecycle::Persistent)
+			{
+				UOpenLogicTask* TaskInstance = RuntimeNode->TaskInstance;
+				OpenLogicGraphSnapshot::SaveTaskState(Ar, [TaskInstance](FArchive& StateAr) { TaskInstance->SerializeTaskState(StateAr); });
+			}
+
+			if (RuntimeNode->InstanceData.IsValid())
+			{
+				const FInstancedStruct& InstanceData = RuntimeNode->InstanceData;
+				OpenLogicGraphSnapshot::SaveTaskState(Ar, [&InstanceData](FArchive& StateAr)
+				{
+					InstanceData.GetScriptStruct()->SerializeItem(StateAr, const_cast<uint8*>(InstanceData.GetMemory()), nullptr);
+				});
+			}
 		}
 	}
 
-	return nullptr;
+	// Dropped values may have been longer than what was written over them
+	OutData.SetNum(static_cast<int32>(Ar.Tell()));
 }
 
-FOpenLogicDefaultValue UOpenLogicRuntimeGraph::GetDefaultValue(UOpenLogicTask* TaskInstance, FName PinName)
+bool UOpenLogicRuntimeGraph::LoadState(const TArray<uint8>& Data)
 {
-	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = FindRuntimeNodeForTask(TaskInstance);
-	if (!RuntimeNode.IsValid() || !PinName.IsValid())
+	SCOPE_CYCLE_COUNTER(STAT_OpenLogic_LoadState);
+	LLM_SCOPE_BYTAG(OpenLogic_RuntimeGraph);
+
+	if (!IsInGameThread())
 	{
-		return FOpenLogicDefaultValue();
+		UE_LOG(OpenLogicLog, Error, TEXT("[LoadState] The state of a runtime graph can only be loaded on the game thread."));
+		return false;
 	}
 
-	FOpenLogicNode NodeData = GetNodeData(RuntimeNode->NodeID);
-	int32 InputPinIndex = NodeData.GetInputPinIndexFromName(PinName);
-
-	if (InputPinIndex == -1 || !NodeData.InputPins.Contains(InputPinIndex))
+	// Handles are destroyed and rebuilt below, so the graph thread is paused until the whole state is restored
+	TOptional<FScopeLock> GraphThreadLock;
+	if (Runnable)
 	{
-		return FOpenLogicDefaultValue();
+		GraphThreadLock.Emplace(&Runnable->GetProcessLock());
 	}
 
-	return NodeData.InputPins[InputPinIndex].DefaultValue;
-}
+	FMemoryReader Reader(Data);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, true);
 
-TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeGraph::FindExecutionHandleForTask(const UOpenLogicTask* TaskInstance) const
-{
-	if (!TaskInstance || TaskInstance->GetExecutionHandleIndex() == INDEX_NONE)
-	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[FindExecutionHandleForTask] Invalid TaskInstance or ExecutionHandleIndex."));
-		return nullptr;
-	}
+	uint32 Magic = 0;
+	int32 Version = 0;
+	uint32 NodeTableHash = 0;
+	uint32 NextHandleIndex = 0;
 
-	int32 HandleIndex = TaskInstance->GetExecutionHandleIndex();
+	Ar << Magic;
+	Ar << Version;
+	Ar << NodeTableHash;
+	Ar.SerializeIntPacked(NextHandleIndex);
 
-	const TSharedPtr<FOpenLogicGraphExecutionHandle>* FoundHandle = HandleRegistry.Find(HandleIndex);
-	if (!FoundHandle || !FoundHandle->IsValid())
+	if (Ar.IsError() || Magic != OpenLogicGraphSnapshot::Magic || Version > OpenLogicGraphSnapshot::Version)
 	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[FindExecutionHandleForTask] ExecutionHandle not found for TaskInstance %s."), *TaskInstance->GetName());
-		return nullptr;
+		UE_LOG(OpenLogicLog, Error, TEXT("[LoadState] The data is not a valid runtime graph snapshot."));
+		return false;
 	}
 
-	return *FoundHandle;
-}
-
-TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::FindRuntimeNodeForTask( const UOpenLogicTask* TaskInstance) const
-{
-	if (!TaskInstance)
+	if (NodeTableHash != SnapshotNodeTableHash)
 	{
-		return nullptr;
+		UE_LOG(OpenLogicLog, Error, TEXT("[LoadState] The snapshot was saved for different graph data."));
+		return false;
 	}
 
-	TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = FindExecutionHandleForTask(TaskInstance);
-	if (!ExecutionHandle.IsValid())
+	// Whatever is running is replaced by the snapshot
+	TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>> ExistingHandles;
+	HandleRegistry.GenerateValueArray(ExistingHandles);
+
+	for (TSharedPtr<FOpenLogicGraphExecutionHandle>& ExistingHandle : ExistingHandles)
 	{
-		return nullptr;
+		DestroyExecutionHandle(ExistingHandle);
 	}
 
-	if (ExecutionHandle->RuntimeNodes.Contains(TaskInstance->GetGuid()))
+	// Persistent instances are released rather than pooled, so their state does not leak into the restored nodes
+	for (const TPair<FGuid, UOpenLogicTask*>& PersistentPair : PersistentNodes)
 	{
-		return ExecutionHandle->RuntimeNodes[TaskInstance->GetGuid()];
+		ReleasePersistentTask(PersistentPair.Value);
 	}
 
-	return nullptr;
-}
+	PersistentNodes.Reset();
+	HandleCounter = static_cast<int32>(NextHandleIndex);
 
-void UOpenLogicRuntimeGraph::ProcessExecutionHandle(TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
-{
-	if (!ExecutionHandle.IsValid() || ExecutionHandle->IsProcessed)
-	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[ProcessExecutionHandle] Invalid Handle."));
-		return;
-	}
+	const int32 NodeTableSize = SnapshotNodeTable.Num();
 
-	// Set the execution handle as processed and running
-	ExecutionHandle->IsProcessed = true;
-	ExecutionHandle->IsRunning = true;
+	uint32 PersistentCount = 0;
+	Ar.SerializeIntPacked(PersistentCount);
 
-	// Run the entry node
-	if (GetThreadSettings().NodeExecutionThread == EOpenLogicRuntimeThreadType::GameThread || !IsInGameThread())
+	for (uint32 Index = 0; Index < PersistentCount && !Ar.IsError(); Index++)
 	{
-		TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetOrCreateRuntimeNode(ExecutionHandle->NodeID, ExecutionHandle);
-		if (!RuntimeNode.IsValid())
+		const int32 NodeIndex = OpenLogicGraphSnapshot::LoadNodeIndex(Ar, NodeTableSize);
+		if (NodeIndex == INDEX_NONE)
 		{
-			return;
+			break;
 		}
 
-		ActivateNode(RuntimeNode, NAME_None);
-	} else
-	{
-		AddExecutionHandleToQueue(ExecutionHandle);
-	}
-}
+		const FGuid& NodeID = SnapshotNodeTable[NodeIndex];
+		const FOpenLogicNode& NodeData = WorkerGraphData.Nodes[NodeID];
 
-bool UOpenLogicRuntimeGraph::IsExecutionHandleValid(const FOpenLogicGraphExecutionHandle& ExecutionHandle)
-{
-	return ExecutionHandle.IsValid();
-}
+		TSubclassOf<UOpenLogicTask> TaskClass = NodeData.TaskClass.Get();
+		if (!TaskClass)
+		{
+			Ar.SetError();
+			break;
+		}
 
-TArray<FGuid> UOpenLogicRuntimeGraph::GetEventImplementations(TSubclassOf<UOpenLogicTask> TaskClass) const
-{
-	FOpenLogicGraphData GraphData = GetGraphData();
-	if (!GraphData.Events.Contains(TaskClass))
-	{
-		return TArray<FGuid>();
+		UOpenLogicTask* TaskInstance = nullptr;
+		{
+			FScopeLock Lock(&TaskPoolLock);
+			TaskInstance = TaskPools.FindOrAdd(TaskClass).GetTaskInstance(TaskClass, this);
+		}
+		TaskInstance->SetGuid(NodeID);
+		TaskInstance->SetRuntimeGraph(this);
+		ImportTaskProperties(TaskInstance, NodeData);
+
+		PersistentNodes.Add(NodeID, TaskInstance);
+		OpenLogicGraphSnapshot::LoadTaskState(Ar, [TaskInstance](FArchive& StateAr) { TaskInstance->SerializeTaskState(StateAr); });
 	}
 
-	return GraphData.Events[TaskClass].NodeId;
-}
+	uint32 HandleCount = 0;
+	Ar.SerializeIntPacked(HandleCount);
 
-TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicRuntimeGraph::GetOrCreateRuntimeNode(FGuid NodeID, TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle)
-{
-	if (!NodeID.IsValid() || !ExecutionHandle.IsValid())
-	{
-		return nullptr;
-	}
+	// Handles that were queued for the execution thread but had not started yet
+	TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>> QueuedHandles;
 
-	// Check if the runtime node already exists
-	if (TSharedPtr<FOpenLogicRuntimeNode>* ExistingRuntimeNode = ExecutionHandle->RuntimeNodes.Find(NodeID))
+	for (uint32 Index = 0; Index < HandleCount && !Ar.IsError(); Index++)
 	{
-		return *ExistingRuntimeNode;
-	}
+		uint32 HandleIndex = 0;
+		Ar.SerializeIntPacked(HandleIndex);
 
-	FOpenLogicNode NodeData = GetNodeData(NodeID);
+		const int32 EntryNodeIndex = OpenLogicGraphSnapshot::LoadNodeIndex(Ar, NodeTableSize);
+		if (EntryNodeIndex == INDEX_NONE)
+		{
+			break;
+		}
 
-	if (NodeData.TaskClass.IsNull())
-	{
-		UE_LOG(OpenLogicLog, Error, TEXT("[GetOrCreateRuntimeNode] Invalid TaskClass for NodeID %s."), *NodeID.ToString());
-		return nullptr;
-	}
+		uint8 HandleFlags = 0;
+		Ar << HandleFlags;
+
+		const FGuid& EntryNodeID = SnapshotNodeTable[EntryNodeIndex];
+
+		TSharedPtr<FOpenLogicGraphExecutionHandle> Handle = MakeShared<FOpenLogicGraphExecutionHandle>();
+		Handle->HandleIndex = static_cast<int32>(HandleIndex);
+		Handle->IsProcessed = (HandleFlags & 1) != 0;
+		Handle->IsRunning = (HandleFlags & 2) != 0;
+		Handle->Priority = Version >= 3
+			? static_cast<EOpenLogicExecutionPriority>((HandleFlags >> OpenLogicGraphSnapshot::HandlePriorityShift) & OpenLogicGraphSnapshot::HandlePriorityMask)
+			: EOpenLogicExecutionPriority::Normal;
+		Handle->TaskClass = WorkerGraphData.Nodes[EntryNodeID].TaskClass;
+		Handle->NodeID = EntryNodeID;
+		Handle->RuntimeGraph = this;
+		Handle->CancellationToken = FOpenLogicCancellationToken::Create();
+		Handle->TriggerCycles = FPlatformTime::Cycles64();
+		Handle->StartCycles = Handle->IsProcessed ? Handle->TriggerCycles : 0;
+
+		HandleRegistry.Add(Handle->HandleIndex, Handle);
+		OPENLOGIC_COUNTER_INC(ActiveHandles, 1);
+		OPENLOGIC_TRACE_HANDLE_CREATED(this, Handle->HandleIndex, EntryNodeID);
+
+		uint32 NodeCount = 0;
+		Ar.SerializeIntPacked(NodeCount);
+
+		for (uint32 NodeNumber = 0; NodeNumber < NodeCount && !Ar.IsError(); NodeNumber++)
+		{
+			const int32 NodeIndex = OpenLogicGraphSnapshot::LoadNodeIndex(Ar, NodeTableSize);
+			if (NodeIndex == INDEX_NONE)
+			{
+				break;
+			}
 
-	TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = MakeShared<FOpenLogicRuntimeNode>();
-	RuntimeNode->TaskClass = NodeData.TaskClass;
-	RuntimeNode->TaskState = EOpenLogicTaskState::None;
-	RuntimeNode->NodeID = NodeID;
-	RuntimeNode->TaskInstance = GetOrCreateTaskInstance(RuntimeNode, ExecutionHandle);
-	RuntimeNode->bReevaluateOnDemand = RuntimeNode->TaskInstance->ReevaluateOnDemand;
-	InitializeTaskInstance(RuntimeNode->TaskInstance, RuntimeNode, ExecutionHandle);
+			uint8 TaskState = 0;
+			uint8 NodeFlags = 0;
+			Ar << TaskState;
+			Ar << NodeFlags;
 
-	ExecutionHandle->RuntimeNodes.Add(NodeID, RuntimeNode);
+			const FGuid& NodeID = SnapshotNodeTable[NodeIndex];
+			const FOpenLogicNode& NodeData = WorkerGraphData.Nodes[NodeID];
 
-	return RuntimeNode;
-}
- 
-UOpenLogicTask* UOpenLogicRuntimeGraph::GetOrCreateTaskInstance(TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
-{
-	if (!RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
-	{
-		return nullptr;
-	}
+			TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetOrCreateRuntimeNode(NodeID, Handle);
+			if (!RuntimeNode.IsValid() || (!RuntimeNode->TaskInstance && !RuntimeNode->StructTask))
+			{
+				Ar.SetError();
+				break;
+			}
 
-	if (RuntimeNode->TaskInstance)
-	{
-		return RuntimeNode->TaskInstance;
-	}
+			RuntimeNode->TaskState = static_cast<EOpenLogicTaskState>(TaskState);
 
-	TSubclassOf<UOpenLogicTask> TaskClass = RuntimeNode->TaskClass.Get();
-	if (!TaskClass)
-	{
-		return nullptr;
+			uint32 PinIndex = 0;
+			for (Ar.SerializeIntPacked(PinIndex); PinIndex != 0 && !Ar.IsError(); Ar.SerializeIntPacked(PinIndex))
+			{
+				const UClass* PropertyClass = NodeData.GetOutputPinData(static_cast<int32>(PinIndex)).PropertyClass;
+				const UOpenLogicProperty* Property = PropertyClass ? PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr;
+
+				TSharedPtr<void> Value;
+				if (!Property || !Property->SerializeValue(Ar, Value))
+				{
+					Ar.SetError();
+					break;
+				}
+
+				RuntimeNode->OutputProperties.Add(static_cast<int32>(PinIndex), Value);
+			}
+
+			if (UOpenLogicTask* TaskInstance = RuntimeNode->TaskInstance)
+			{
+				const bool bPersistent = TaskInstance->NodeLifecycle == ENodeLifecycle::Persistent;
+
+				if (!(NodeFlags & OpenLogicGraphSnapshot::HasTaskInstance))
+				{
+					// The node had completed and released its instance
+					if (!bPersistent)
+					{
+						FScopeLock Lock(&TaskPoolLock);
+						TaskPools.FindOrAdd(TaskInstance->GetClass()).ReturnTaskInstance(TaskInstance, MaxAvailableTasksPerClass);
+						RuntimeNode->TaskInstance = nullptr;
+					}
+				}
+				else if (!bPersistent)
+				{
+					OpenLogicGraphSnapshot::LoadTaskState(Ar, [TaskInstance](FArchive& StateAr) { TaskInstance->SerializeTaskState(StateAr); });
+				}
+			}
+
+			// Instance data whose type is no longer used by the task is skipped
+			if (NodeFlags & OpenLogicGraphSnapshot::HasInstanceData)
+			{
+				FInstancedStruct& InstanceData = RuntimeNode->InstanceData;
+				OpenLogicGraphSnapshot::LoadTaskState(Ar, [&InstanceData](FArchive& StateAr)
+				{
+					if (InstanceData.IsValid())
+					{
+						InstanceData.GetScriptStruct()->SerializeItem(StateAr, InstanceData.GetMutableMemory(), nullptr);
+					}
+				});
+			}
+
+			if (NodeFlags & OpenLogicGraphSnapshot::PendingCompletion)
+			{
+				RuntimeNode->bPendingCompletion = true;
+				Handle->PendingNodes++;
+			}
+		}
+
+		if (Handle->IsProcessed && Handle->RuntimeNodes.Num() == 0)
+		{
+			QueuedHandles.Add(Handle);
+		}
 	}
 
-	if (PersistentNodes.Contains(RuntimeNode->NodeID))
+	if (Ar.IsError())
 	{
-		RuntimeNode->TaskInstance = PersistentNodes[RuntimeNode->NodeID];
-		return RuntimeNode->TaskInstance;
+		UE_LOG(OpenLogicLog, Error, TEXT("[LoadState] The snapshot is corrupted, the runtime graph state was only partially restored."));
+		return false;
 	}
 
-	// Get the task instance from the pool
-	FOpenLogicTaskPool& TaskPool = TaskPools.FindOrAdd(TaskClass);
-
-	UOpenLogicTask* TaskInstance = TaskPool.GetTaskInstance(TaskClass, this);
-
-	if (TaskInstance->NodeLifecycle == ENodeLifecycle::Persistent)
+	for (TSharedPtr<FOpenLogicGraphExecutionHandle>& QueuedHandle : QueuedHandles)
 	{
-		PersistentNodes.Add(RuntimeNode->NodeID, TaskInstance);
+		QueuedHandle->IsProcessed = false;
+		ProcessExecutionHandle(QueuedHandle);
 	}
 
-	return TaskInstance;
+	return true;
 }
 
-void UOpenLogicRuntimeGraph::InitializeTaskInstance(UOpenLogicTask* TaskInstance, const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+void UOpenLogicRuntimeGraph::EnableDebugEventStream(int32 Capacity)
 {
-	if (!TaskInstance || !RuntimeNode.IsValid() || !ExecutionHandle.IsValid())
+	if (DebugEventStreamUsers++ > 0)
 	{
 		return;
 	}
 
-	TaskInstance->SetGuid(RuntimeNode->NodeID);
-	TaskInstance->SetRuntimeGraph(this);
-	TaskInstance->SetExecutionHandleIndex(ExecutionHandle->HandleIndex);
+	if (!DebugEventStream.IsValid())
+	{
+		DebugEventStream = MakeShared<FOpenLogicDebugEventStream>(Capacity);
+	}
 
-	// Loading task properties
-	FOpenLogicNode NodeData = GetNodeData(RuntimeNode->NodeID);
+	DebugEventStream->SetEnabled(true);
 
-	for (const TPair<FGuid, FString> BlueprintContent : NodeData.BlueprintContent)
+	DebugEventTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UOpenLogicRuntimeGraph::TickDebugEventStream));
+}
+
+void UOpenLogicRuntimeGraph::DisableDebugEventStream()
+{
+	if (DebugEventStreamUsers == 0 || --DebugEventStreamUsers > 0)
 	{
-		FProperty* Property = FindFProperty<FProperty>(TaskInstance->GetClass(), TaskInstance->GetPropertyNameByGUID(BlueprintContent.Key));
-		if (!Property)
-		{
-			continue;
-		}
-		
-		// Capture any import errors
-		FOutputDeviceNull ErrorText;
-	
-		Property->ImportText_Direct(*BlueprintContent.Value, Property->ContainerPtrToValuePtr<void>(TaskInstance), this, PPF_None, &ErrorText);
+		return;
 	}
 
-	for (const TPair<FName, FString> CppContent : NodeData.CppContent)
+	if (DebugEventStream.IsValid())
 	{
-		FProperty* Property = FindFProperty<FProperty>(TaskInstance->GetClass(), CppContent.Key);
-		if (!Property)
-		{
-			continue;
-		}
-
-		// Capture any import errors
-		FOutputDeviceNull ErrorText;
-
-		Property->ImportText_Direct(*CppContent.Value, Property->ContainerPtrToValuePtr<void>(TaskInstance), this, PPF_None, &ErrorText);
+		DebugEventStream->SetEnabled(false);
 	}
 
+	FTSTicker::GetCoreTicker().RemoveTicker(DebugEventTickerHandle);
+	DebugEventTickerHandle.Reset();
 }
 
-/* Executes all the events associated with a specific Task class */
-void UOpenLogicRuntimeGraph::MultiExecuteEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool& bSuccess)
+void UOpenLogicRuntimeGraph::PushDebugEvent(EOpenLogicNodeDebugEventType Type, const FGuid& NodeID, int32 HandleIndex, UOpenLogicTask* TaskInstance)
 {
-	FOpenLogicGraphExecutionHandle EventExecutionHandle;
-	bSuccess = TriggerEvent(TaskClass, true, EventExecutionHandle);
+	if (DebugEventStream.IsValid() && DebugEventStream->IsEnabled())
+	{
+		DebugEventStream->Push(Type, NodeID, HandleIndex, TaskInstance);
+	}
 }
 
-void UOpenLogicRuntimeGraph::SetGraphData(FOpenLogicGraphData NewData)
+bool UOpenLogicRuntimeGraph::TickDebugEventStream(float DeltaTime)
 {
-	WorkerGraphData = NewData;
+	if (!DebugEventStream.IsValid())
+	{
+		return true;
+	}
 
-	for (auto& NodePair : WorkerGraphData.Nodes)
+	const int32 DroppedCount = DebugEventStream->Drain(DrainedDebugEvents);
+	if (DrainedDebugEvents.IsEmpty() && DroppedCount == 0)
 	{
-		TSoftClassPtr<UOpenLogicTask> TaskClass = NodePair.Value.TaskClass;
-		if (TaskClass.IsNull())
-		{
-			continue;
-		}
-		
-		TaskClass.LoadSynchronous();
+		return true;
 	}
-}
 
-FOpenLogicNode UOpenLogicRuntimeGraph::GetNodeData(FGuid NodeID) const
-{
-	if (!NodeID.IsValid() || !GetGraphData().Nodes.Contains(NodeID))
+	if (OnDebugEventsNative.IsBound())
 	{
-		return FOpenLogicNode();
+		OnDebugEventsNative.Broadcast(DrainedDebugEvents, DroppedCount);
 	}
-	
-	return GetGraphData().Nodes[NodeID];
+
+	if (OnDebugEvents.IsBound())
+	{
+		OnDebugEvents.Broadcast(DrainedDebugEvents, DroppedCount);
+	}
+
+	return true;
 }
 
 void UOpenLogicRuntimeGraph::SetThreadSettings(FOpenLogicThreadSettings& NewThreadSettings)
@@ -873,7 +2716,7 @@ void UOpenLogicRuntimeGraph::SetThreadSettings(FOpenLogicThreadSettings& NewThre
 	if (ThreadSettings.NodeExecutionThread == EOpenLogicRuntimeThreadType::BackgroundThread)
 	{
 		// Create the thread
-		Runnable = new FOpenLogicGraphRunnable(this);
+		Runnable = new FOpenLogicGraphRunnable(this, ThreadSettings.PriorityAgingSeconds);
 		RunnableThread = FRunnableThread::Create(Runnable, TEXT("OpenLogicGraphThread"), 0, TPri_Normal);
 
 		UE_LOG(OpenLogicLog, Log, TEXT("Successfully launched runtime graph thread - %d"), RunnableThread->GetThreadID());
@@ -892,7 +2735,13 @@ bool UOpenLogicRuntimeGraph::AddExecutionHandleToQueue(TSharedPtr<FOpenLogicGrap
 		return false;
 	}
 
-	Runnable->AddExecutionHandle(FOpenLogicQueuedExecutionHandle{ExecutionHandle->HandleIndex});
+	OPENLOGIC_TRACE_QUEUE_ENQUEUE(this, ExecutionHandle->HandleIndex);
+	OPENLOGIC_COUNTER_INC(QueuedActivations, 1);
+
+	FOpenLogicQueuedExecutionHandle QueueData;
+	QueueData.HandleIndex = ExecutionHandle->HandleIndex;
+	QueueData.Priority = ExecutionHandle->Priority;
+	Runnable->AddExecutionHandle(QueueData);
 
 	return true;
 }
@@ -912,6 +2761,51 @@ void UOpenLogicRuntimeGraph::DestroyWorker()
 	PersistentNodes.Empty();
 }
 
+void UOpenLogicRuntimeGraph::BeginDestroy()
+{
+	// Release what this graph still holds from the global counters
+	int32 RuntimeNodeCount = 0;
+	for (const auto& HandlePair : HandleRegistry)
+	{
+		RuntimeNodeCount += HandlePair.Value.IsValid() ? HandlePair.Value->RuntimeNodes.Num() : 0;
+	}
+
+	int32 AvailableTaskCount = 0;
+	int32 ActiveTaskCount = 0;
+	for (const auto& PoolPair : TaskPools)
+	{
+		AvailableTaskCount += PoolPair.Value.AvailableTasks.Num();
+		ActiveTaskCount += PoolPair.Value.ActiveTasks.Num();
+	}
+
+	OPENLOGIC_COUNTER_DEC(ActiveHandles, HandleRegistry.Num());
+	OPENLOGIC_COUNTER_DEC(RuntimeNodes, RuntimeNodeCount);
+	OPENLOGIC_COUNTER_DEC(PooledTasksAvailable, AvailableTaskCount);
+	OPENLOGIC_COUNTER_DEC(PooledTasksActive, ActiveTaskCount);
+
+	if (DebugEventTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebugEventTickerHandle);
+		DebugEventTickerHandle.Reset();
+	}
+
+	{
+		FScopeLock Lock(&TimeoutLock);
+		if (TimeoutTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TimeoutTickerHandle);
+			TimeoutTickerHandle.Reset();
+		}
+	}
+
+	if (UOpenLogicRuntimeSubsystem* Subsystem = DispatchSubsystem.Get())
+	{
+		Subsystem->UnregisterRuntimeGraph(this);
+	}
+
+	Super::BeginDestroy();
+}
+
 void UOpenLogicRuntimeGraph::CleanupThread()
 {
 	if (RunnableThread)
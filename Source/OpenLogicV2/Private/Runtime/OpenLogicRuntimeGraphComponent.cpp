@@ -4,6 +4,12 @@
 #include "Runtime/OpenLogicRuntimeGraphComponent.h"
 
 #include "Utility/OpenLogicUtility.h"
+#include "Subsystems/OpenLogicRuntimeSubsystem.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 // Sets default values for this component's properties
 UOpenLogicRuntimeGraphComponent::UOpenLogicRuntimeGraphComponent()
@@ -11,6 +17,8 @@ UOpenLogicRuntimeGraphComponent::UOpenLogicRuntimeGraphComponent()
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
+
+	ReplicatedState.Owner = this;
 }
 
 
@@ -25,8 +33,30 @@ void UOpenLogicRuntimeGraphComponent::BeginPlay()
 	// Bind the events
 	if (RuntimeGraph)
 	{
-		RuntimeGraph->OnNodeActivated.AddDynamic(this, &UOpenLogicRuntimeGraphComponent::HandleNodeActivated);
-		RuntimeGraph->OnNodeCompleted.AddDynamic(this, &UOpenLogicRuntimeGraphComponent::HandleNodeCompleted);
+		RuntimeGraph->OnNodeActivatedNative.AddUObject(this, &UOpenLogicRuntimeGraphComponent::HandleNodeActivated);
+		RuntimeGraph->OnNodeCompletedNative.AddUObject(this, &UOpenLogicRuntimeGraphComponent::HandleNodeCompleted);
+		RuntimeGraph->OnNodeActivationEndNative.AddUObject(this, &UOpenLogicRuntimeGraphComponent::HandleNodeActivationEnd);
+	}
+
+	// Subscribe to the event bus channels
+	UOpenLogicRuntimeSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UOpenLogicRuntimeSubsystem>() : nullptr;
+	if (RuntimeGraph && Subsystem)
+	{
+		for (const FName& Channel : EventChannels)
+		{
+			Subsystem->SubscribeToChannel(RuntimeGraph, Channel);
+		}
+	}
+
+	// Start sending the node states to clients
+	if (bReplicateExecutionState)
+	{
+		SetIsReplicated(true);
+
+		if (RuntimeGraph && GetOwnerRole() == ROLE_Authority)
+		{
+			GetWorld()->GetTimerManager().SetTimer(ReplicationTimerHandle, this, &UOpenLogicRuntimeGraphComponent::FlushReplicatedState, FMath::Max(ReplicationInterval, 0.01f), true);
+		}
 	}
 	
 	if (RuntimeGraph && BeginPlayEvent)
@@ -39,10 +69,22 @@ void UOpenLogicRuntimeGraphComponent::EndPlay(const EEndPlayReason::Type EndPlay
 {
 	Super::EndPlay(EndPlayReason);
 
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ReplicationTimerHandle);
+	}
+
 	if (RuntimeGraph && EndPlayEvent)
 	{
 		RuntimeGraph->TriggerAllEvents(EndPlayEvent);
 	}
+
+	// The graph no longer receives broadcasts once its owner left play
+	UOpenLogicRuntimeSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UOpenLogicRuntimeSubsystem>() : nullptr;
+	if (RuntimeGraph && Subsystem)
+	{
+		Subsystem->UnregisterRuntimeGraph(RuntimeGraph);
+	}
 }
 
 // Called every frame
@@ -51,15 +93,178 @@ void UOpenLogicRuntimeGraphComponent::TickComponent(float DeltaTime, ELevelTick
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 }
 
+void UOpenLogicRuntimeGraphComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UOpenLogicRuntimeGraphComponent, ReplicatedState);
+}
+
 void UOpenLogicRuntimeGraphComponent::HandleNodeActivated(UOpenLogicTask* NewActivatedNode)
 {
 	// Trigger the component's OnNodeActivated delegate
-	OnNodeActivated.Broadcast(NewActivatedNode);
+	if (OnNodeActivated.IsBound())
+	{
+		OnNodeActivated.Broadcast(NewActivatedNode);
+	}
 }
 
 void UOpenLogicRuntimeGraphComponent::HandleNodeCompleted(UOpenLogicTask* NewCompletedNode)
 {
+	if (bReplicateExecutionState && GetOwnerRole() == ROLE_Authority)
+	{
+		CaptureNodeState(NewCompletedNode, EOpenLogicTaskState::Completed);
+	}
+
 	// Trigger the component's OnNodeCompleted delegate
-	OnNodeCompleted.Broadcast(NewCompletedNode);
+	if (OnNodeCompleted.IsBound())
+	{
+		OnNodeCompleted.Broadcast(NewCompletedNode);
+	}
+}
+
+void UOpenLogicRuntimeGraphComponent::HandleNodeActivationEnd(UOpenLogicTask* ActivatedNode)
+{
+	if (!bReplicateExecutionState || GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// Tasks that completed during their activation were captured by HandleNodeCompleted and may already be released
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = ActivatedNode ? ActivatedNode->GetBoundRuntimeNode() : nullptr;
+	if (RuntimeNode.IsValid() && RuntimeNode->TaskState == EOpenLogicTaskState::Running)
+	{
+		CaptureNodeState(ActivatedNode, EOpenLogicTaskState::Running);
+	}
+}
+
+bool UOpenLogicRuntimeGraphComponent::GetReplicatedNodeState(FGuid NodeID, FOpenLogicReplicatedNodeState& OutNodeState) const
+{
+	const FOpenLogicReplicatedNodeState* NodeState = ReplicatedState.FindNodeState(NodeID);
+	if (!NodeState)
+	{
+		return false;
+	}
+
+	OutNodeState = *NodeState;
+	return true;
+}
+
+void UOpenLogicRuntimeGraphComponent::HandleReplicatedNodeState(const FOpenLogicReplicatedNodeState& NodeState)
+{
+	if (OnReplicatedNodeStateChanged.IsBound())
+	{
+		OnReplicatedNodeStateChanged.Broadcast(NodeState.NodeID, NodeState.TaskState);
+	}
+}
+
+void UOpenLogicRuntimeGraphComponent::CaptureNodeState(UOpenLogicTask* Task, EOpenLogicTaskState TaskState)
+{
+	const TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = Task ? Task->GetBoundRuntimeNode() : nullptr;
+	const FOpenLogicNode* NodeData = RuntimeNode.IsValid() && RuntimeGraph ? RuntimeGraph->FindNodeData(RuntimeNode->NodeID) : nullptr;
+	if (!NodeData)
+	{
+		return;
+	}
+
+	TArray<FOpenLogicReplicatedPinValue> PinValues;
+	PinValues.Reserve(RuntimeNode->OutputProperties.Num());
+
+	for (const TPair<int32, TSharedPtr<void>>& OutputProperty : RuntimeNode->OutputProperties)
+	{
+		const UClass* PropertyClass = NodeData->GetOutputPinData(OutputProperty.Key).PropertyClass;
+		PinValues.Add(FOpenLogicReplicatedPinValue::FromValue(OutputProperty.Key, PropertyClass ? PropertyClass->GetDefaultObject<UOpenLogicProperty>() : nullptr, OutputProperty.Value.Get()));
+	}
+
+	// Keep a stable order so unchanged values compare equal
+	PinValues.Sort([](const FOpenLogicReplicatedPinValue& A, const FOpenLogicReplicatedPinValue& B)
+	{
+		return A.PinIndex < B.PinIndex;
+	});
+
+	FScopeLock Lock(&PendingNodeStatesLock);
+	PendingNodeStates.Add(RuntimeNode->NodeID, TPair<EOpenLogicTaskState, TArray<FOpenLogicReplicatedPinValue>>(TaskState, MoveTemp(PinValues)));
 }
 
+void UOpenLogicRuntimeGraphComponent::FlushReplicatedState()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&PendingNodeStatesLock);
+		if (PendingNodeStates.IsEmpty())
+		{
+			return;
+		}
+	}
+
+	const float Interval = GetRelevantReplicationInterval();
+	if (Interval < 0.0f || World->GetTimeSeconds() - LastReplicationTime < Interval)
+	{
+		return;
+	}
+
+	TMap<FGuid, TPair<EOpenLogicTaskState, TArray<FOpenLogicReplicatedPinValue>>> NodeStates;
+	{
+		FScopeLock Lock(&PendingNodeStatesLock);
+		NodeStates = MoveTemp(PendingNodeStates);
+		PendingNodeStates.Reset();
+	}
+
+	LastReplicationTime = World->GetTimeSeconds();
+
+	bool bChanged = false;
+	for (TPair<FGuid, TPair<EOpenLogicTaskState, TArray<FOpenLogicReplicatedPinValue>>>& NodeState : NodeStates)
+	{
+		bChanged |= ReplicatedState.SetNodeState(NodeState.Key, NodeState.Value.Key, MoveTemp(NodeState.Value.Value));
+	}
+
+	if (bChanged && GetOwner())
+	{
+		GetOwner()->ForceNetUpdate();
+	}
+}
+
+float UOpenLogicRuntimeGraphComponent::GetRelevantReplicationInterval() const
+{
+	const AActor* Owner = GetOwner();
+	const UWorld* World = GetWorld();
+	if (!Owner || !World)
+	{
+		return -1.0f;
+	}
+
+	if (Owner->bAlwaysRelevant || Owner->bOnlyRelevantToOwner)
+	{
+		return ReplicationInterval;
+	}
+
+	const FVector Location = Owner->GetActorLocation();
+	double ClosestDistanceSquared = TNumericLimits<double>::Max();
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, FVector::DistSquared(Location, ViewLocation));
+	}
+
+	if (ClosestDistanceSquared > FMath::Square(ReplicationCullDistance))
+	{
+		return -1.0f;
+	}
+
+	return ClosestDistanceSquared > FMath::Square(FullRateDistance) ? DistantReplicationInterval : ReplicationInterval;
+}
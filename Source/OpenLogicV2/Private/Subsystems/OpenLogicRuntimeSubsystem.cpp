@@ -1,12 +1,123 @@
 // Copyright 2024 - NegativeNameSeller
 
 #include "Subsystems/OpenLogicRuntimeSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "OpenLogicV2.h"
+
+static TAutoConsoleVariable<int32> CVarEventBusMaxRecipientsPerFrame(
+	TEXT("OpenLogic.EventBus.MaxRecipientsPerFrame"),
+	64,
+	TEXT("Number of graphs a broadcast spread across frames is dispatched to each frame."));
+
+static TAutoConsoleVariable<float> CVarEventBusPriorityAgingSeconds(
+	TEXT("OpenLogic.EventBus.PriorityAgingSeconds"),
+	0.5f,
+	TEXT("Seconds a broadcast spread across frames waits to gain one priority level. 0 disables aging."));
+
+void UOpenLogicRuntimeSubsystem::Deinitialize()
+{
+	PendingBroadcasts.Empty();
+	BatchedGraphs.Empty();
+	ChannelSubscribers.Empty();
+	EventDispatchIndex.Empty();
+
+	Super::Deinitialize();
+}
+
+void UOpenLogicRuntimeSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingBroadcasts.IsEmpty())
+	{
+		return;
+	}
+
+	int32 Budget = FMath::Max(1, CVarEventBusMaxRecipientsPerFrame.GetValueOnGameThread());
+
+	while (Budget > 0 && !PendingBroadcasts.IsEmpty())
+	{
+		const int32 BroadcastIndex = SelectNextPendingBroadcast();
+		FOpenLogicPendingBroadcast& Broadcast = PendingBroadcasts[BroadcastIndex];
+
+		if (Broadcast.NextRecipient == 0)
+		{
+			const double WaitSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Broadcast.EnqueueCycles);
+			BroadcastQueueCounters[static_cast<int32>(Broadcast.Priority)].RecordDequeue(static_cast<uint64>(WaitSeconds * 1000000.0));
+		}
+
+		const int32 RecipientCount = FMath::Min(Budget, Broadcast.Recipients.Num() - Broadcast.NextRecipient);
+		if (UClass* EventClass = Broadcast.EventClass.Get())
+		{
+			const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>> Recipients(Broadcast.Recipients.GetData() + Broadcast.NextRecipient, RecipientCount);
+			Broadcast.NextRecipient += RecipientCount;
+			DispatchBroadcast(EventClass, Broadcast.bAutoProcess, Broadcast.Priority, Recipients);
+		} else
+		{
+			Broadcast.NextRecipient = Broadcast.Recipients.Num();
+		}
+
+		Budget -= RecipientCount;
+
+		// The dispatch may have queued other broadcasts, so look the broadcast up again. New ones are appended, the index
+		// is still valid.
+		if (PendingBroadcasts[BroadcastIndex].NextRecipient >= PendingBroadcasts[BroadcastIndex].Recipients.Num())
+		{
+			PendingBroadcasts.RemoveAt(BroadcastIndex);
+		}
+	}
+}
+
+int32 UOpenLogicRuntimeSubsystem::SelectNextPendingBroadcast() const
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const double AgingSeconds = CVarEventBusPriorityAgingSeconds.GetValueOnGameThread();
+
+	int32 SelectedIndex = 0;
+	double SelectedPriority = 0.0;
+
+	// A broadcast already being dispatched keeps going unless a higher one arrives, ties go to the oldest
+	for (int32 BroadcastIndex = 0; BroadcastIndex < PendingBroadcasts.Num(); BroadcastIndex++)
+	{
+		const FOpenLogicPendingBroadcast& Broadcast = PendingBroadcasts[BroadcastIndex];
+		const double WaitSeconds = FPlatformTime::ToSeconds64(NowCycles - Broadcast.EnqueueCycles);
+		const double AgedPriority = static_cast<int32>(Broadcast.Priority) + (AgingSeconds > 0.0 ? WaitSeconds / AgingSeconds : 0.0);
+
+		if (BroadcastIndex == 0 || AgedPriority > SelectedPriority)
+		{
+			SelectedIndex = BroadcastIndex;
+			SelectedPriority = AgedPriority;
+		}
+	}
+
+	return SelectedIndex;
+}
+
+TArray<FOpenLogicPriorityQueueMetrics> UOpenLogicRuntimeSubsystem::GetBroadcastQueueMetrics() const
+{
+	TArray<FOpenLogicPriorityQueueMetrics> Metrics;
+	Metrics.Reserve(OpenLogicExecutionPriorityCount);
+
+	for (int32 PriorityIndex = 0; PriorityIndex < OpenLogicExecutionPriorityCount; PriorityIndex++)
+	{
+		Metrics.Add(BroadcastQueueCounters[PriorityIndex].GetMetrics(static_cast<EOpenLogicExecutionPriority>(PriorityIndex)));
+	}
+
+	return Metrics;
+}
+
+TStatId UOpenLogicRuntimeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UOpenLogicRuntimeSubsystem, STATGROUP_Tickables);
+}
 
 /* Creates and initializes a graph runtime worker */
 UOpenLogicRuntimeGraph* UOpenLogicRuntimeSubsystem::CreateRuntimeGraph(FOpenLogicGraphData GraphData, UObject* Outer)
 {
 	UOpenLogicRuntimeGraph* NewRuntimeWorker = NewObject<UOpenLogicRuntimeGraph>(Outer, UOpenLogicRuntimeGraph::StaticClass());
 	NewRuntimeWorker->SetGraphData(GraphData);
+	RegisterRuntimeGraph(NewRuntimeWorker);
 
 	ActiveRuntimeWorkers.Add(NewRuntimeWorker);
 	return NewRuntimeWorker;
@@ -19,4 +130,269 @@ FOpenLogicGraphData UOpenLogicRuntimeSubsystem::GetGraphData(UOpenLogicGraph* Gr
 		return Graph->GraphData;
 	}
 	return FOpenLogicGraphData();
-}
\ No newline at end of file
+}
+
+void UOpenLogicRuntimeSubsystem::RegisterRuntimeGraph(UOpenLogicRuntimeGraph* RuntimeGraph)
+{
+	if (!IsValid(RuntimeGraph))
+	{
+		return;
+	}
+
+	// Drop the previous entries, the graph data may have changed since
+	RemoveFromDispatchIndex(RuntimeGraph);
+
+	for (const TPair<TObjectKey<UClass>, TArray<FGuid>>& EventPair : RuntimeGraph->GetEventDispatchIndex())
+	{
+		EventDispatchIndex.FindOrAdd(EventPair.Key).Add(RuntimeGraph);
+	}
+
+	RuntimeGraph->SetDispatchSubsystem(this);
+}
+
+void UOpenLogicRuntimeSubsystem::UnregisterRuntimeGraph(UOpenLogicRuntimeGraph* RuntimeGraph)
+{
+	RemoveFromDispatchIndex(RuntimeGraph);
+
+	for (auto It = ChannelSubscribers.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAllSwap([RuntimeGraph](const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Graph)
+		{
+			return !Graph.IsValid() || Graph.Get() == RuntimeGraph;
+		});
+
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UOpenLogicRuntimeSubsystem::RemoveFromDispatchIndex(const UOpenLogicRuntimeGraph* RuntimeGraph)
+{
+	for (auto It = EventDispatchIndex.CreateIterator(); It; ++It)
+	{
+		// Also clean up the graphs that were destroyed without unregistering
+		It.Value().RemoveAllSwap([RuntimeGraph](const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Graph)
+		{
+			return !Graph.IsValid() || Graph.Get() == RuntimeGraph;
+		});
+
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UOpenLogicRuntimeSubsystem::SubscribeToChannel(UOpenLogicRuntimeGraph* RuntimeGraph, FName Channel)
+{
+	if (!IsValid(RuntimeGraph) || Channel.IsNone())
+	{
+		return;
+	}
+
+	// A graph has to be in the dispatch index to receive broadcasts
+	if (!RuntimeGraph->GetDispatchSubsystem())
+	{
+		RegisterRuntimeGraph(RuntimeGraph);
+	}
+
+	ChannelSubscribers.FindOrAdd(Channel).AddUnique(RuntimeGraph);
+}
+
+void UOpenLogicRuntimeSubsystem::UnsubscribeFromChannel(UOpenLogicRuntimeGraph* RuntimeGraph, FName Channel)
+{
+	TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>* Subscribers = ChannelSubscribers.Find(Channel);
+	if (!Subscribers)
+	{
+		return;
+	}
+
+	Subscribers->RemoveSwap(RuntimeGraph);
+	if (Subscribers->IsEmpty())
+	{
+		ChannelSubscribers.Remove(Channel);
+	}
+}
+
+int32 UOpenLogicRuntimeSubsystem::BroadcastEvent(TSubclassOf<UOpenLogicTask> EventClass, FName Channel, bool AutoProcess, bool bSpreadAcrossFrames, EOpenLogicExecutionPriority Priority)
+{
+	const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>* Implementers = EventDispatchIndex.Find(EventClass.Get());
+	if (!Implementers)
+	{
+		return 0;
+	}
+
+	TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>> Recipients;
+	if (Channel.IsNone())
+	{
+		Recipients = *Implementers;
+	} else if (const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>* Subscribers = ChannelSubscribers.Find(Channel))
+	{
+		Recipients.Reserve(Subscribers->Num());
+		for (const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Subscriber : *Subscribers)
+		{
+			const UOpenLogicRuntimeGraph* RuntimeGraph = Subscriber.Get();
+			if (RuntimeGraph && RuntimeGraph->FindEventImplementations(EventClass))
+			{
+				Recipients.Add(Subscriber);
+			}
+		}
+	}
+
+	if (Recipients.IsEmpty())
+	{
+		return 0;
+	}
+
+	const int32 Budget = FMath::Max(1, CVarEventBusMaxRecipientsPerFrame.GetValueOnGameThread());
+	if (!bSpreadAcrossFrames || Recipients.Num() <= Budget)
+	{
+		DispatchBroadcast(EventClass, AutoProcess, Priority, Recipients);
+		return Recipients.Num();
+	}
+
+	FOpenLogicPendingBroadcast& Broadcast = PendingBroadcasts.AddDefaulted_GetRef();
+	Broadcast.EventClass = EventClass.Get();
+	Broadcast.bAutoProcess = AutoProcess;
+	Broadcast.Priority = Priority;
+	Broadcast.Recipients = MoveTemp(Recipients);
+	Broadcast.EnqueueCycles = FPlatformTime::Cycles64();
+
+	BroadcastQueueCounters[static_cast<int32>(Priority)].RecordEnqueue();
+
+	return Broadcast.Recipients.Num();
+}
+
+int32 UOpenLogicRuntimeSubsystem::DispatchBroadcast(UClass* EventClass, bool bAutoProcess, EOpenLogicExecutionPriority Priority, TArrayView<const TWeakObjectPtr<UOpenLogicRuntimeGraph>> Recipients)
+{
+	TArray<TPair<UOpenLogicRuntimeGraph*, int32>> HandleRanges;
+	HandleRanges.Reserve(Recipients.Num());
+
+	TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>> ExecutionHandles;
+	ExecutionHandles.Reserve(Recipients.Num());
+
+	// Create every handle first so the recipients all start from the same state
+	for (const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Recipient : Recipients)
+	{
+		if (UOpenLogicRuntimeGraph* RuntimeGraph = Recipient.Get())
+		{
+			HandleRanges.Emplace(RuntimeGraph, RuntimeGraph->CreateEventExecutionHandles(EventClass, ExecutionHandles, Priority));
+		}
+	}
+
+	if (bAutoProcess)
+	{
+		int32 FirstHandle = 0;
+		for (const TPair<UOpenLogicRuntimeGraph*, int32>& HandleRange : HandleRanges)
+		{
+			HandleRange.Key->ProcessExecutionHandles(TArrayView<TSharedPtr<FOpenLogicGraphExecutionHandle>>(ExecutionHandles.GetData() + FirstHandle, HandleRange.Value));
+			FirstHandle += HandleRange.Value;
+		}
+	}
+
+	return ExecutionHandles.Num();
+}
+
+TArray<FOpenLogicGraphExecutionHandle> UOpenLogicRuntimeSubsystem::TriggerEvent(TSubclassOf<UOpenLogicTask> EventClass, bool AutoProcess, EOpenLogicExecutionPriority Priority)
+{
+	TArray<FOpenLogicGraphExecutionHandle> ExecutionHandles;
+
+	const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>* Graphs = EventDispatchIndex.Find(EventClass.Get());
+	if (!Graphs)
+	{
+		return ExecutionHandles;
+	}
+
+	// Triggered events may register or unregister graphs
+	const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>> GraphsToTrigger = *Graphs;
+	for (const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Graph : GraphsToTrigger)
+	{
+		if (UOpenLogicRuntimeGraph* RuntimeGraph = Graph.Get())
+		{
+			ExecutionHandles.Append(RuntimeGraph->TriggerAllEvents(EventClass, AutoProcess, Priority));
+		}
+	}
+
+	return ExecutionHandles;
+}
+
+bool UOpenLogicRuntimeSubsystem::HasEventImplementations(TSubclassOf<UOpenLogicTask> EventClass) const
+{
+	return EventDispatchIndex.Contains(EventClass.Get());
+}
+
+TArray<UOpenLogicRuntimeGraph*> UOpenLogicRuntimeSubsystem::GetGraphsImplementingEvent(TSubclassOf<UOpenLogicTask> EventClass) const
+{
+	TArray<UOpenLogicRuntimeGraph*> Graphs;
+
+	if (const TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>* RegisteredGraphs = EventDispatchIndex.Find(EventClass.Get()))
+	{
+		for (const TWeakObjectPtr<UOpenLogicRuntimeGraph>& Graph : *RegisteredGraphs)
+		{
+			if (UOpenLogicRuntimeGraph* RuntimeGraph = Graph.Get())
+			{
+				Graphs.Add(RuntimeGraph);
+			}
+		}
+	}
+
+	return Graphs;
+}
+
+UOpenLogicBatchedGraph* UOpenLogicRuntimeSubsystem::GetOrCreateBatchedGraph(UOpenLogicGraph* GraphAsset)
+{
+	if (!IsValid(GraphAsset))
+	{
+		return nullptr;
+	}
+
+	if (UOpenLogicBatchedGraph* const* ExistingGraph = BatchedGraphs.Find(GraphAsset))
+	{
+		return *ExistingGraph;
+	}
+
+	UOpenLogicBatchedGraph* BatchedGraph = NewObject<UOpenLogicBatchedGraph>(this);
+	if (!BatchedGraph->SetGraphData(GraphAsset->GraphData))
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[GetOrCreateBatchedGraph] %s cannot run batched, some of its tasks do not support batched execution."), *GraphAsset->GetName());
+	}
+
+	BatchedGraphs.Add(GraphAsset, BatchedGraph);
+	return BatchedGraph;
+}
+
+int32 UOpenLogicRuntimeSubsystem::PatchRuntimeGraphs(UOpenLogicGraph* GraphAsset)
+{
+	if (!IsValid(GraphAsset))
+	{
+		return 0;
+	}
+
+	int32 PatchedGraphs = 0;
+	const UWorld* World = GetWorld();
+
+	for (TObjectIterator<UOpenLogicRuntimeGraph> It; It; ++It)
+	{
+		UOpenLogicRuntimeGraph* RuntimeGraph = *It;
+		if (IsValid(RuntimeGraph) && RuntimeGraph->GetSourceGraph() == GraphAsset && RuntimeGraph->GetWorld() == World)
+		{
+			RuntimeGraph->ApplyGraphDataPatch(GraphAsset->GraphData);
+			PatchedGraphs++;
+		}
+	}
+
+	// Batched graphs keep their instances but not their values
+	if (UOpenLogicBatchedGraph* const* BatchedGraph = BatchedGraphs.Find(GraphAsset))
+	{
+		(*BatchedGraph)->SetGraphData(GraphAsset->GraphData);
+	}
+
+	if (PatchedGraphs > 0)
+	{
+		UE_LOG(OpenLogicLog, Log, TEXT("Patched %d runtime graphs running %s."), PatchedGraphs, *GraphAsset->GetName());
+	}
+
+	return PatchedGraphs;
+}
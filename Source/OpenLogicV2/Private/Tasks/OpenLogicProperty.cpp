@@ -1,6 +1,7 @@
 // Copyright 2024 - NegativeNameSeller
 
 #include "Tasks/OpenLogicProperty.h"
+#include "OpenLogicV2.h"
 
 bool UOpenLogicProperty::IsCompatibleWith_Implementation(UOpenLogicProperty* OtherProperty)
 {
@@ -70,3 +71,388 @@ bool UOpenLogicProperty::ValidatePropertyType(FProperty* Property) const
 		return false;
 	}
 }
+
+const FProperty* UOpenLogicProperty::GetValueProperty() const
+{
+	const UOpenLogicProperty* DefaultObject = GetClass()->GetDefaultObject<UOpenLogicProperty>();
+	if (!DefaultObject->bValuePropertyCached)
+	{
+		DefaultObject->CachedValueProperty = FindFProperty<FProperty>(GetClass(), TEXT("Value"));
+		DefaultObject->bValuePropertyCached = true;
+	}
+
+	return DefaultObject->CachedValueProperty;
+}
+
+TSharedPtr<void> UOpenLogicProperty::AllocateValue() const
+{
+	if (bResolvesTypeDynamically)
+	{
+		return nullptr;
+	}
+
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return MakeShared<bool>(false);
+	case EOpenLogicUnderlyingType::Byte:
+		return MakeShared<uint8>(0);
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return MakeShared<int32>(0);
+	case EOpenLogicUnderlyingType::Float:
+		return MakeShared<float>(0.0f);
+	case EOpenLogicUnderlyingType::Double:
+		return MakeShared<double>(0.0);
+	case EOpenLogicUnderlyingType::String:
+		return MakeShared<FString>();
+	case EOpenLogicUnderlyingType::Name:
+		return MakeShared<FName>();
+	case EOpenLogicUnderlyingType::Text:
+		return MakeShared<FText>();
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		return MakeShared<UObject*>(nullptr);
+	case EOpenLogicUnderlyingType::Struct:
+		{
+			const UScriptStruct* Struct = StructType;
+			if (!Struct)
+			{
+				return nullptr;
+			}
+
+			void* Storage = FMemory::Malloc(Struct->GetStructureSize(), Struct->GetMinAlignment());
+			Struct->InitializeStruct(Storage);
+
+			return TSharedPtr<void>(Storage, [Struct](void* Ptr)
+			{
+				Struct->DestroyStruct(Ptr);
+				FMemory::Free(Ptr);
+			});
+		}
+	default:
+		break;
+	}
+
+	// Blueprint property classes describe their type with a Value property
+	const FProperty* ValueProperty = GetValueProperty();
+	if (!ValueProperty)
+	{
+		return nullptr;
+	}
+
+	void* Storage = FMemory::Malloc(ValueProperty->GetSize(), ValueProperty->GetMinAlignment());
+	ValueProperty->InitializeValue(Storage);
+
+	return TSharedPtr<void>(Storage, [ValueProperty](void* Ptr)
+	{
+		ValueProperty->DestroyValue(Ptr);
+		FMemory::Free(Ptr);
+	});
+}
+
+template <typename T>
+static bool CopyTypedValue(void* Dest, const void* Source)
+{
+	*static_cast<T*>(Dest) = *static_cast<const T*>(Source);
+	return true;
+}
+
+bool UOpenLogicProperty::CopyValue(void* Dest, const void* Source) const
+{
+	if (!Dest || !Source || bResolvesTypeDynamically)
+	{
+		return false;
+	}
+
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return CopyTypedValue<bool>(Dest, Source);
+	case EOpenLogicUnderlyingType::Byte:
+		return CopyTypedValue<uint8>(Dest, Source);
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return CopyTypedValue<int32>(Dest, Source);
+	case EOpenLogicUnderlyingType::Float:
+		return CopyTypedValue<float>(Dest, Source);
+	case EOpenLogicUnderlyingType::Double:
+		return CopyTypedValue<double>(Dest, Source);
+	case EOpenLogicUnderlyingType::String:
+		return CopyTypedValue<FString>(Dest, Source);
+	case EOpenLogicUnderlyingType::Name:
+		return CopyTypedValue<FName>(Dest, Source);
+	case EOpenLogicUnderlyingType::Text:
+		return CopyTypedValue<FText>(Dest, Source);
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		return CopyTypedValue<UObject*>(Dest, Source);
+	case EOpenLogicUnderlyingType::Struct:
+		if (!StructType)
+		{
+			return false;
+		}
+
+		StructType->CopyScriptStruct(Dest, Source);
+		return true;
+	default:
+		break;
+	}
+
+	const FProperty* ValueProperty = GetValueProperty();
+	if (!ValueProperty)
+	{
+		return false;
+	}
+
+	ValueProperty->CopyCompleteValue(Dest, Source);
+	return true;
+}
+
+TSharedPtr<void> UOpenLogicProperty::CloneValue(const void* Source) const
+{
+	TSharedPtr<void> Value = AllocateValue();
+	if (!Value.IsValid() || !CopyValue(Value.Get(), Source))
+	{
+		return nullptr;
+	}
+
+	return Value;
+}
+
+int32 UOpenLogicProperty::GetValueSize() const
+{
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return sizeof(bool);
+	case EOpenLogicUnderlyingType::Byte:
+		return sizeof(uint8);
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return sizeof(int32);
+	case EOpenLogicUnderlyingType::Float:
+		return sizeof(float);
+	case EOpenLogicUnderlyingType::Double:
+		return sizeof(double);
+	case EOpenLogicUnderlyingType::String:
+		return sizeof(FString);
+	case EOpenLogicUnderlyingType::Name:
+		return sizeof(FName);
+	case EOpenLogicUnderlyingType::Text:
+		return sizeof(FText);
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		return sizeof(UObject*);
+	case EOpenLogicUnderlyingType::Struct:
+		return StructType ? StructType->GetStructureSize() : 0;
+	default:
+		{
+			const FProperty* ValueProperty = GetValueProperty();
+			return ValueProperty ? ValueProperty->GetSize() : 0;
+		}
+	}
+}
+
+bool UOpenLogicProperty::CanCopyValueFrom(const FProperty* Property) const
+{
+	if (!Property || Property->ArrayDim != 1 || bResolvesTypeDynamically)
+	{
+		return false;
+	}
+
+	if (UnderlyingType == EOpenLogicUnderlyingType::Wildcard)
+	{
+		const FProperty* ValueProperty = GetValueProperty();
+		return ValueProperty && ValueProperty->SameType(Property);
+	}
+
+	if (UnderlyingType == EOpenLogicUnderlyingType::Struct)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return StructProperty && StructType && StructProperty->Struct == StructType;
+	}
+
+	// Bitfield bools are copied through their mask, which does not fit a plain bool
+	const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+	if (BoolProperty && !BoolProperty->IsNativeBool())
+	{
+		return false;
+	}
+
+	return ValidatePropertyType(const_cast<FProperty*>(Property)) && Property->GetSize() == GetValueSize();
+}
+
+int64 UOpenLogicProperty::GetValueAllocatedSize(const void* Value) const
+{
+	// Values are held by TSharedPtr<void>, which adds a reference controller per value
+	constexpr int64 SharedControllerSize = 2 * sizeof(void*) + 2 * sizeof(int32);
+
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return SharedControllerSize + sizeof(bool);
+	case EOpenLogicUnderlyingType::Byte:
+		return SharedControllerSize + sizeof(uint8);
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return SharedControllerSize + sizeof(int32);
+	case EOpenLogicUnderlyingType::Float:
+		return SharedControllerSize + sizeof(float);
+	case EOpenLogicUnderlyingType::Double:
+		return SharedControllerSize + sizeof(double);
+	case EOpenLogicUnderlyingType::String:
+		return SharedControllerSize + sizeof(FString) + (Value ? static_cast<const FString*>(Value)->GetAllocatedSize() : 0);
+	case EOpenLogicUnderlyingType::Name:
+		return SharedControllerSize + sizeof(FName);
+	case EOpenLogicUnderlyingType::Text:
+		// FText data is shared and reference counted, only count the handle
+		return SharedControllerSize + sizeof(FText);
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		return SharedControllerSize + sizeof(UObject*);
+	case EOpenLogicUnderlyingType::Struct:
+		return SharedControllerSize + (StructType ? StructType->GetStructureSize() : 0);
+	default:
+		return SharedControllerSize;
+	}
+}
+
+FString UOpenLogicProperty::ExportValueToString(const void* Value) const
+{
+	if (!Value)
+	{
+		return TEXT("None");
+	}
+
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return *static_cast<const bool*>(Value) ? TEXT("true") : TEXT("false");
+	case EOpenLogicUnderlyingType::Byte:
+		return FString::FromInt(*static_cast<const uint8*>(Value));
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return FString::FromInt(*static_cast<const int32*>(Value));
+	case EOpenLogicUnderlyingType::Float:
+		return FString::SanitizeFloat(*static_cast<const float*>(Value));
+	case EOpenLogicUnderlyingType::Double:
+		return FString::SanitizeFloat(*static_cast<const double*>(Value));
+	case EOpenLogicUnderlyingType::String:
+		return *static_cast<const FString*>(Value);
+	case EOpenLogicUnderlyingType::Name:
+		return static_cast<const FName*>(Value)->ToString();
+	case EOpenLogicUnderlyingType::Text:
+		return static_cast<const FText*>(Value)->ToString();
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		return GetPathNameSafe(*static_cast<UObject* const*>(Value));
+	case EOpenLogicUnderlyingType::Struct:
+		{
+			FString Result;
+			if (StructType)
+			{
+				StructType->ExportText(Result, Value, nullptr, nullptr, PPF_None, nullptr);
+			}
+			return Result;
+		}
+	default:
+		return TEXT("?");
+	}
+}
+
+template <typename T>
+static bool SerializeTypedValue(FArchive& Ar, TSharedPtr<void>& Value)
+{
+	if (Ar.IsLoading())
+	{
+		Value = MakeShared<T>();
+	}
+
+	if (!Value.IsValid())
+	{
+		return false;
+	}
+
+	Ar << *static_cast<T*>(Value.Get());
+	return !Ar.IsError();
+}
+
+bool UOpenLogicProperty::SerializeValue(FArchive& Ar, TSharedPtr<void>& Value) const
+{
+	switch (UnderlyingType)
+	{
+	case EOpenLogicUnderlyingType::Boolean:
+		return SerializeTypedValue<bool>(Ar, Value);
+	case EOpenLogicUnderlyingType::Byte:
+		return SerializeTypedValue<uint8>(Ar, Value);
+	case EOpenLogicUnderlyingType::Int:
+	case EOpenLogicUnderlyingType::Enum:
+		return SerializeTypedValue<int32>(Ar, Value);
+	case EOpenLogicUnderlyingType::Float:
+		return SerializeTypedValue<float>(Ar, Value);
+	case EOpenLogicUnderlyingType::Double:
+		return SerializeTypedValue<double>(Ar, Value);
+	case EOpenLogicUnderlyingType::String:
+		return SerializeTypedValue<FString>(Ar, Value);
+	case EOpenLogicUnderlyingType::Name:
+		return SerializeTypedValue<FName>(Ar, Value);
+	case EOpenLogicUnderlyingType::Text:
+		return SerializeTypedValue<FText>(Ar, Value);
+	case EOpenLogicUnderlyingType::Object:
+	case EOpenLogicUnderlyingType::Class:
+		{
+			if (Ar.IsLoading())
+			{
+				Value = MakeShared<UObject*>(nullptr);
+			}
+
+			if (!Value.IsValid())
+			{
+				return false;
+			}
+
+			// Objects are stored by path so the value survives outside of the process that recorded it
+			FSoftObjectPath ObjectPath(*static_cast<UObject**>(Value.Get()));
+			Ar << ObjectPath;
+
+			if (Ar.IsLoading())
+			{
+				*static_cast<UObject**>(Value.Get()) = ObjectPath.TryLoad();
+			}
+			return !Ar.IsError();
+		}
+	case EOpenLogicUnderlyingType::Struct:
+		{
+			UScriptStruct* Struct = StructType;
+			if (!Struct)
+			{
+				UE_LOG(OpenLogicLog, Error, TEXT("[SerializeValue] StructType is not set for property %s."), *GetName());
+				return false;
+			}
+
+			if (Ar.IsLoading())
+			{
+				void* StructMemory = FMemory::Malloc(Struct->GetStructureSize(), Struct->GetMinAlignment());
+				Struct->InitializeStruct(StructMemory);
+
+				Value = TSharedPtr<void>(StructMemory, [Struct](void* Ptr)
+				{
+					Struct->DestroyStruct(Ptr);
+					FMemory::Free(Ptr);
+				});
+			}
+
+			if (!Value.IsValid())
+			{
+				return false;
+			}
+
+			Struct->SerializeItem(Ar, Value.Get(), nullptr);
+			return !Ar.IsError();
+		}
+	default:
+		UE_LOG(OpenLogicLog, Warning, TEXT("[SerializeValue] Wildcard values cannot be serialized."));
+		return false;
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Tasks/OpenLogicStructTask.h"
+#include "Runtime/OpenLogicRuntimeGraph.h"
+#include "OpenLogicV2.h"
+
+FOpenLogicStructTaskContext::FOpenLogicStructTaskContext(UOpenLogicRuntimeGraph& InGraph, FOpenLogicRuntimeNode& InRuntimeNode, const FOpenLogicNode& InNodeData, FName InPinName)
+	: Graph(InGraph)
+	, RuntimeNode(InRuntimeNode)
+	, NodeData(InNodeData)
+	, PinName(InPinName)
+{
+}
+
+UObject* FOpenLogicStructTaskContext::GetContextObject() const
+{
+	return Graph.GetContext();
+}
+
+TSharedPtr<void> FOpenLogicStructTaskContext::GetInputValue(int32 PinIndex) const
+{
+	return RuntimeNode.InputProperties.FindRef(PinIndex);
+}
+
+void FOpenLogicStructTaskContext::SetOutputValue(int32 PinIndex, const TSharedPtr<void>& Value) const
+{
+	if (!Value.IsValid() || RuntimeNode.TaskState != EOpenLogicTaskState::Running)
+	{
+		return;
+	}
+
+	if (!NodeData.OutputPins.Contains(PinIndex))
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[SetOutputValue] Output pin %d not found."), PinIndex);
+		return;
+	}
+
+	Graph.CommitOutputValue(nullptr, RuntimeNode, NodeData, PinIndex, Value);
+}
+
+bool FOpenLogicStructTaskContext::WriteOutput(int32 PinIndex, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const
+{
+	if (RuntimeNode.TaskState != EOpenLogicTaskState::Running)
+	{
+		return false;
+	}
+
+	return Graph.WriteNodeOutputSlot(nullptr, RuntimeNode, NodeData, PinIndex, Writer);
+}
+
+bool FOpenLogicStructTaskContext::ExecutePin(int32 PinIndex) const
+{
+	if (RuntimeNode.TaskState != EOpenLogicTaskState::Running)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = Graph.GetExecutionHandle(RuntimeNode.ExecutionHandleIndex);
+	if (!ExecutionHandle.IsValid())
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[ExecutePin] ExecutionHandle not found for node %s."), *RuntimeNode.NodeID.ToString());
+		return false;
+	}
+
+	return Graph.ExecuteOutputPin(ExecutionHandle, RuntimeNode.NodeID, PinIndex);
+}
+
+void FOpenLogicStructTaskContext::Complete(int32 PinIndex) const
+{
+	if (PinIndex != INDEX_NONE)
+	{
+		ExecutePin(PinIndex);
+	}
+
+	Graph.CompleteStructNode(RuntimeNode);
+}
+
+UOpenLogicStructTask::UOpenLogicStructTask(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
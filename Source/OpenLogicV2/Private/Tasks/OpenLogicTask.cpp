@@ -1,11 +1,13 @@
 // Copyright 2024 - NegativeNameSeller
 
 #include "Tasks/OpenLogicTask.h"
+#include "Tasks/OpenLogicTypedPin.h"
 #include "Widgets/NodeBase.h"
 #include "Runtime/OpenLogicRuntimeGraph.h"
 #include "OpenLogicV2.h"
 #include "Async/Async.h"
 #include "Engine/NetDriver.h"
+#include "Serialization/StructuredArchive.h"
 
 #if WITH_EDITOR
     #include "Subsystems/AssetEditorSubsystem.h"
@@ -13,6 +15,36 @@
 #endif
 
 
+void UOpenLogicTask::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    BindTypedPins();
+}
+
+void UOpenLogicTask::BindTypedPins()
+{
+    if (TypedPins.Num() == 0)
+    {
+        return;
+    }
+
+    // Typed pins are normally declared in the constructor as well, so this only adds the ones it left out. Instances
+    // of native classes do not copy the pins of the class default object, so each instance declares them itself
+    for (const FOpenLogicTypedPinBase* TypedPin : TypedPins)
+    {
+        TypedPin->Declare(TaskData);
+    }
+
+    const uint32 SchemaHash = TaskData.GetPinSchemaHash();
+
+    for (FOpenLogicTypedPinBase* TypedPin : TypedPins)
+    {
+        TypedPin->Bind(TaskData);
+        TypedPin->Handle.SchemaHash = TypedPin->IsBound() ? SchemaHash : 0;
+    }
+}
+
 UWorld* UOpenLogicTask::GetWorld() const
 {
     if (HasAllFlags(RF_ClassDefaultObject))
@@ -183,13 +215,11 @@ void UOpenLogicTask::CompleteTask(FOpenLogicPinHandle PinName)
         return;
     }
 
-    // Cache the node data and execution handle
-    FOpenLogicNode NodeData = GetRuntimeGraph()->GetNodeData(GetGuid());
-
     // Transition to the next node
     if (PinName.PinName != NAME_None)
     {
-        int32 NextPinIndex = NodeData.GetOutputPinIndexFromName(PinName.PinName);
+        const FOpenLogicNode* NodeData = GetRuntimeGraph()->FindNodeData(GetGuid());
+        const int32 NextPinIndex = NodeData ? GetRuntimeGraph()->ResolvePinIndex(this, *NodeData, PinName, false) : INDEX_NONE;
         if (NextPinIndex == INDEX_NONE)
         {
             return;
@@ -244,7 +274,7 @@ DEFINE_FUNCTION(UOpenLogicTask::execBP_SetPropertyValueByAttribute)
     if (P_THIS->RuntimeGraph)
     {
         void* ValueAddress = Stack.MostRecentPropertyAddress;
-        P_THIS->GetRuntimeGraph()->SetDataPropertyValueByAddress(P_THIS, PinAttribute.PinName, ValueProp, ValueAddress);
+        P_THIS->GetRuntimeGraph()->SetDataPropertyValueByAddress(P_THIS, PinAttribute, ValueProp, ValueAddress);
     }
 
     P_NATIVE_END;
@@ -267,7 +297,7 @@ DEFINE_FUNCTION(UOpenLogicTask::execBP_GetPropertyValueByAttribute)
 
     if (P_THIS->RuntimeGraph)
     {
-        TSharedPtr<void> Value = P_THIS->GetRuntimeGraph()->GetDataPropertyValue(P_THIS, PinAttribute.PinName);
+        TSharedPtr<void> Value = P_THIS->GetRuntimeGraph()->GetDataPropertyValue(P_THIS, PinAttribute);
         if (Value.IsValid())
         {
             void* ValuePtr = Value.Get();
@@ -309,12 +339,12 @@ bool UOpenLogicTask::IsTickableInEditor() const
 
 FOpenLogicPinData UOpenLogicTask::GetInputPinData(int32 PinIndex) const
 {
-    return TaskData.InputPins[PinIndex];
+    return TaskData.InputPins.IsValidIndex(PinIndex) ? TaskData.InputPins[PinIndex] : FOpenLogicPinData();
 }
 
 FOpenLogicPinData UOpenLogicTask::GetOutputPinData(int32 PinIndex) const
 {
-    return TaskData.OutputPins[PinIndex];
+    return TaskData.OutputPins.IsValidIndex(PinIndex) ? TaskData.OutputPins[PinIndex] : FOpenLogicPinData();
 }
 
 TArray<FOpenLogicConnectablePin> UOpenLogicTask::GetConnectablePins(const FOpenLogicPinData& OtherPinInfo, EOpenLogicPinDirection OtherPinDirection) const
@@ -367,7 +397,7 @@ int32 UOpenLogicTask::GetInputPinsCount() const
 {
     if (!RuntimeGraph) return INDEX_NONE;
 
-    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetRuntimeGraph()->FindRuntimeNodeForTask(this);
+    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetBoundRuntimeNode();
     if (!RuntimeNode.IsValid())
     {
         return INDEX_NONE;
@@ -380,7 +410,7 @@ int32 UOpenLogicTask::GetOutputPinsCount() const
 {
     if (!RuntimeGraph) return INDEX_NONE;
     
-    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetRuntimeGraph()->FindRuntimeNodeForTask(this);
+    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetBoundRuntimeNode();
     if (!RuntimeNode.IsValid())
     {
         return INDEX_NONE;
@@ -393,7 +423,7 @@ bool UOpenLogicTask::IsRunning() const
 {
     if (!RuntimeGraph) return false;
 
-    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetRuntimeGraph()->FindRuntimeNodeForTask(this);
+    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = GetBoundRuntimeNode();
     if (!RuntimeNode.IsValid())
     {
         return false;
@@ -424,6 +454,38 @@ void UOpenLogicTask::OnTaskCompleted_Implementation()
 {
 }
 
+void UOpenLogicTask::OnTaskCancelled_Implementation(EOpenLogicCancellationReason Reason)
+{
+}
+
+bool UOpenLogicTask::IsCancellationRequested() const
+{
+    return GetCancellationToken().IsCancellationRequested();
+}
+
+FOpenLogicCancellationToken UOpenLogicTask::GetCancellationToken() const
+{
+    const TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = GetBoundExecutionHandle();
+    return ExecutionHandle.IsValid() ? ExecutionHandle->CancellationToken : FOpenLogicCancellationToken();
+}
+
+void UOpenLogicTask::SerializeTaskState(FArchive& Ar)
+{
+    for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+    {
+        if (!It->HasAnyPropertyFlags(CPF_SaveGame))
+        {
+            continue;
+        }
+
+        for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ArrayIndex++)
+        {
+            FStructuredArchiveFromArchive StructuredArchive(Ar);
+            It->SerializeItem(StructuredArchive.GetSlot(), It->ContainerPtrToValuePtr<void>(this, ArrayIndex));
+        }
+    }
+}
+
 void UOpenLogicTask::OnGraphNodeInitialized_Implementation(UNodeBase* Node)
 {
 }
@@ -463,7 +525,20 @@ void UOpenLogicTask::ExecutePinByName(FName PinName)
 
 void UOpenLogicTask::ExecutePinByAttribute(FOpenLogicPinHandle PinName)
 {
-    ExecutePinByName(PinName.PinName);
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    const FOpenLogicNode* NodeData = GetRuntimeGraph()->FindNodeData(GetGuid());
+    const int32 OutputPinIndex = NodeData ? GetRuntimeGraph()->ResolvePinIndex(this, *NodeData, PinName, false) : INDEX_NONE;
+    if (OutputPinIndex == INDEX_NONE)
+    {
+        UE_LOG(OpenLogicLog, Error, TEXT("[ExecutePinByAttribute] Invalid output pin index."));
+        return;
+    }
+
+    ExecutePin(OutputPinIndex);
 }
 
 /* Retrieves an input parameter based on its class and pin index */
@@ -530,6 +605,58 @@ void UOpenLogicTask::ResetTaskState()
     RuntimeGraph = nullptr;
     ExecutionHandleIndex = INDEX_NONE;
     DynamicProperties.Empty();
+    BoundRuntimeNode.Reset();
+    BoundExecutionHandle.Reset();
+}
+
+void UOpenLogicTask::BindRuntimeNode(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle)
+{
+    BoundRuntimeNode = RuntimeNode;
+    BoundExecutionHandle = ExecutionHandle;
+}
+
+TSharedPtr<FOpenLogicRuntimeNode> UOpenLogicTask::GetBoundRuntimeNode() const
+{
+    TSharedPtr<FOpenLogicRuntimeNode> RuntimeNode = BoundRuntimeNode.Pin();
+
+    // The node may have released this instance (completed, handle destroyed) while it was kept alive elsewhere
+    if (!RuntimeNode.IsValid() || RuntimeNode->TaskInstance != this || RuntimeNode->NodeID != NodeGuid)
+    {
+        return nullptr;
+    }
+
+    return RuntimeNode;
+}
+
+TSharedPtr<FOpenLogicGraphExecutionHandle> UOpenLogicTask::GetBoundExecutionHandle() const
+{
+    if (!GetBoundRuntimeNode().IsValid())
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle = BoundExecutionHandle.Pin();
+    if (!ExecutionHandle.IsValid() || ExecutionHandle->HandleIndex != ExecutionHandleIndex)
+    {
+        return nullptr;
+    }
+
+    return ExecutionHandle;
+}
+
+uint32 UOpenLogicTask::GetPinSchemaHash() const
+{
+#if WITH_EDITOR
+    return GetClass()->GetDefaultObject<UOpenLogicTask>()->TaskData.GetPinSchemaHash();
+#else
+    const UOpenLogicTask* DefaultObject = GetClass()->GetDefaultObject<UOpenLogicTask>();
+    if (DefaultObject->CachedPinSchemaHash == 0)
+    {
+        DefaultObject->CachedPinSchemaHash = DefaultObject->TaskData.GetPinSchemaHash();
+    }
+
+    return DefaultObject->CachedPinSchemaHash;
+#endif
 }
 
 #if WITH_EDITOR
@@ -0,0 +1,45 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Tasks/OpenLogicTypedPin.h"
+#include "OpenLogicV2.h"
+
+FOpenLogicTypedPinBase::FOpenLogicTypedPinBase(UOpenLogicTask* InOwner, FName InPinName, EOpenLogicPinDirection InDirection, UClass* InPropertyClass, const FText& InDescription)
+	: Owner(InOwner), Handle(InPinName), Direction(InDirection), PropertyClass(InPropertyClass), Description(InDescription)
+{
+	check(Owner);
+	Owner->TypedPins.Add(this);
+}
+
+void FOpenLogicTypedPinBase::Declare(FTaskData& TaskData) const
+{
+	TArray<FOpenLogicPinData>& Pins = Direction == EOpenLogicPinDirection::Input ? TaskData.InputPins : TaskData.OutputPins;
+	if (!Pins.ContainsByPredicate([this](const FOpenLogicPinData& PinData) { return PinData.PinName == Handle.PinName; }))
+	{
+		Pins.Add(FOpenLogicPinData(Handle.PinName, Description, EPinRole::DataProperty, PropertyClass));
+	}
+}
+
+void FOpenLogicTypedPinBase::Bind(const FTaskData& TaskData)
+{
+	Handle.PinIndex = INDEX_NONE;
+	Handle.SchemaHash = 0;
+
+	const TArray<FOpenLogicPinData>& Pins = Direction == EOpenLogicPinDirection::Input ? TaskData.InputPins : TaskData.OutputPins;
+	const int32 Index = Pins.IndexOfByPredicate([this](const FOpenLogicPinData& PinData) { return PinData.PinName == Handle.PinName; });
+
+	if (Index == INDEX_NONE)
+	{
+		UE_LOG(OpenLogicLog, Warning, TEXT("[FOpenLogicTypedPinBase::Bind] %s has no pin %s."), *Owner->GetClass()->GetName(), *Handle.PinName.ToString());
+		return;
+	}
+
+	const FOpenLogicPinData& PinData = Pins[Index];
+	if (PinData.Role != EPinRole::DataProperty || !PinData.PropertyClass || !PinData.PropertyClass->IsChildOf(PropertyClass))
+	{
+		UE_LOG(OpenLogicLog, Error, TEXT("[FOpenLogicTypedPinBase::Bind] Pin %s of %s is not a %s pin."), *Handle.PinName.ToString(), *Owner->GetClass()->GetName(), *PropertyClass->GetName());
+		return;
+	}
+
+	// Runtime pin indices start at 1
+	Handle.PinIndex = Index + 1;
+}
@@ -0,0 +1,501 @@
+// Copyright 2025 - NegativeNameSeller
+
+#include "Utility/OpenLogicGraphAnalyzer.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Logging/MessageLog.h"
+
+#define LOCTEXT_NAMESPACE "OpenLogicGraphAnalyzer"
+
+namespace OpenLogicGraphAnalyzer
+{
+	// Guards the data recursion against malformed graphs with data cycles
+	constexpr int32 MaxDataRecursion = 256;
+}
+
+TArray<FOpenLogicLintIssue> FOpenLogicGraphAnalysis::GetIssuesForNode(const FGuid& NodeID) const
+{
+	return Issues.FilterByPredicate([&NodeID](const FOpenLogicLintIssue& Issue) { return Issue.NodeID == NodeID; });
+}
+
+FOpenLogicGraphAnalyzer::FOpenLogicGraphAnalyzer(const FOpenLogicGraphData& InGraphData, const FOpenLogicGraphAnalyzerSettings& InSettings)
+	: GraphData(InGraphData)
+	, Settings(InSettings)
+{
+	for (const TPair<FGuid, FOpenLogicNode>& NodePair : GraphData.Nodes)
+	{
+		const UClass* TaskClass = NodePair.Value.TaskClass.LoadSynchronous();
+		const UOpenLogicTask* Task = TaskClass ? TaskClass->GetDefaultObject<UOpenLogicTask>() : nullptr;
+		if (!Task)
+		{
+			continue;
+		}
+
+		Tasks.Add(NodePair.Key, Task);
+
+		if (Task->TaskData.Type == ENodeType::Event)
+		{
+			EventNodes.Add(NodePair.Key);
+		}
+	}
+}
+
+FOpenLogicGraphAnalysis FOpenLogicGraphAnalyzer::Analyze(const FOpenLogicGraphData& GraphData, const FOpenLogicGraphAnalyzerSettings& Settings)
+{
+	FOpenLogicGraphAnalyzer Analyzer(GraphData, Settings);
+
+	Analyzer.CheckUnreachableNodes();
+	Analyzer.CheckExecutionCycles();
+	Analyzer.CheckLoops();
+	Analyzer.CheckLiterals();
+	Analyzer.CheckDataChains();
+	Analyzer.EstimateEventCosts();
+
+	return MoveTemp(Analyzer.Result);
+}
+
+void FOpenLogicGraphAnalyzer::ReportToMessageLog(const FOpenLogicGraphAnalysis& Analysis, const FOpenLogicGraphData& GraphData, const FString& GraphName)
+{
+	FMessageLog MessageLog("OpenLogic");
+	MessageLog.NewPage(FText::Format(LOCTEXT("PageTitle", "Analysis of {0}"), FText::FromString(GraphName)));
+
+	for (const FOpenLogicLintIssue& Issue : Analysis.Issues)
+	{
+		const EMessageSeverity::Type Severity = Issue.Severity == EOpenLogicLintSeverity::Error ? EMessageSeverity::Error
+			: Issue.Severity == EOpenLogicLintSeverity::Warning ? EMessageSeverity::Warning
+			: EMessageSeverity::Info;
+
+		MessageLog.Message(Severity, FText::Format(LOCTEXT("IssueFormat", "{0}: {1}"), FText::FromString(GraphName), Issue.Message));
+	}
+
+	for (const FOpenLogicEventCost& EventCost : Analysis.EventCosts)
+	{
+		MessageLog.Info(FText::Format(LOCTEXT("EventCostFormat", "{0}: {1} can run up to {2} nodes, estimated cost {3}."),
+			FText::FromString(GraphName), FText::FromString(GetNameSafe(EventCost.EventClass.Get())), EventCost.ReachableNodeCount, FText::AsNumber(EventCost.EstimatedCost)));
+	}
+}
+
+void FOpenLogicGraphAnalyzer::CheckUnreachableNodes()
+{
+	// A graph without events is still being built
+	if (EventNodes.IsEmpty())
+	{
+		return;
+	}
+
+	TSet<FGuid> Reached = CollectExecutionReachable(EventNodes);
+
+	// Data producers read by reached nodes are reached too
+	TArray<FGuid> Pending = Reached.Array();
+	while (Pending.Num() > 0)
+	{
+		for (const FGuid& ProducerID : GetDataProducers(Pending.Pop()))
+		{
+			bool bAlreadyReached = false;
+			Reached.Add(ProducerID, &bAlreadyReached);
+
+			if (!bAlreadyReached)
+			{
+				Pending.Add(ProducerID);
+			}
+		}
+	}
+
+	for (const TPair<FGuid, const UOpenLogicTask*>& TaskPair : Tasks)
+	{
+		if (!Reached.Contains(TaskPair.Key))
+		{
+			AddIssue(EOpenLogicLintRule::UnreachableNode, EOpenLogicLintSeverity::Warning, TaskPair.Key,
+				FText::Format(LOCTEXT("UnreachableNode", "{0} is never executed or read by any event."), FText::FromString(GetNodeName(TaskPair.Key))));
+		}
+	}
+}
+
+void FOpenLogicGraphAnalyzer::CheckExecutionCycles()
+{
+	enum class EVisitState : uint8 { InProgress, Done };
+
+	TMap<FGuid, EVisitState> States;
+	TArray<FGuid> Stack;
+	TSet<FGuid> ReportedCycleHeads;
+
+	TFunction<void(const FGuid&)> Visit = [&](const FGuid& NodeID)
+	{
+		States.Add(NodeID, EVisitState::InProgress);
+		Stack.Push(NodeID);
+
+		for (const FGuid& TargetID : GetExecutionTargets(NodeID))
+		{
+			const EVisitState* TargetState = States.Find(TargetID);
+			if (!TargetState)
+			{
+				Visit(TargetID);
+				continue;
+			}
+
+			if (*TargetState != EVisitState::InProgress || ReportedCycleHeads.Contains(TargetID))
+			{
+				continue;
+			}
+
+			// Back edge: the cycle is the part of the stack starting at the target
+			ReportedCycleHeads.Add(TargetID);
+
+			const int32 CycleStart = Stack.Find(TargetID);
+			TArray<FString> CycleNames;
+			bool bHasLatentNode = false;
+
+			for (int32 Index = CycleStart; Index < Stack.Num(); Index++)
+			{
+				CycleNames.Add(GetNodeName(Stack[Index]));
+
+				const UOpenLogicTask* Task = GetTask(Stack[Index]);
+				bHasLatentNode |= Task && Task->bIsLatent;
+			}
+			CycleNames.Add(GetNodeName(TargetID));
+
+			const FText CycleText = FText::FromString(FString::Join(CycleNames, TEXT(" -> ")));
+
+			if (bHasLatentNode)
+			{
+				AddIssue(EOpenLogicLintRule::ExecutionCycle, EOpenLogicLintSeverity::Warning, TargetID,
+					FText::Format(LOCTEXT("LatentCycle", "Execution cycle {0} has no exit condition other than its latent nodes and may run for the lifetime of the graph."), CycleText));
+			}
+			else
+			{
+				AddIssue(EOpenLogicLintRule::ExecutionCycle, EOpenLogicLintSeverity::Error, TargetID,
+					FText::Format(LOCTEXT("SynchronousCycle", "Execution cycle {0} runs synchronously and recurses until the stack overflows unless a branch exits it."), CycleText));
+			}
+		}
+
+		Stack.Pop();
+		States.Add(NodeID, EVisitState::Done);
+	};
+
+	for (const TPair<FGuid, const UOpenLogicTask*>& TaskPair : Tasks)
+	{
+		if (!States.Contains(TaskPair.Key))
+		{
+			Visit(TaskPair.Key);
+		}
+	}
+}
+
+void FOpenLogicGraphAnalyzer::CheckLoops()
+{
+	TSet<FGuid> ReportedLatentNodes;
+	TSet<FGuid> ReportedProducers;
+
+	for (const TPair<FGuid, const UOpenLogicTask*>& TaskPair : Tasks)
+	{
+		const UOpenLogicTask* LoopTask = TaskPair.Value;
+		if (LoopTask->LoopBodyPin.IsNone())
+		{
+			continue;
+		}
+
+		TSet<FGuid> Body = CollectExecutionReachable(GetExecutionTargets(TaskPair.Key, LoopTask->LoopBodyPin));
+		Body.Remove(TaskPair.Key);
+
+		for (const FGuid& BodyNodeID : Body)
+		{
+			const UOpenLogicTask* BodyTask = GetTask(BodyNodeID);
+			if (BodyTask && BodyTask->bIsLatent && !ReportedLatentNodes.Contains(BodyNodeID))
+			{
+				ReportedLatentNodes.Add(BodyNodeID);
+				AddIssue(EOpenLogicLintRule::LatentInLoop, EOpenLogicLintSeverity::Warning, BodyNodeID,
+					FText::Format(LOCTEXT("LatentInLoop", "{0} is latent but runs in the body of {1}. The loop does not wait for it, every iteration starts it again."),
+						FText::FromString(GetNodeName(BodyNodeID)), FText::FromString(GetNodeName(TaskPair.Key))));
+			}
+		}
+
+		// Producers re-evaluated on demand run again for every read, so once per iteration inside a loop
+		TArray<FGuid> Consumers = Body.Array();
+		Consumers.Add(TaskPair.Key);
+
+		for (const FGuid& ConsumerID : Consumers)
+		{
+			for (const FGuid& ProducerID : GetDataProducers(ConsumerID))
+			{
+				const UOpenLogicTask* ProducerTask = GetTask(ProducerID);
+				if (!ProducerTask || !ProducerTask->ReevaluateOnDemand || ReportedProducers.Contains(ProducerID))
+				{
+					continue;
+				}
+
+				ReportedProducers.Add(ProducerID);
+				AddIssue(EOpenLogicLintRule::ReevaluatedInLoop, EOpenLogicLintSeverity::Warning, ProducerID,
+					FText::Format(LOCTEXT("ReevaluatedInLoop", "{0} is re-evaluated on demand and feeds {1}, so it runs again on every iteration of {2}."),
+						FText::FromString(GetNodeName(ProducerID)), FText::FromString(GetNodeName(ConsumerID)), FText::FromString(GetNodeName(TaskPair.Key))));
+			}
+		}
+	}
+}
+
+void FOpenLogicGraphAnalyzer::CheckLiterals()
+{
+	for (const TPair<FGuid, FOpenLogicNode>& NodePair : GraphData.Nodes)
+	{
+		const FOpenLogicNode& Node = NodePair.Value;
+		int32 LargestLiteral = 0;
+
+		for (const TPair<int32, FOpenLogicPinState>& PinPair : Node.InputPins)
+		{
+			LargestLiteral = FMath::Max(LargestLiteral, PinPair.Value.DefaultValue.SerializedData.Num());
+		}
+
+		for (const TPair<FGuid, FString>& Content : Node.BlueprintContent)
+		{
+			LargestLiteral = FMath::Max(LargestLiteral, Content.Value.Len());
+		}
+
+		for (const TPair<FName, FString>& Content : Node.CppContent)
+		{
+			LargestLiteral = FMath::Max(LargestLiteral, Content.Value.Len());
+		}
+
+		if (LargestLiteral > Settings.MaxLiteralLength)
+		{
+			AddIssue(EOpenLogicLintRule::LargeLiteral, EOpenLogicLintSeverity::Warning, NodePair.Key,
+				FText::Format(LOCTEXT("LargeLiteral", "{0} holds a {1} character literal. It is copied into every task instance that runs it."),
+					FText::FromString(GetNodeName(NodePair.Key)), LargestLiteral));
+		}
+	}
+}
+
+void FOpenLogicGraphAnalyzer::CheckDataChains()
+{
+	TMap<FGuid, int32> Depths;
+	TSet<FGuid> Visiting;
+	TSet<FGuid> Consumed;
+
+	for (const TPair<FGuid, const UOpenLogicTask*>& TaskPair : Tasks)
+	{
+		Consumed.Append(GetDataProducers(TaskPair.Key));
+	}
+
+	for (const TPair<FGuid, const UOpenLogicTask*>& TaskPair : Tasks)
+	{
+		const int32 Depth = GetDataChainDepth(TaskPair.Key, Depths, Visiting);
+
+		// Only report the end of each chain
+		if (Depth > Settings.MaxDataChainDepth && !Consumed.Contains(TaskPair.Key))
+		{
+			AddIssue(EOpenLogicLintRule::DeepDataChain, EOpenLogicLintSeverity::Warning, TaskPair.Key,
+				FText::Format(LOCTEXT("DeepDataChain", "{0} depends on a chain of {1} data nodes, which are resolved one after another every time it runs."),
+					FText::FromString(GetNodeName(TaskPair.Key)), Depth));
+		}
+	}
+}
+
+void FOpenLogicGraphAnalyzer::EstimateEventCosts()
+{
+	for (const FGuid& EventNodeID : EventNodes)
+	{
+		TSet<FGuid> Visited;
+		TSet<FGuid> CountedProducers;
+		TSet<FGuid> Reached;
+
+		FOpenLogicEventCost EventCost;
+		EventCost.NodeID = EventNodeID;
+		EventCost.EventClass = GetTask(EventNodeID)->GetClass();
+		EventCost.EstimatedCost = EstimateExecutionCost(EventNodeID, 1.0f, Visited, CountedProducers, Reached);
+		EventCost.ReachableNodeCount = Reached.Num();
+
+		Result.EventCosts.Add(EventCost);
+	}
+
+	Result.EventCosts.Sort([](const FOpenLogicEventCost& A, const FOpenLogicEventCost& B) { return A.EstimatedCost > B.EstimatedCost; });
+}
+
+const UOpenLogicTask* FOpenLogicGraphAnalyzer::GetTask(const FGuid& NodeID) const
+{
+	const UOpenLogicTask* const* Task = Tasks.Find(NodeID);
+	return Task ? *Task : nullptr;
+}
+
+FString FOpenLogicGraphAnalyzer::GetNodeName(const FGuid& NodeID) const
+{
+	const UOpenLogicTask* Task = GetTask(NodeID);
+	return Task ? Task->TaskData.Name : NodeID.ToString();
+}
+
+TArray<FGuid> FOpenLogicGraphAnalyzer::GetExecutionTargets(const FGuid& NodeID, FName OnlyPin) const
+{
+	TArray<FGuid> Targets;
+
+	const FOpenLogicNode* Node = GraphData.Nodes.Find(NodeID);
+	if (!Node || !Tasks.Contains(NodeID))
+	{
+		return Targets;
+	}
+
+	for (const TPair<int32, FOpenLogicPinState>& PinPair : Node->OutputPins)
+	{
+		const FOpenLogicPinData PinData = Node->GetOutputPinData(PinPair.Key);
+		if (PinData.Role != EPinRole::FlowControl || (!OnlyPin.IsNone() && PinData.PinName != OnlyPin))
+		{
+			continue;
+		}
+
+		for (const FOpenLogicPinConnection& Connection : PinPair.Value.Connections)
+		{
+			if (Tasks.Contains(Connection.NodeID))
+			{
+				Targets.AddUnique(Connection.NodeID);
+			}
+		}
+	}
+
+	return Targets;
+}
+
+TArray<FGuid> FOpenLogicGraphAnalyzer::GetDataProducers(const FGuid& NodeID) const
+{
+	TArray<FGuid> Producers;
+
+	const FOpenLogicNode* Node = GraphData.Nodes.Find(NodeID);
+	if (!Node || !Tasks.Contains(NodeID))
+	{
+		return Producers;
+	}
+
+	for (const TPair<int32, FOpenLogicPinState>& PinPair : Node->InputPins)
+	{
+		if (Node->GetInputPinData(PinPair.Key).Role != EPinRole::DataProperty)
+		{
+			continue;
+		}
+
+		for (const FOpenLogicPinConnection& Connection : PinPair.Value.Connections)
+		{
+			if (Tasks.Contains(Connection.NodeID))
+			{
+				Producers.AddUnique(Connection.NodeID);
+			}
+		}
+	}
+
+	return Producers;
+}
+
+TSet<FGuid> FOpenLogicGraphAnalyzer::CollectExecutionReachable(const TArray<FGuid>& StartNodes) const
+{
+	TSet<FGuid> Reached;
+	TArray<FGuid> Pending = StartNodes;
+
+	while (Pending.Num() > 0)
+	{
+		const FGuid NodeID = Pending.Pop();
+
+		bool bAlreadyReached = false;
+		Reached.Add(NodeID, &bAlreadyReached);
+
+		if (!bAlreadyReached)
+		{
+			Pending.Append(GetExecutionTargets(NodeID));
+		}
+	}
+
+	return Reached;
+}
+
+int32 FOpenLogicGraphAnalyzer::GetDataChainDepth(const FGuid& NodeID, TMap<FGuid, int32>& Depths, TSet<FGuid>& Visiting) const
+{
+	if (const int32* Depth = Depths.Find(NodeID))
+	{
+		return *Depth;
+	}
+
+	// Data cycle, stop here
+	if (Visiting.Contains(NodeID))
+	{
+		return 0;
+	}
+
+	Visiting.Add(NodeID);
+
+	int32 Depth = 0;
+	for (const FGuid& ProducerID : GetDataProducers(NodeID))
+	{
+		Depth = FMath::Max(Depth, GetDataChainDepth(ProducerID, Depths, Visiting) + 1);
+	}
+
+	Visiting.Remove(NodeID);
+	Depths.Add(NodeID, Depth);
+
+	return Depth;
+}
+
+float FOpenLogicGraphAnalyzer::EstimateExecutionCost(const FGuid& NodeID, float Multiplier, TSet<FGuid>& Visited, TSet<FGuid>& CountedProducers, TSet<FGuid>& Reached) const
+{
+	// Nodes reached through several paths (or cycles) are counted once
+	bool bAlreadyVisited = false;
+	Visited.Add(NodeID, &bAlreadyVisited);
+
+	const UOpenLogicTask* Task = GetTask(NodeID);
+	if (bAlreadyVisited || !Task)
+	{
+		return 0.0f;
+	}
+
+	Reached.Add(NodeID);
+
+	float Cost = Task->EstimatedCost * Multiplier + EstimateDataCost(NodeID, Multiplier, CountedProducers, Reached, 0);
+
+	const float LoopMultiplier = Multiplier * FMath::Max(Settings.AssumedLoopIterations, 1);
+
+	for (const FGuid& TargetID : GetExecutionTargets(NodeID))
+	{
+		const bool bIsLoopBody = !Task->LoopBodyPin.IsNone() && GetExecutionTargets(NodeID, Task->LoopBodyPin).Contains(TargetID);
+		Cost += EstimateExecutionCost(TargetID, bIsLoopBody ? LoopMultiplier : Multiplier, Visited, CountedProducers, Reached);
+	}
+
+	return Cost;
+}
+
+float FOpenLogicGraphAnalyzer::EstimateDataCost(const FGuid& NodeID, float Multiplier, TSet<FGuid>& CountedProducers, TSet<FGuid>& Reached, int32 Depth) const
+{
+	if (Depth > OpenLogicGraphAnalyzer::MaxDataRecursion)
+	{
+		return 0.0f;
+	}
+
+	float Cost = 0.0f;
+
+	for (const FGuid& ProducerID : GetDataProducers(NodeID))
+	{
+		const UOpenLogicTask* ProducerTask = GetTask(ProducerID);
+		if (!ProducerTask)
+		{
+			continue;
+		}
+
+		Reached.Add(ProducerID);
+
+		// Producers are evaluated once per handle, unless they are re-evaluated on every read
+		bool bAlreadyCounted = false;
+		CountedProducers.Add(ProducerID, &bAlreadyCounted);
+
+		if (ProducerTask->ReevaluateOnDemand)
+		{
+			Cost += ProducerTask->EstimatedCost * Multiplier + EstimateDataCost(ProducerID, Multiplier, CountedProducers, Reached, Depth + 1);
+		}
+		else if (!bAlreadyCounted)
+		{
+			Cost += ProducerTask->EstimatedCost + EstimateDataCost(ProducerID, 1.0f, CountedProducers, Reached, Depth + 1);
+		}
+	}
+
+	return Cost;
+}
+
+void FOpenLogicGraphAnalyzer::AddIssue(EOpenLogicLintRule Rule, EOpenLogicLintSeverity Severity, const FGuid& NodeID, const FText& Message)
+{
+	FOpenLogicLintIssue& Issue = Result.Issues.AddDefaulted_GetRef();
+	Issue.Rule = Rule;
+	Issue.Severity = Severity;
+	Issue.NodeID = NodeID;
+	Issue.Message = Message;
+}
+
+#undef LOCTEXT_NAMESPACE
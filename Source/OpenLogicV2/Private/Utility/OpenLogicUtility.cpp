@@ -2,6 +2,8 @@
 
 #include "Utility/OpenLogicUtility.h"
 #include "JsonObjectConverter.h"
+#include "Subsystems/OpenLogicRuntimeSubsystem.h"
+#include "Engine/World.h"
 
 FText UOpenLogicUtility::GetPinValidityMessage(EPinConnectionValidity ConnectionValidity, UExecutionPinBase* SourcePin, UExecutionPinBase* TargetPin)
 {
@@ -50,7 +52,13 @@ UOpenLogicRuntimeGraph* UOpenLogicUtility::CreateRuntimeGraphFromObject(UObject*
 		return nullptr;
 	}
 
-	return CreateRuntimeGraphFromStruct(Outer, ContextObject, GraphObject->GraphData);
+	UOpenLogicRuntimeGraph* NewRuntimeGraph = CreateRuntimeGraphFromStruct(Outer, ContextObject, GraphObject->GraphData);
+	if (NewRuntimeGraph)
+	{
+		NewRuntimeGraph->SetSourceGraph(GraphObject);
+	}
+
+	return NewRuntimeGraph;
 }
 
 UOpenLogicRuntimeGraph* UOpenLogicUtility::CreateRuntimeGraphFromStruct(UObject* Outer, UObject* ContextObject, FOpenLogicGraphData GraphData)
@@ -64,6 +72,15 @@ UOpenLogicRuntimeGraph* UOpenLogicUtility::CreateRuntimeGraphFromStruct(UObject*
 	NewRuntimeGraph->SetGraphData(GraphData);
 	NewRuntimeGraph->SetContext(ContextObject);
 
+	// Register to the event dispatch index of the world, if there is one
+	if (UWorld* World = Outer ? Outer->GetWorld() : nullptr)
+	{
+		if (UOpenLogicRuntimeSubsystem* Subsystem = World->GetSubsystem<UOpenLogicRuntimeSubsystem>())
+		{
+			Subsystem->RegisterRuntimeGraph(NewRuntimeGraph);
+		}
+	}
+
 	return NewRuntimeGraph;
 }
 
@@ -101,6 +118,26 @@ void UOpenLogicUtility::LagTest()
 	
 }
 
+bool UOpenLogicUtility::GetEventLatency(TSubclassOf<UOpenLogicTask> EventClass, FOpenLogicEventLatency& OutLatency)
+{
+	if (!EventClass)
+	{
+		return false;
+	}
+
+	return FOpenLogicLatencyTracker::Get().GetEventLatency(FSoftObjectPath(EventClass.Get()), OutLatency);
+}
+
+TArray<FOpenLogicEventLatency> UOpenLogicUtility::GetAllEventLatencies()
+{
+	return FOpenLogicLatencyTracker::Get().GetAllEventLatencies();
+}
+
+void UOpenLogicUtility::ResetEventLatency(TSubclassOf<UOpenLogicTask> EventClass)
+{
+	FOpenLogicLatencyTracker::Get().Reset(EventClass ? FSoftObjectPath(EventClass.Get()) : FSoftObjectPath());
+}
+
 bool UOpenLogicUtility::PayloadToProperty(TSharedPtr<FJsonValue> Payload, FProperty* Property, void* ValuePtr)
 {
 	if (!Payload.IsValid() || !Property || !ValuePtr) return false;
@@ -6,9 +6,12 @@
 #include "Utility/OpenLogicUtility.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "InputCoreTypes.h"
+#include "Profiling/OpenLogicMemory.h"
 
 UPayloadObject* UPayloadObject::CreatePayloadValue(TSharedRef<FJsonValue> Value)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Payloads);
+
 	UPayloadObject* Node = NewObject<UPayloadObject>();
 	Node->JsonValue = Value;
 	return Node;
@@ -82,6 +85,8 @@ TSharedPtr<FJsonValue> UPayloadObject::GetField(TSharedPtr<FJsonValue> Value, FS
 
 UPayloadObject* UPayloadObject::Parse(const FString& JsonString, bool& Success)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Payloads);
+
 	Success = false;
 
 	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
@@ -220,6 +225,8 @@ TSharedRef<FJsonValue> UPayloadObject::ConvertToOriginalJsonValue(FProperty* Pro
 
 TSharedRef<FJsonValue> UPayloadObject::WildcardToPayload(FProperty* Property, void* ValuePtr)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Payloads);
+
 	if (ValuePtr == nullptr || Property == nullptr)
 	{
 		return MakeShareable(new FJsonValueNull());
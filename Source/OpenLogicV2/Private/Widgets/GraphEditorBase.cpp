@@ -16,9 +16,15 @@
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "TimerManager.h"
 #include "OpenLogicV2.h"
+#include "Profiling/OpenLogicMemory.h"
+#include "Utility/OpenLogicGraphAnalyzer.h"
+#include "Subsystems/OpenLogicRuntimeSubsystem.h"
+#include "Engine/Engine.h"
 
 void UGraphEditorBase::InitializeGraphEditor(UOpenLogicGraph* NewGraphObject)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Editor);
+
     if (bIsInitialized)
     {
         UE_LOG(OpenLogicLog, Warning, TEXT("[UGraphEditorBase::InitializeGraphEditor] This graph editor is already initialized."))
@@ -46,6 +52,9 @@ void UGraphEditorBase::InitializeGraphEditor(UOpenLogicGraph* NewGraphObject)
     // Bind the internal node desired size changed event
     OnNodeDesiredSizeChanged.AddDynamic(this, &UGraphEditorBase::OnNodeDesiredSizeChanged_Internal);
 
+    // Analyze the graph after it is saved
+    OnGraphSaved.AddDynamic(this, &UGraphEditorBase::OnGraphSaved_Internal);
+
     // Give the reference of the graph editor to the connection renderer
     if (ConnectionRenderer)
     {
@@ -215,6 +224,8 @@ void UGraphEditorBase::ClearAllConnections()
 
 UCustomConnection* UGraphEditorBase::CreateConnection(UExecutionPinBase* SourcePin, UExecutionPinBase* TargetPin, bool IsPreviewConnection, bool ShouldSaveConnection)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Editor);
+
     TSubclassOf<UCustomConnection> ConnectionClass = SourcePin->GetOwningNode()->PinConnectionClass;
     check(ConnectionClass);
 
@@ -377,6 +388,8 @@ void UGraphEditorBase::SetGraph(UOpenLogicGraph* NewGraph)
 
 void UGraphEditorBase::LoadNodes(TMap<FGuid, FOpenLogicNode>& GraphNodes)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Editor);
+
 	TArray<UNodeBase*> NodesWithOutputPins;
 
 	bool bHasModifiedGraphData = false;
@@ -745,6 +758,8 @@ void UGraphEditorBase::ClearSelectedNodes()
 // Creates a node widget based on the Task Class.
 UNodeBase* UGraphEditorBase::CreateNodeReference(TSubclassOf<UOpenLogicTask> TaskClass)
 {
+	LLM_SCOPE_BYTAG(OpenLogic_Editor);
+
 	if (!IsValid(TaskClass))
 	{
 		UE_LOG(OpenLogicLog, Error, TEXT("[UGraphEditorBase::CreateNodeReference] Task class is invalid."))
@@ -875,8 +890,18 @@ void UGraphEditorBase::BindRuntimeWorker(UOpenLogicRuntimeGraph* NewRuntimeWorke
 	BoundRuntimeWorker = NewRuntimeWorker;
 
     // Bind the runtime worker event delegates
-	BoundRuntimeWorker->OnNodeActivated.AddDynamic(this, &UGraphEditorBase::OnRuntimeTaskActivated);
-	BoundRuntimeWorker->OnNodeCompleted.AddDynamic(this, &UGraphEditorBase::OnRuntimeTaskCompleted);
+	bBoundToDebugEventStream = bBatchRuntimeEvents;
+
+	if (bBoundToDebugEventStream)
+	{
+		BoundRuntimeWorker->EnableDebugEventStream();
+		BoundRuntimeWorker->OnDebugEventsNative.AddUObject(this, &UGraphEditorBase::OnRuntimeDebugEvents);
+	}
+	else
+	{
+		BoundRuntimeWorker->OnNodeActivatedNative.AddUObject(this, &UGraphEditorBase::OnRuntimeTaskActivated);
+		BoundRuntimeWorker->OnNodeCompletedNative.AddUObject(this, &UGraphEditorBase::OnRuntimeTaskCompleted);
+	}
 }
 
 void UGraphEditorBase::UnbindRuntimeWorker()
@@ -886,8 +911,16 @@ void UGraphEditorBase::UnbindRuntimeWorker()
 		return;
 	}
 
-    BoundRuntimeWorker->OnNodeActivated.RemoveDynamic(this, &UGraphEditorBase::OnRuntimeTaskActivated);
-	BoundRuntimeWorker->OnNodeCompleted.RemoveDynamic(this, &UGraphEditorBase::OnRuntimeTaskCompleted);
+    BoundRuntimeWorker->OnNodeActivatedNative.RemoveAll(this);
+	BoundRuntimeWorker->OnNodeCompletedNative.RemoveAll(this);
+	BoundRuntimeWorker->OnDebugEventsNative.RemoveAll(this);
+
+	if (bBoundToDebugEventStream)
+	{
+		BoundRuntimeWorker->DisableDebugEventStream();
+		bBoundToDebugEventStream = false;
+	}
+
 	BoundRuntimeWorker = nullptr;
 }
 
@@ -915,6 +948,45 @@ void UGraphEditorBase::OnRuntimeTaskCompleted(UOpenLogicTask* CompletedRuntimeTa
 	}
 }
 
+void UGraphEditorBase::OnRuntimeDebugEvents(TConstArrayView<FOpenLogicNodeDebugEvent> Events, int32 DroppedCount)
+{
+	// Only the latest event of each node matters to its widget, plus whether it was activated at all
+	TMap<FGuid, const FOpenLogicNodeDebugEvent*> LatestEvents;
+	TSet<FGuid> ActivatedNodes;
+
+	for (const FOpenLogicNodeDebugEvent& Event : Events)
+	{
+		LatestEvents.Add(Event.NodeID, &Event);
+
+		if (Event.Type == EOpenLogicNodeDebugEventType::Activated)
+		{
+			ActivatedNodes.Add(Event.NodeID);
+		}
+	}
+
+	for (const TPair<FGuid, const FOpenLogicNodeDebugEvent*>& EventPair : LatestEvents)
+	{
+		UNodeBase* NodeWidget = GetNodeByGuid(EventPair.Key);
+		UOpenLogicTask* RuntimeTask = EventPair.Value->Task.Get();
+		if (!NodeWidget || !RuntimeTask)
+		{
+			continue;
+		}
+
+		if (ActivatedNodes.Contains(EventPair.Key))
+		{
+			NodeWidget->RuntimeTaskObject = RuntimeTask;
+			NodeWidget->OnRuntimeTaskActivated.Broadcast(RuntimeTask);
+		}
+
+		if (EventPair.Value->Type == EOpenLogicNodeDebugEventType::Completed)
+		{
+			NodeWidget->RuntimeTaskObject = nullptr;
+			NodeWidget->OnRuntimeTaskCompleted.Broadcast(RuntimeTask);
+		}
+	}
+}
+
 bool UGraphEditorBase::SetZoomLevel(float NewZoomLevel)
 {
     if (!ScaleBox_Graph)
@@ -1009,6 +1081,73 @@ const FVector2D UGraphEditorBase::GetGraphMousePosition() const
     return CanvasPanel_Nodes->GetCachedGeometry().AbsoluteToLocal(GetMousePosition());
 }
 
+FOpenLogicGraphAnalysis UGraphEditorBase::AnalyzeGraph()
+{
+    if (!GetGraph())
+    {
+        return FOpenLogicGraphAnalysis();
+    }
+
+    LastAnalysis = FOpenLogicGraphAnalyzer::Analyze(GetGraph()->GraphData, AnalyzerSettings);
+    FOpenLogicGraphAnalyzer::ReportToMessageLog(LastAnalysis, GetGraph()->GraphData, GetGraph()->GetName());
+
+    for (const TPair<FGuid, UNodeBase*>& NodePair : Nodes)
+    {
+        if (NodePair.Value)
+        {
+            NodePair.Value->SetLintIssues(LastAnalysis.GetIssuesForNode(NodePair.Key));
+        }
+    }
+
+    return LastAnalysis;
+}
+
+void UGraphEditorBase::OnGraphSaved_Internal(FOpenLogicGraphData GraphData)
+{
+    if (!GetWorld())
+    {
+        return;
+    }
+
+    // Restarts the countdowns on every save
+    if (bAnalyzeOnSave)
+    {
+        GetWorld()->GetTimerManager().SetTimer(TimerHandle_AnalyzeGraph, this, &UGraphEditorBase::Timer_AnalyzeGraph, 0.5f, false);
+    }
+
+    if (bPatchRunningGraphsOnSave)
+    {
+        GetWorld()->GetTimerManager().SetTimer(TimerHandle_PatchRunningGraphs, this, &UGraphEditorBase::Timer_PatchRunningGraphs, 0.2f, false);
+    }
+}
+
+void UGraphEditorBase::Timer_AnalyzeGraph()
+{
+    AnalyzeGraph();
+}
+
+void UGraphEditorBase::Timer_PatchRunningGraphs()
+{
+    if (!GEngine || !GetGraph())
+    {
+        return;
+    }
+
+    for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+    {
+        UWorld* World = WorldContext.World();
+        if (!World || (WorldContext.WorldType != EWorldType::Game && WorldContext.WorldType != EWorldType::PIE))
+        {
+            continue;
+        }
+
+        if (UOpenLogicRuntimeSubsystem* Subsystem = World->GetSubsystem<UOpenLogicRuntimeSubsystem>())
+        {
+            Subsystem->PatchRuntimeGraphs(GetGraph());
+        }
+    }
+}
+
 void UGraphEditorBase::Timer_SaveGraphPosition()
 {
     if (bCanSaveGraphPosition)
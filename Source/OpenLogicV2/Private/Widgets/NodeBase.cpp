@@ -354,6 +354,48 @@ void UNodeBase::SaveNode()
 	#endif
 }
 
+void UNodeBase::SetLintIssues(const TArray<FOpenLogicLintIssue>& NewIssues)
+{
+	// Nothing changed for most nodes on most saves
+	if (NewIssues.IsEmpty() && LintIssues.IsEmpty())
+	{
+		return;
+	}
+
+	LintIssues = NewIssues;
+	OnLintIssuesChanged(LintIssues);
+}
+
+void UNodeBase::OnLintIssuesChanged_Implementation(const TArray<FOpenLogicLintIssue>& Issues)
+{
+	if (!bToolTipHasLintIssues)
+	{
+		ToolTipWithoutLintIssues = ToolTipText;
+	}
+
+	if (Issues.IsEmpty())
+	{
+		SetToolTipText(ToolTipWithoutLintIssues);
+		bToolTipHasLintIssues = false;
+		return;
+	}
+
+	TArray<FString> Messages;
+	for (const FOpenLogicLintIssue& Issue : Issues)
+	{
+		Messages.Add(Issue.Message.ToString());
+	}
+
+	FString ToolTip = FString::Join(Messages, TEXT("\n"));
+	if (!ToolTipWithoutLintIssues.IsEmpty())
+	{
+		ToolTip = FString::Printf(TEXT("%s\n\n%s"), *ToolTipWithoutLintIssues.ToString(), *ToolTip);
+	}
+
+	SetToolTipText(FText::FromString(ToolTip));
+	bToolTipHasLintIssues = true;
+}
+
 void UNodeBase::SaveNodePosition(FVector2D Position)
 {
 	GetNodeStateData().Position = Position;
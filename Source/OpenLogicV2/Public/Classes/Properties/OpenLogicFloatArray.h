@@ -0,0 +1,20 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "OpenLogicFloatArray.generated.h"
+
+// An array of floats. Its runtime values are described by the Value property, like Blueprint property classes.
+UCLASS()
+class OPENLOGICV2_API UOpenLogicFloatArray : public UOpenLogicProperty
+{
+	GENERATED_BODY()
+
+public:
+	UOpenLogicFloatArray();
+
+	UPROPERTY()
+		TArray<float> Value;
+};
@@ -0,0 +1,20 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "OpenLogicVectorArray.generated.h"
+
+// An array of vectors. Its runtime values are described by the Value property, like Blueprint property classes.
+UCLASS()
+class OPENLOGICV2_API UOpenLogicVectorArray : public UOpenLogicProperty
+{
+	GENERATED_BODY()
+
+public:
+	UOpenLogicVectorArray();
+
+	UPROPERTY()
+		TArray<FVector> Value;
+};
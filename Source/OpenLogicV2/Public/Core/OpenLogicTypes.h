@@ -12,10 +12,18 @@
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Serialization/StructuredArchive.h"
 #include "UObject/StructOnScope.h"
+#include <atomic>
+#include "Misc/EngineVersionComparison.h"
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#include "InstancedStruct.h"
+#else
+#include "StructUtils/InstancedStruct.h"
+#endif
 #include "OpenLogicTypes.generated.h"
 
 class UWidget;
 class UOpenLogicTask;
+class UOpenLogicStructTask;
 class UOpenLogicProperty;
 class UExecutionPinBase;
 class UNodeBase;
@@ -299,6 +307,9 @@ struct OPENLOGICV2_API FTaskData
 	// A connector that can send data or execute other nodes.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pins")
 	TArray<FOpenLogicPinData> OutputPins;
+
+	// Returns a hash of the names and roles of the pins, which changes whenever a pin index may have changed. Never 0.
+	uint32 GetPinSchemaHash() const;
 };
 
 USTRUCT(BlueprintType)
@@ -493,7 +504,7 @@ enum class EPinConnectionValidity : uint8
 	IdenticalNode, // Attempting to connect the same node
 };
 
-UENUM()
+UENUM(BlueprintType)
 enum class EOpenLogicTaskState : uint8
 {
 	None, // Task is not initialized
@@ -510,6 +521,19 @@ enum class EOpenLogicRuntimeThreadType : uint8
 	BackgroundThread
 };
 
+// The order execution handles waiting in a queue are run in, from lowest to highest.
+UENUM(BlueprintType)
+enum class EOpenLogicExecutionPriority : uint8
+{
+	Low,
+	Normal,
+	High,
+	Critical
+};
+
+// The number of execution priorities, which is the number of levels of the priority queues.
+constexpr int32 OpenLogicExecutionPriorityCount = static_cast<int32>(EOpenLogicExecutionPriority::Critical) + 1;
+
 USTRUCT(BlueprintType)
 struct OPENLOGICV2_API FOpenLogicThreadSettings
 {
@@ -517,6 +541,91 @@ struct OPENLOGICV2_API FOpenLogicThreadSettings
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Thread Settings")
 		EOpenLogicRuntimeThreadType NodeExecutionThread = EOpenLogicRuntimeThreadType::GameThread;
+
+	// Queued execution handles gain one priority level for each period of this length they wait, so low priorities
+	// still run under a steady load of higher ones. 0 disables aging.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Thread Settings", meta = (ClampMin = "0", Units = "s"))
+		float PriorityAgingSeconds = 0.05f;
+};
+
+// Why the tasks of an execution handle are being stopped before completing.
+UENUM(BlueprintType)
+enum class EOpenLogicCancellationReason : uint8
+{
+	None,
+
+	// The execution handle was cancelled through CancelExecutionHandle.
+	Requested,
+
+	// The execution handle ran longer than its timeout.
+	HandleTimedOut,
+
+	// The node waited on a latent completion longer than its timeout. Only this node is cancelled.
+	NodeTimedOut
+};
+
+/**
+ * Tells the tasks of an execution handle that it was cancelled. Copies share the same state, so a task can keep the
+ * token (e.g. in the lambda of asynchronous work) and check it from any thread.
+ */
+struct OPENLOGICV2_API FOpenLogicCancellationToken
+{
+public:
+	static FOpenLogicCancellationToken Create();
+
+	bool IsCancellationRequested() const
+	{
+		return State.IsValid() && State->load(std::memory_order_relaxed) != EOpenLogicCancellationReason::None;
+	}
+
+	EOpenLogicCancellationReason GetReason() const
+	{
+		return State.IsValid() ? State->load(std::memory_order_relaxed) : EOpenLogicCancellationReason::None;
+	}
+
+	// Requests the cancellation. Returns false if it was already requested, in which case the first reason is kept.
+	bool Cancel(EOpenLogicCancellationReason Reason) const;
+
+private:
+	TSharedPtr<std::atomic<EOpenLogicCancellationReason>, ESPMode::ThreadSafe> State;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicPriorityQueueMetrics
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Queue")
+		EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal;
+
+	// The number of entries waiting in the queue.
+	UPROPERTY(BlueprintReadOnly, Category = "Queue")
+		int32 QueueDepth = 0;
+
+	// The number of entries that left the queue since it was created.
+	UPROPERTY(BlueprintReadOnly, Category = "Queue")
+		int32 DequeuedCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Queue")
+		float AverageWaitMilliseconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Queue")
+		float MaxWaitMilliseconds = 0.0f;
+};
+
+/**
+ * The counters behind FOpenLogicPriorityQueueMetrics, for one priority. Entries can be added from any thread.
+ */
+struct OPENLOGICV2_API FOpenLogicPriorityQueueCounters
+{
+	std::atomic<int32> QueueDepth{0};
+	std::atomic<int32> DequeuedCount{0};
+	std::atomic<uint64> TotalWaitMicroseconds{0};
+	std::atomic<uint64> MaxWaitMicroseconds{0};
+
+	void RecordEnqueue();
+	void RecordDequeue(uint64 WaitMicroseconds);
+	FOpenLogicPriorityQueueMetrics GetMetrics(EOpenLogicExecutionPriority Priority) const;
 };
 
 USTRUCT()
@@ -539,6 +648,19 @@ public:
 	}
 };
 
+/**
+ * Storage allocated for an output data pin when its node is created, which writes copy into in place while no other
+ * pin holds it.
+ */
+struct FOpenLogicOutputSlot
+{
+	// The default object of the pin's property class, which describes the value. nullptr if the pin has no slot.
+	const UOpenLogicProperty* PropertyObject = nullptr;
+
+	// Shared with OutputProperties once written, and with the inputs of the consumers.
+	TSharedPtr<void> Value;
+};
+
 USTRUCT()
 struct OPENLOGICV2_API FOpenLogicRuntimeNode
 {
@@ -577,6 +699,24 @@ public:
 
 	// The output properties of the node.
 	TMap<int32, TSharedPtr<void>> OutputProperties;
+
+	// Preallocated output values indexed by output pin index - 1, only for pins whose type is known up front.
+	TArray<FOpenLogicOutputSlot> OutputSlots;
+
+	// True while the node is waiting on a latent completion, which keeps its execution handle running.
+	bool bPendingCompletion = false;
+
+	// When the node times out while pending completion (FPlatformTime::Seconds), 0 if it has no timeout.
+	double TimeoutDeadline = 0.0;
+
+	// The execution handle the node belongs to.
+	int32 ExecutionHandleIndex = INDEX_NONE;
+
+	// The class default object of a struct task, which runs the node in place of a task instance.
+	const UOpenLogicStructTask* StructTask = nullptr;
+
+	// The state of a struct task, kept inline for the lifetime of the node. Not visible to the garbage collector.
+	FInstancedStruct InstanceData;
 	
 	bool IsValid() const
 	{
@@ -607,12 +747,35 @@ struct OPENLOGICV2_API FOpenLogicGraphExecutionHandle
 	UPROPERTY()
 		UOpenLogicRuntimeGraph* RuntimeGraph = nullptr;
 
+	// The order the handle runs in when it has to wait in a queue.
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic")
+		EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal;
+
 	TMap<FGuid, TSharedPtr<FOpenLogicRuntimeNode>> RuntimeNodes;
 
+	// Shared with the copies of the handle and the tasks it runs, set when the handle is cancelled.
+	FOpenLogicCancellationToken CancellationToken;
+
+	// Latency tracking: when the handle was created and when its entry node was activated.
+	uint64 TriggerCycles = 0;
+	uint64 StartCycles = 0;
+
+	// The number of nested node activations currently on the stack, and of nodes waiting on a latent completion.
+	int32 ActivationDepth = 0;
+	int32 PendingNodes = 0;
+
+	bool bLatencyRecorded = false;
+
 	bool IsValid() const
 	{
 		return RuntimeGraph && NodeID.IsValid();
 	}
+
+	// Whether the handle ran and has nothing left running or waiting on a latent completion.
+	bool IsFinished() const
+	{
+		return IsProcessed && !IsRunning;
+	}
 };
 
 USTRUCT()
@@ -622,26 +785,147 @@ struct OPENLOGICV2_API FOpenLogicQueuedExecutionHandle
 
 	UPROPERTY()
 		int32 HandleIndex = INDEX_NONE;
+
+	UPROPERTY()
+		EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal;
+
+	// When the handle was queued, to age it and measure its wait.
+	uint64 EnqueueCycles = 0;
 };
 
+/**
+ * The task instances of a task class, reused across activations. The pool is what keeps its instances alive, so every
+ * instance in it is gone through by the garbage collector on each pass.
+ */
 USTRUCT()
 struct OPENLOGICV2_API FOpenLogicTaskPool
 {
 	GENERATED_USTRUCT_BODY()
 
 	// Set of reusable task instances
-	TSet<UOpenLogicTask*> AvailableTasks;
+	UPROPERTY()
+		TSet<UOpenLogicTask*> AvailableTasks;
 
 	// Set of task instances that are currently in use
-	TSet<UOpenLogicTask*> ActiveTasks;
+	UPROPERTY()
+		TSet<UOpenLogicTask*> ActiveTasks;
 
 	// Retrieves a task from the pool or creates a new one if none are available
 	UOpenLogicTask* GetTaskInstance(TSubclassOf<UOpenLogicTask> TaskClass, UObject* Outer);
 
-	// Returns a task instance to the pool
-	void ReturnTaskInstance(UOpenLogicTask* TaskInstance);
+	// Returns a task instance to the pool, or leaves it to the garbage collector if the pool already has
+	// MaxAvailableTasks reusable instances (0 for no limit)
+	void ReturnTaskInstance(UOpenLogicTask* TaskInstance, int32 MaxAvailableTasks = 0);
+
+	// Leaves the reusable task instances above MaxAvailableTasks to the garbage collector, returns how many were released
+	int32 Trim(int32 MaxAvailableTasks);
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicMemoryFootprint
+{
+	GENERATED_USTRUCT_BODY()
+
+	// The runtime copy of the graph data (nodes, pins, connections, default values).
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 GraphDataBytes = 0;
+
+	// The handle registry and the execution handles themselves.
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 HandleBytes = 0;
+
+	// Runtime nodes and their property maps.
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 RuntimeNodeBytes = 0;
+
+	// Pin values held by the runtime nodes.
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 ValueBytes = 0;
+
+	// Task pools, pooled task instances and persistent nodes.
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 TaskPoolBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int64 TotalBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int32 HandleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int32 RuntimeNodeCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int32 PooledTaskCount = 0;
+
+	// The task instances kept alive by the graph, pooled or persistent, which every garbage collection goes through.
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+		int32 GCObjectCount = 0;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicGraphPatchResult
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 AddedNodes = 0;
+
+	// Removed nodes, and nodes whose task class changed.
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 RemovedNodes = 0;
+
+	// Nodes whose connections, default values or properties changed.
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 ChangedNodes = 0;
+
+	// Running nodes that were cancelled because their node was removed.
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 CancelledNodes = 0;
+
+	// Execution handles destroyed because their entry node was removed.
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 DestroyedHandles = 0;
+
+	// Execution handles kept running through the patch.
+	UPROPERTY(BlueprintReadOnly, Category = "Patch")
+		int32 PreservedHandles = 0;
+};
+
+UENUM(BlueprintType)
+enum class EOpenLogicNodeDebugEventType : uint8
+{
+	Activated,
+	Completed
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicNodeDebugEvent
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+		EOpenLogicNodeDebugEventType Type = EOpenLogicNodeDebugEventType::Activated;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+		FGuid NodeID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+		int32 HandleIndex = INDEX_NONE;
+
+	// The task instance at the time of the event. It may have been returned to its pool since.
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+		TWeakObjectPtr<UOpenLogicTask> Task;
+
+	// FPlatformTime::Seconds() when the event happened.
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+		double Timestamp = 0.0;
 };
 
+/**
+ * Refers to a pin of a task by name. Blueprint literals also carry the pin index resolved when the blueprint was
+ * compiled, which is used instead of the name as long as the pins of the task have not changed since.
+ */
 USTRUCT(BlueprintType)
 struct OPENLOGICV2_API FOpenLogicPinHandle
 {
@@ -650,6 +934,14 @@ struct OPENLOGICV2_API FOpenLogicPinHandle
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = OpenLogic)
 		FName PinName;
 
+	// The index of the pin when the handle was baked, INDEX_NONE if it was not.
+	UPROPERTY()
+		int32 PinIndex = INDEX_NONE;
+
+	// The pin schema hash of the task when the handle was baked, see FTaskData::GetPinSchemaHash().
+	UPROPERTY()
+		uint32 SchemaHash = 0;
+
 	FOpenLogicPinHandle() = default;
 
 	FOpenLogicPinHandle(const char* InPinName)
@@ -12,6 +12,9 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	FDelegateHandle EndFrameHandle;
 };
 
 DECLARE_LOG_CATEGORY_EXTERN(OpenLogicLog, Log, All);
\ No newline at end of file
@@ -0,0 +1,54 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Forward declarations
+class UOpenLogicRuntimeGraph;
+struct FOpenLogicNode;
+struct FOpenLogicRuntimeNode;
+
+/**
+ * Writes runtime graph execution to a Chrome Trace Event Format (JSON) file that can be opened in Perfetto or chrome://tracing.
+ * Every runtime graph is a process and every execution handle a thread, node activations are duration events with their
+ * pin values as args, and the execution connections followed by Then are drawn as flow arrows.
+ *
+ * Does not depend on Unreal Insights, so it is available in every build configuration, headless servers included:
+ *   -OpenLogicChromeTrace[=<file>] on the command line, or OpenLogic.ChromeTrace.Start [file] / OpenLogic.ChromeTrace.Stop from the console.
+ */
+class OPENLOGICV2_API FOpenLogicChromeTrace
+{
+public:
+	// Starts writing to the given file (Saved/OpenLogic/Traces/<timestamp>.json if empty). Stops any recording in progress.
+	static bool Start(const FString& FilePath = FString());
+
+	// Finishes and closes the current file.
+	static void Stop();
+
+	static bool IsRecording() { return bRecording.load(std::memory_order_relaxed); }
+
+	// Microseconds since the recording started.
+	static double GetTimestamp();
+
+	static FString GetDefaultFilePath();
+
+public:
+	static void OutputHandleCreated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FString& EventName);
+	static void OutputNodeActivation(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const UClass* TaskClass, const FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode* NodeData, double StartTimestamp, bool bPending);
+	static void OutputNodeCompleted(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const UClass* TaskClass);
+
+	// Starts a flow arrow from the current node; it ends on the next node activated on the same handle.
+	static void OutputThen(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, FName PinName);
+
+private:
+	static void WriteEvent(const FString& Event);
+	static void WriteProcessName(const UOpenLogicRuntimeGraph* Graph);
+	static void FlushBuffer();
+
+	static FString EscapeString(const FString& Value);
+	static void AppendPinArgs(FString& Args, const FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData);
+
+	static std::atomic<bool> bRecording;
+};
@@ -0,0 +1,121 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+#include "OpenLogicLatency.generated.h"
+
+// Forward declarations
+class UOpenLogicTask;
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicLatencyStats
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		int64 SampleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		double MeanMilliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		double P50Milliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		double P95Milliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		double P99Milliseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		double MaxMilliseconds = 0.0;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicEventLatency
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		TSubclassOf<UOpenLogicTask> EventClass;
+
+	// From the event being triggered to its execution handle finishing.
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		FOpenLogicLatencyStats Total;
+
+	// From the event being triggered to its entry node being activated (background thread queue).
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		FOpenLogicLatencyStats QueueWait;
+
+	// From the entry node being activated to the last running node completing, latent waits included.
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+		FOpenLogicLatencyStats Execution;
+};
+
+/**
+ * A log-linear (HDR-style) histogram of microsecond values. Every power of two is split into 64 buckets,
+ * so the reported percentiles are within ~1.5% of the recorded values while using a fixed amount of memory.
+ */
+class OPENLOGICV2_API FOpenLogicLatencyHistogram
+{
+public:
+	void Record(uint64 Microseconds);
+	void Reset();
+
+	FOpenLogicLatencyStats GetStats() const;
+	uint64 GetValueAtPercentile(double Percentile) const;
+	int64 GetSampleCount() const { return SampleCount; }
+
+private:
+	static int32 GetBucketIndex(uint64 Value);
+	static uint64 GetBucketUpperBound(int32 BucketIndex);
+
+	static constexpr int32 SubBucketBits = 7;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 SubBucketHalfCount = SubBucketCount / 2;
+
+	// Values are clamped to 2^36 us (~19 hours)
+	static constexpr int32 MaxValueBits = 36;
+	static constexpr int32 BucketCount = (MaxValueBits - SubBucketBits + 2) * SubBucketHalfCount;
+
+	TArray<uint32> Buckets;
+	int64 SampleCount = 0;
+	uint64 SumMicroseconds = 0;
+	uint64 MaxMicroseconds = 0;
+};
+
+/**
+ * Collects trigger-to-completion latencies of execution handles, per event class, across every runtime graph.
+ * Samples can be recorded from any thread.
+ */
+class OPENLOGICV2_API FOpenLogicLatencyTracker
+{
+public:
+	static FOpenLogicLatencyTracker& Get();
+
+	void Record(const FSoftObjectPath& EventClass, uint64 QueueWaitMicroseconds, uint64 ExecutionMicroseconds);
+
+	bool GetEventLatency(const FSoftObjectPath& EventClass, FOpenLogicEventLatency& OutLatency) const;
+	TArray<FOpenLogicEventLatency> GetAllEventLatencies() const;
+
+	// Resets a single event class, or every event class if the path is empty.
+	void Reset(const FSoftObjectPath& EventClass = FSoftObjectPath());
+
+	// Logs every event class, sorted by p99 total latency.
+	void Dump() const;
+
+private:
+	struct FEventHistograms
+	{
+		FOpenLogicLatencyHistogram Total;
+		FOpenLogicLatencyHistogram QueueWait;
+		FOpenLogicLatencyHistogram Execution;
+	};
+
+	static FOpenLogicEventLatency MakeEventLatency(const FSoftObjectPath& EventClass, const FEventHistograms& Histograms);
+
+	mutable FCriticalSection Lock;
+	TMap<FSoftObjectPath, FEventHistograms> Events;
+};
@@ -0,0 +1,27 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Low-Level Memory Tracker tags for OpenLogic. Run with -llm (or -trace=memtag) to see them in the LLM stat pages and Insights.
+ * Every tag is parented to OpenLogic so the total shows up as one line.
+ */
+LLM_DECLARE_TAG_API(OpenLogic, OPENLOGICV2_API);
+
+// Runtime graphs: graph data copies, handle registries and runtime node maps
+LLM_DECLARE_TAG_API(OpenLogic_RuntimeGraph, OPENLOGICV2_API);
+
+// Task instances created by the task pools
+LLM_DECLARE_TAG_API(OpenLogic_TaskPool, OPENLOGICV2_API);
+
+// Pin values held by runtime nodes
+LLM_DECLARE_TAG_API(OpenLogic_Values, OPENLOGICV2_API);
+
+// Payload objects and their JSON values
+LLM_DECLARE_TAG_API(OpenLogic_Payloads, OPENLOGICV2_API);
+
+// Graph editor widgets
+LLM_DECLARE_TAG_API(OpenLogic_Editor, OPENLOGICV2_API);
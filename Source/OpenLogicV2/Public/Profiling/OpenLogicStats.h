@@ -0,0 +1,69 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include <atomic>
+
+/**
+ * OpenLogic runtime stats. Use "stat OpenLogic" in a running instance, or capture a CSV profile (-csvCaptureFrames=N / csvprofile start)
+ * to get the OpenLogic columns next to the frame and server tick times.
+ */
+DECLARE_STATS_GROUP(TEXT("OpenLogic"), STATGROUP_OpenLogic, STATCAT_Advanced);
+
+// Cycle stats
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ActivateNode"), STAT_OpenLogic_ActivateNode, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ResolveConnectedPinValue"), STAT_OpenLogic_ResolveConnectedPinValue, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("InitializeTaskInstance"), STAT_OpenLogic_InitializeTaskInstance, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Then"), STAT_OpenLogic_Then, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ProcessQueue"), STAT_OpenLogic_ProcessQueue, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ActivateBatchedNode"), STAT_OpenLogic_ActivateBatchedNode, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SaveState"), STAT_OpenLogic_SaveState, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LoadState"), STAT_OpenLogic_LoadState, STATGROUP_OpenLogic, OPENLOGICV2_API);
+
+// Counters, kept across frames
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Handles"), STAT_OpenLogic_ActiveHandles, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Runtime Nodes"), STAT_OpenLogic_RuntimeNodes, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Activations"), STAT_OpenLogic_QueuedActivations, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Tasks (Available)"), STAT_OpenLogic_PooledTasksAvailable, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Tasks (Active)"), STAT_OpenLogic_PooledTasksActive, STATGROUP_OpenLogic, OPENLOGICV2_API);
+
+// Counters, reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Node Activations"), STAT_OpenLogic_NodeActivations, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Value Copies"), STAT_OpenLogic_ValueCopies, STATGROUP_OpenLogic, OPENLOGICV2_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cancelled Tasks"), STAT_OpenLogic_CancelledTasks, STATGROUP_OpenLogic, OPENLOGICV2_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(OPENLOGICV2_API, OpenLogic);
+
+/**
+ * Mirrors the OpenLogic counters outside of the stats system, so they can be recorded into CSV profiles
+ * (stats are compiled out of Test/Shipping servers, the CSV profiler is not).
+ */
+struct OPENLOGICV2_API FOpenLogicStats
+{
+	static std::atomic<int32> ActiveHandles;
+	static std::atomic<int32> RuntimeNodes;
+	static std::atomic<int32> QueuedActivations;
+	static std::atomic<int32> PooledTasksAvailable;
+	static std::atomic<int32> PooledTasksActive;
+	static std::atomic<int32> NodeActivations;
+	static std::atomic<int32> ValueCopies;
+	static std::atomic<int32> CancelledTasks;
+
+	// Writes the counters into the OpenLogic CSV category. Called once per frame at the end of the frame.
+	static void RecordFrame();
+};
+
+#define OPENLOGIC_COUNTER_INC(Counter, Amount) \
+	{ \
+		FOpenLogicStats::Counter.fetch_add(Amount, std::memory_order_relaxed); \
+		INC_DWORD_STAT_BY(STAT_OpenLogic_##Counter, Amount); \
+	}
+
+#define OPENLOGIC_COUNTER_DEC(Counter, Amount) \
+	{ \
+		FOpenLogicStats::Counter.fetch_sub(Amount, std::memory_order_relaxed); \
+		DEC_DWORD_STAT_BY(STAT_OpenLogic_##Counter, Amount); \
+	}
@@ -0,0 +1,66 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Config.h"
+#include "Trace/Trace.h"
+
+// Forward declarations
+class UOpenLogicRuntimeGraph;
+
+#if !defined(OPENLOGIC_TRACE_ENABLED)
+	#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+		#define OPENLOGIC_TRACE_ENABLED 1
+	#else
+		#define OPENLOGIC_TRACE_ENABLED 0
+	#endif
+#endif
+
+#if OPENLOGIC_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(OpenLogicChannel, OPENLOGICV2_API);
+
+/**
+ * Emits OpenLogic runtime events on the OpenLogic trace channel.
+ * Enable it with -trace=openlogic (optionally combined with cpu,frame) and open the resulting .utrace in Unreal Insights.
+ */
+struct OPENLOGICV2_API FOpenLogicTrace
+{
+	static void OutputGraph(const UOpenLogicRuntimeGraph* Graph);
+	static void OutputHandleCreated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& EntryNodeID);
+	static void OutputHandleDestroyed(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex);
+	static void OutputNodeActivated(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, const UClass* TaskClass);
+	static void OutputNodeActivationEnd(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, bool bPending);
+	static void OutputNodeCompleted(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, const UClass* TaskClass);
+	static void OutputPinWrite(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex, const FGuid& NodeID, int32 PinIndex);
+	static void OutputPoolAccess(const UClass* TaskClass, bool bHit, int32 AvailableCount);
+	static void OutputQueueEnqueue(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex);
+	static void OutputQueueDequeue(const UOpenLogicRuntimeGraph* Graph, int32 HandleIndex);
+};
+
+#define OPENLOGIC_TRACE_GRAPH(Graph) FOpenLogicTrace::OutputGraph(Graph)
+#define OPENLOGIC_TRACE_HANDLE_CREATED(Graph, HandleIndex, EntryNodeID) FOpenLogicTrace::OutputHandleCreated(Graph, HandleIndex, EntryNodeID)
+#define OPENLOGIC_TRACE_HANDLE_DESTROYED(Graph, HandleIndex) FOpenLogicTrace::OutputHandleDestroyed(Graph, HandleIndex)
+#define OPENLOGIC_TRACE_NODE_ACTIVATED(Graph, HandleIndex, NodeID, TaskClass) FOpenLogicTrace::OutputNodeActivated(Graph, HandleIndex, NodeID, TaskClass)
+#define OPENLOGIC_TRACE_NODE_ACTIVATION_END(Graph, HandleIndex, NodeID, bPending) FOpenLogicTrace::OutputNodeActivationEnd(Graph, HandleIndex, NodeID, bPending)
+#define OPENLOGIC_TRACE_NODE_COMPLETED(Graph, HandleIndex, NodeID, TaskClass) FOpenLogicTrace::OutputNodeCompleted(Graph, HandleIndex, NodeID, TaskClass)
+#define OPENLOGIC_TRACE_PIN_WRITE(Graph, HandleIndex, NodeID, PinIndex) FOpenLogicTrace::OutputPinWrite(Graph, HandleIndex, NodeID, PinIndex)
+#define OPENLOGIC_TRACE_POOL_ACCESS(TaskClass, bHit, AvailableCount) FOpenLogicTrace::OutputPoolAccess(TaskClass, bHit, AvailableCount)
+#define OPENLOGIC_TRACE_QUEUE_ENQUEUE(Graph, HandleIndex) FOpenLogicTrace::OutputQueueEnqueue(Graph, HandleIndex)
+#define OPENLOGIC_TRACE_QUEUE_DEQUEUE(Graph, HandleIndex) FOpenLogicTrace::OutputQueueDequeue(Graph, HandleIndex)
+
+#else
+
+#define OPENLOGIC_TRACE_GRAPH(Graph)
+#define OPENLOGIC_TRACE_HANDLE_CREATED(Graph, HandleIndex, EntryNodeID)
+#define OPENLOGIC_TRACE_HANDLE_DESTROYED(Graph, HandleIndex)
+#define OPENLOGIC_TRACE_NODE_ACTIVATED(Graph, HandleIndex, NodeID, TaskClass)
+#define OPENLOGIC_TRACE_NODE_ACTIVATION_END(Graph, HandleIndex, NodeID, bPending)
+#define OPENLOGIC_TRACE_NODE_COMPLETED(Graph, HandleIndex, NodeID, TaskClass)
+#define OPENLOGIC_TRACE_PIN_WRITE(Graph, HandleIndex, NodeID, PinIndex)
+#define OPENLOGIC_TRACE_POOL_ACCESS(TaskClass, bHit, AvailableCount)
+#define OPENLOGIC_TRACE_QUEUE_ENQUEUE(Graph, HandleIndex)
+#define OPENLOGIC_TRACE_QUEUE_DEQUEUE(Graph, HandleIndex)
+
+#endif
@@ -0,0 +1,274 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include "UObject/ObjectKey.h"
+#include "OpenLogicBatchedGraph.generated.h"
+
+class UOpenLogicTask;
+class UOpenLogicBatchedGraph;
+
+/**
+ * The values of one data pin for every instance of a batched graph, stored contiguously and indexed by instance.
+ */
+struct OPENLOGICV2_API FOpenLogicBatchColumn
+{
+	FOpenLogicBatchColumn() = default;
+	FOpenLogicBatchColumn(const FProperty* InValueProperty, const TSharedPtr<void>& InDefaultValue);
+
+	// Describes the values by their struct, or as plain data of Stride bytes if InStructType is null.
+	FOpenLogicBatchColumn(const UScriptStruct* InStructType, int32 InStride, const TSharedPtr<void>& InDefaultValue);
+	~FOpenLogicBatchColumn();
+
+	FOpenLogicBatchColumn(const FOpenLogicBatchColumn&) = delete;
+	FOpenLogicBatchColumn& operator=(const FOpenLogicBatchColumn&) = delete;
+
+	// The Value property of the pin's UOpenLogicProperty class, which describes one element.
+	const FProperty* ValueProperty = nullptr;
+
+	// The struct of one element, for built-in property classes without a Value property.
+	const UScriptStruct* StructType = nullptr;
+
+	// The value new instances start with, nullptr to start from the zeroed value.
+	TSharedPtr<void> DefaultValue;
+
+	int32 Stride = 0;
+	TArray<uint8, TAlignedHeapAllocator<16>> Data;
+
+	int32 Num() const { return Stride > 0 ? Data.Num() / Stride : 0; }
+
+	void* GetValuePtr(int32 Instance) { return Data.GetData() + Instance * Stride; }
+	const void* GetValuePtr(int32 Instance) const { return Data.GetData() + Instance * Stride; }
+
+	// Returns the column as an array of T, or nullptr if T does not have the size of the pin type.
+	template <typename T>
+	T* GetData() { return Stride == sizeof(T) ? reinterpret_cast<T*>(Data.GetData()) : nullptr; }
+
+	void SetNum(int32 NewNum);
+
+	// Removes an instance, the last instance takes its index.
+	void RemoveAtSwap(int32 Instance);
+
+	// Reports the objects referenced by the values and the default value to the garbage collector.
+	void AddReferencedObjects(FReferenceCollector& Collector) const;
+
+private:
+	void InitializeValue(void* Value) const;
+	void DestroyValue(void* Value) const;
+
+	// Whether the values can reference objects, only those columns are walked by AddReferencedObjects.
+	bool bHasObjectReferences = false;
+};
+
+/**
+ * A node of a batched graph, with its pins resolved to columns and its execution pins to node indices.
+ */
+struct FOpenLogicBatchNode
+{
+	FGuid NodeID;
+
+	// The single task instance running every instance of this node.
+	UOpenLogicTask* Task = nullptr;
+
+	bool bIsEvent = false;
+
+	// Pin index to column index, INDEX_NONE for pins that are not data pins.
+	TArray<int32> InputColumns;
+	TArray<int32> OutputColumns;
+
+	// Output pin index to the index of the node it executes, and the input pin it enters through.
+	TArray<int32> FlowTargets;
+	TArray<FName> FlowTargetPins;
+
+	// Nodes without execution pins feeding the inputs, evaluated before this node runs.
+	TArray<int32> DataDependencies;
+
+	// The first output execution pin, which events that do not support batched execution forward to.
+	int32 EntryPin = INDEX_NONE;
+};
+
+/**
+ * Passed to UOpenLogicTask::OnTaskActivatedBatch with the instances a node is activated for.
+ */
+struct OPENLOGICV2_API FOpenLogicBatchContext
+{
+	FOpenLogicBatchContext(UOpenLogicBatchedGraph* InGraph, int32 InNodeIndex, TConstArrayView<int32> InInstances, FName InPinName)
+		: Graph(InGraph), NodeIndex(InNodeIndex), Instances(InInstances), PinName(InPinName)
+	{
+	}
+
+	// The instances this activation runs for, in ascending order.
+	TConstArrayView<int32> GetInstances() const { return Instances; }
+
+	// The input pin the node was entered through, None for events and nodes without execution pins.
+	FName GetPinName() const { return PinName; }
+
+	// The total number of instances of the graph, which is the length of every column.
+	int32 GetInstanceCount() const;
+
+	// Whether this activation runs for every instance, so columns can be processed linearly.
+	bool IsFullBatch() const { return Instances.Num() == GetInstanceCount(); }
+
+	// Returns the values of an input pin indexed by instance, or nullptr if T does not match the pin type.
+	template <typename T>
+	const T* GetInputColumn(int32 PinIndex) const;
+
+	// Returns the values of an output pin indexed by instance, or nullptr if T does not match the pin type.
+	template <typename T>
+	T* GetOutputColumn(int32 PinIndex) const;
+
+	// Returns the context object of an instance.
+	UObject* GetContext(int32 Instance) const;
+
+	// Executes an output pin for every instance of this activation.
+	void ExecutePin(int32 PinIndex) const;
+
+	// Executes an output pin for some of the instances of this activation.
+	void ExecutePin(int32 PinIndex, TConstArrayView<int32> InInstances) const;
+
+private:
+	UOpenLogicBatchedGraph* Graph = nullptr;
+	int32 NodeIndex = INDEX_NONE;
+	TConstArrayView<int32> Instances;
+	FName PinName;
+};
+
+/**
+ * Runs one graph for many instances at once (crowds, projectiles...). Each data pin stores the values of every
+ * instance in a single column, and each node runs all the instances it is activated for in one call to
+ * OnTaskActivatedBatch. Every task of the graph, except events, has to support batched execution.
+ */
+UCLASS(BlueprintType)
+class OPENLOGICV2_API UOpenLogicBatchedGraph : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Compiles the graph data into nodes and columns. Existing instances are kept and their values reset.
+	 * @param NewData The graph data to run.
+	 * @return True if every node of the graph supports batched execution.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Batched Graph")
+	bool SetGraphData(const FOpenLogicGraphData& NewData);
+
+	/**
+	 * Returns whether the graph data was compiled successfully.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Batched Graph")
+	bool IsCompiled() const { return bCompiled; }
+
+	/**
+	 * Adds an instance, with every pin set to its default value.
+	 * @param Context The context object of the instance.
+	 * @return The index of the new instance.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Batched Graph")
+	int32 AddInstance(UObject* Context);
+
+	/**
+	 * Removes an instance. The last instance takes its index.
+	 * @param Instance The index of the instance to remove.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Batched Graph")
+	void RemoveInstance(int32 Instance);
+
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Batched Graph")
+	int32 GetInstanceCount() const { return InstanceContexts.Num(); }
+
+	/**
+	 * Returns the context object of an instance.
+	 * @param Instance The index of the instance.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Batched Graph")
+	UObject* GetInstanceContext(int32 Instance) const;
+
+	/**
+	 * Triggers every implementation of an event for all instances.
+	 * @param EventClass The class of the event, implementations of its subclasses are triggered too.
+	 * @return True if the graph implements the event.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Batched Graph")
+	bool TriggerEvent(TSubclassOf<UOpenLogicTask> EventClass);
+
+	/**
+	 * Triggers every implementation of an event for some of the instances.
+	 * @param EventClass The class of the event, implementations of its subclasses are triggered too.
+	 * @param Instances The instances to trigger the event for.
+	 * @return True if the graph implements the event.
+	 */
+	bool TriggerEventForInstances(const UClass* EventClass, TConstArrayView<int32> Instances);
+
+	/**
+	 * Returns the column holding the values of a data pin, so per-instance state can be read or written.
+	 * Connected inputs share the column of the output they are connected to.
+	 * @param NodeID The node of the pin.
+	 * @param PinIndex The index of the pin.
+	 * @param bIsInput Whether the pin is an input pin.
+	 */
+	FOpenLogicBatchColumn* FindPinColumn(const FGuid& NodeID, int32 PinIndex, bool bIsInput);
+
+public:
+	// Used by FOpenLogicBatchContext.
+	FOpenLogicBatchColumn* GetNodeColumn(int32 NodeIndex, int32 PinIndex, bool bIsInput);
+	void ExecutePin(int32 NodeIndex, int32 PinIndex, TConstArrayView<int32> Instances);
+
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+	//~ End UObject Interface
+
+private:
+	/**
+	 * Runs a node for the specified instances, after the data nodes feeding its inputs.
+	 */
+	void ActivateNode(int32 NodeIndex, TConstArrayView<int32> Instances, FName PinName);
+
+	/**
+	 * Adds the column of a data pin, or returns INDEX_NONE if its type has no Value property.
+	 */
+	int32 AddColumn(const FOpenLogicPinData& PinData, const TSharedPtr<void>& DefaultValue);
+
+	void ResetColumns();
+
+	UPROPERTY()
+	FOpenLogicGraphData GraphData;
+
+	UPROPERTY()
+	TArray<UOpenLogicTask*> TaskInstances;
+
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UObject>> InstanceContexts;
+
+	TArray<FOpenLogicBatchNode> Nodes;
+	TMap<FGuid, int32> NodeIndices;
+
+	TArray<TUniquePtr<FOpenLogicBatchColumn>> Columns;
+
+	// Event class (and each of its parent classes) to the indices of the nodes implementing it
+	TMap<TObjectKey<UClass>, TArray<int32>> EventNodes;
+
+	// 0 to GetInstanceCount() - 1, passed to full batch activations
+	TArray<int32> AllInstances;
+
+	bool bCompiled = false;
+
+	// Instances cannot be added or removed while nodes run
+	int32 ExecutionDepth = 0;
+};
+
+template <typename T>
+const T* FOpenLogicBatchContext::GetInputColumn(int32 PinIndex) const
+{
+	FOpenLogicBatchColumn* Column = Graph->GetNodeColumn(NodeIndex, PinIndex, true);
+	return Column ? Column->GetData<T>() : nullptr;
+}
+
+template <typename T>
+T* FOpenLogicBatchContext::GetOutputColumn(int32 PinIndex) const
+{
+	FOpenLogicBatchColumn* Column = Graph->GetNodeColumn(NodeIndex, PinIndex, false);
+	return Column ? Column->GetData<T>() : nullptr;
+}
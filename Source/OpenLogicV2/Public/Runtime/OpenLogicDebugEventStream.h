@@ -0,0 +1,37 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include <atomic>
+
+/**
+ * A fixed size ring buffer of node debug events, filled from the execution thread and drained once per frame.
+ * When it is full the oldest events are overwritten and counted as dropped, so a busy graph costs the same to debug
+ * no matter how many nodes it runs per frame.
+ */
+class OPENLOGICV2_API FOpenLogicDebugEventStream
+{
+public:
+	explicit FOpenLogicDebugEventStream(int32 InCapacity);
+
+	void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+	void Push(EOpenLogicNodeDebugEventType Type, const FGuid& NodeID, int32 HandleIndex, UOpenLogicTask* Task);
+
+	// Moves the buffered events into OutEvents, oldest first, and returns how many were dropped since the last drain.
+	int32 Drain(TArray<FOpenLogicNodeDebugEvent>& OutEvents);
+
+private:
+	std::atomic<bool> bEnabled{false};
+
+	FCriticalSection Lock;
+	TArray<FOpenLogicNodeDebugEvent> Events;
+
+	// Index of the oldest event
+	int32 Head = 0;
+	int32 Count = 0;
+	int32 DroppedCount = 0;
+};
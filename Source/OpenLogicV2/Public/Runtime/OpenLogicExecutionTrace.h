@@ -0,0 +1,151 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include <atomic>
+
+// Forward declarations
+class UOpenLogicRuntimeGraph;
+class UOpenLogicTask;
+class UOpenLogicProperty;
+
+enum class EOpenLogicTraceRecordType : uint8
+{
+	// An execution handle was created for an event node
+	CreateHandle,
+	// An execution handle started running
+	ProcessHandle,
+	// An execution handle was destroyed
+	DestroyHandle,
+	// A recorded task was activated, its inline records follow
+	Activate,
+	// A recorded task wrote one of its output pins
+	SetOutput,
+	// A recorded task executed one of its output pins
+	Then,
+	// A recorded task completed
+	Complete
+};
+
+struct OPENLOGICV2_API FOpenLogicTraceRecord
+{
+	EOpenLogicTraceRecordType Type = EOpenLogicTraceRecordType::CreateHandle;
+
+	// Whether this happened during the activation of its task rather than later on (a latent completion).
+	bool bInline = false;
+
+	int32 HandleIndex = INDEX_NONE;
+
+	// Index of the node in FOpenLogicExecutionTrace::NodeTable.
+	int32 NodeIndex = INDEX_NONE;
+
+	int32 PinIndex = INDEX_NONE;
+
+	// Seconds since the recording started.
+	double Timestamp = 0.0;
+
+	// The serialized output value for SetOutput records.
+	TArray<uint8> Value;
+
+	friend FArchive& operator<<(FArchive& Ar, FOpenLogicTraceRecord& Record);
+};
+
+/**
+ * Everything that came into a runtime graph from the outside while it was recorded: event triggers, event payloads,
+ * the outputs of non-deterministic tasks and when latent tasks completed. The graph data is embedded so a trace can be
+ * replayed headless, without the original asset or game state.
+ *
+ * Tasks whose effects are recorded instead of executed on replay are events, latent tasks (bIsLatent) and
+ * non-deterministic tasks (bIsNonDeterministic). Everything else is re-executed.
+ */
+struct OPENLOGICV2_API FOpenLogicExecutionTrace
+{
+	FOpenLogicGraphData GraphData;
+
+	TArray<FGuid> NodeTable;
+
+	TArray<FOpenLogicTraceRecord> Records;
+
+	// Seconds between the start and the end of the recording.
+	double Duration = 0.0;
+
+	void Serialize(FArchive& Ar);
+
+	bool SaveToFile(const FString& FilePath);
+	bool LoadFromFile(const FString& FilePath);
+
+	// Saved/OpenLogic/Traces/<GraphName>_<timestamp>.oltrace
+	static FString GetDefaultFilePath(const FString& GraphName);
+
+	// Returns whether the effects of this task are recorded rather than executed again on replay.
+	static bool IsRecordedTask(const UOpenLogicTask* TaskInstance);
+};
+
+/**
+ * Collects the trace records of a single runtime graph.
+ */
+class OPENLOGICV2_API FOpenLogicExecutionRecorder
+{
+public:
+	void Start(const FOpenLogicGraphData& GraphData);
+	FOpenLogicExecutionTrace Stop();
+
+	bool IsRecording() const { return bRecording.load(std::memory_order_relaxed); }
+
+public:
+	void RecordHandle(EOpenLogicTraceRecordType Type, int32 HandleIndex, const FGuid& NodeID = FGuid());
+
+	void RecordActivationBegin(int32 HandleIndex, const FGuid& NodeID);
+	void RecordActivationEnd(int32 HandleIndex, const FGuid& NodeID);
+
+	void RecordOutput(int32 HandleIndex, const FGuid& NodeID, int32 PinIndex, const UOpenLogicProperty* Property, const TSharedPtr<void>& Value);
+	void RecordThen(int32 HandleIndex, const FGuid& NodeID, int32 PinIndex);
+	void RecordComplete(int32 HandleIndex, const FGuid& NodeID);
+
+private:
+	void AddRecord(FOpenLogicTraceRecord& Record, const FGuid& NodeID);
+
+	std::atomic<bool> bRecording{false};
+
+	FCriticalSection Lock;
+	FOpenLogicExecutionTrace Trace;
+	TMap<FGuid, int32> NodeIndices;
+
+	// The recorded tasks currently inside their activation, innermost last
+	TArray<TPair<int32, FGuid>> ActivationStack;
+
+	double StartTime = 0.0;
+};
+
+/**
+ * Re-executes a trace on a runtime graph. Top-level records (triggers, latent completions) are applied in order, and
+ * the graph calls ReplayActivation in place of OnTaskActivated for recorded tasks to apply their inline records.
+ */
+class OPENLOGICV2_API FOpenLogicExecutionReplayer
+{
+public:
+	FOpenLogicExecutionReplayer(UOpenLogicRuntimeGraph* InGraph, const FOpenLogicExecutionTrace& InTrace);
+
+	// Applies every record. Returns false if the graph did not follow the recorded execution.
+	bool Run();
+
+	void ReplayActivation(UOpenLogicTask* TaskInstance, int32 HandleIndex);
+
+	int32 GetDivergenceCount() const { return DivergenceCount; }
+
+private:
+	void ApplyRecord(const FOpenLogicTraceRecord& Record);
+	UOpenLogicTask* FindTaskInstance(const FOpenLogicTraceRecord& Record) const;
+	FGuid GetNodeID(const FOpenLogicTraceRecord& Record) const;
+
+	UOpenLogicRuntimeGraph* Graph = nullptr;
+	const FOpenLogicExecutionTrace& Trace;
+	int32 Cursor = 0;
+
+	// Recorded handle index to the handle index created by the replay
+	TMap<int32, int32> HandleIndices;
+
+	int32 DivergenceCount = 0;
+};
@@ -5,11 +5,16 @@
 #include "CoreMinimal.h"
 #include "OpenLogicRuntimeGraph.h"
 
+/**
+ * Runs the execution handles of a runtime graph on a background thread. Handles wait in one queue per priority, the
+ * highest priority runs first and waiting handles gain a priority level every PriorityAgingSeconds.
+ */
 class OPENLOGICV2_API FOpenLogicGraphRunnable : public FRunnable
 {
 public:
-	FOpenLogicGraphRunnable(UOpenLogicRuntimeGraph* InGraph)
+	FOpenLogicGraphRunnable(UOpenLogicRuntimeGraph* InGraph, float InPriorityAgingSeconds = 0.0f)
 		: Graph(InGraph)
+		, PriorityAgingSeconds(InPriorityAgingSeconds)
 	{
 		QueueEvent = FPlatformProcess::GetSynchEventFromPool(true);
 	}
@@ -33,13 +38,28 @@ public:
 	void AddExecutionHandle(const FOpenLogicQueuedExecutionHandle& QueueData);
 	bool IsRunning() const { return !bStopThread; }
 
+	// Returns the depth and wait times of the queue of each priority.
+	void GetQueueMetrics(TArray<FOpenLogicPriorityQueueMetrics>& OutMetrics) const;
+
+	// Held by the thread while it runs a handle. Holding it from another thread pauses the queue between two handles,
+	// so the nodes and graph data the thread reads can be changed.
+	FCriticalSection& GetProcessLock() { return ProcessLock; }
+
 private:
 	void ProcessQueue();
+
+	// Takes the handle to run next, the one whose priority once aged is the highest.
+	bool DequeueNext(FOpenLogicQueuedExecutionHandle& OutQueueData);
+
+	bool AreQueuesEmpty() const;
 	
 private:
 	FThreadSafeBool bStopThread;
-	TQueue<FOpenLogicQueuedExecutionHandle, EQueueMode::Mpsc> Queue;
+	TQueue<FOpenLogicQueuedExecutionHandle, EQueueMode::Mpsc> Queues[OpenLogicExecutionPriorityCount];
+	FOpenLogicPriorityQueueCounters QueueCounters[OpenLogicExecutionPriorityCount];
 	FCriticalSection QueueLock;
+	FCriticalSection ProcessLock;
 	FEvent* QueueEvent;
 	UOpenLogicRuntimeGraph* Graph;
+	double PriorityAgingSeconds;
 };
@@ -0,0 +1,126 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include "Tasks/OpenLogicProperty.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "OpenLogicReplicatedState.generated.h"
+
+class UOpenLogicRuntimeGraphComponent;
+
+/**
+ * The value of an output data pin as sent to clients. Numbers are quantized, bools take a single bit and the other
+ * types are sent as exported text.
+ */
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicReplicatedPinValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	int32 PinIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	EOpenLogicUnderlyingType Type = EOpenLogicUnderlyingType::Wildcard;
+
+	// Boolean, byte, int, enum, float and double values.
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	double Number = 0.0;
+
+	// Object and class values.
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	TObjectPtr<UObject> Object = nullptr;
+
+	// Everything else, exported as text.
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	FString Text;
+
+	// Floats and doubles are sent as multiples of this step when they fit in 32 bits, and as full doubles otherwise.
+	static constexpr double QuantizationStep = 0.01;
+
+	static FOpenLogicReplicatedPinValue FromValue(int32 InPinIndex, const UOpenLogicProperty* Property, const void* Value);
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FOpenLogicReplicatedPinValue& Other) const
+	{
+		return PinIndex == Other.PinIndex && Type == Other.Type && Number == Other.Number && Object == Other.Object && Text == Other.Text;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FOpenLogicReplicatedPinValue> : public TStructOpsTypeTraitsBase2<FOpenLogicReplicatedPinValue>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+/**
+ * The last known state of a node and of its output data pins.
+ */
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicReplicatedNodeState : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	FGuid NodeID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	EOpenLogicTaskState TaskState = EOpenLogicTaskState::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Replication")
+	TArray<FOpenLogicReplicatedPinValue> PinValues;
+
+	void PostReplicatedAdd(const struct FOpenLogicReplicatedGraphState& InArraySerializer);
+	void PostReplicatedChange(const struct FOpenLogicReplicatedGraphState& InArraySerializer);
+};
+
+/**
+ * Replicates the node states of a runtime graph with fast array serialization, so each connection only receives the
+ * nodes that changed since the last state it acknowledged.
+ */
+USTRUCT()
+struct OPENLOGICV2_API FOpenLogicReplicatedGraphState : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FOpenLogicReplicatedNodeState> Nodes;
+
+	// The component notified when nodes are received, on clients.
+	UOpenLogicRuntimeGraphComponent* Owner = nullptr;
+
+	/**
+	 * Updates the state of a node, and marks it dirty only if it changed.
+	 * @return True if the node changed.
+	 */
+	bool SetNodeState(const FGuid& NodeID, EOpenLogicTaskState TaskState, TArray<FOpenLogicReplicatedPinValue>&& PinValues);
+
+	const FOpenLogicReplicatedNodeState* FindNodeState(const FGuid& NodeID) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FOpenLogicReplicatedNodeState, FOpenLogicReplicatedGraphState>(Nodes, DeltaParms, *this);
+	}
+
+private:
+	friend struct FOpenLogicReplicatedNodeState;
+
+	// Node to its index in Nodes, nodes are never removed. Filled by the replication callbacks on clients.
+	mutable TMap<FGuid, int32> NodeIndices;
+};
+
+template<>
+struct TStructOpsTypeTraits<FOpenLogicReplicatedGraphState> : public TStructOpsTypeTraitsBase2<FOpenLogicReplicatedGraphState>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
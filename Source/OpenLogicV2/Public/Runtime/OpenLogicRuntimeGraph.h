@@ -4,16 +4,26 @@
 
 #include "CoreMinimal.h"
 #include "Core/OpenLogicTypes.h"
+#include "Runtime/OpenLogicExecutionTrace.h"
+#include "Containers/Ticker.h"
 #include "OpenLogicRuntimeGraph.generated.h"
 
 // Forward declarations
 class UOpenLogicRuntimeEventContext;
 class FOpenLogicGraphRunnable;
 class UOpenLogicTask;
+class FOpenLogicDebugEventStream;
+class UOpenLogicRuntimeSubsystem;
+class UOpenLogicGraph;
 
 // Delegate declarations
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRuntimeWorkerNodeActivated, UOpenLogicTask*, NewActivatedNode);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRuntimeWorkerNodeCompleted, UOpenLogicTask*, NewCompletedNode);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRuntimeWorkerDebugEvents, const TArray<FOpenLogicNodeDebugEvent>&, Events, int32, DroppedCount);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRuntimeNodeActivatedNative, UOpenLogicTask*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRuntimeNodeCompletedNative, UOpenLogicTask*);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnRuntimeDebugEventsNative, TConstArrayView<FOpenLogicNodeDebugEvent>, int32);
 
 UCLASS(Blueprintable)
 class OPENLOGICV2_API UOpenLogicRuntimeGraph : public UObject
@@ -37,6 +47,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Graph")
 	void SetGraphData(FOpenLogicGraphData NewData);
 
+	/**
+	 * Applies new graph data without dropping the execution handles in flight, for live editing.
+	 * Removed nodes and nodes whose task class changed are cancelled, and handles whose entry node was removed are
+	 * destroyed. Other nodes keep running with their state and persistent tasks keep theirs. They pick up new
+	 * connections and default values the next time they execute a pin or read an input. Nodes that are not running
+	 * and whose data changed are evaluated again. Must be called on the game thread, the graph thread is paused between
+	 * two handles while the patch is applied.
+	 * @param NewData The new graph data.
+	 * @return What the patch changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Graph")
+	FOpenLogicGraphPatchResult ApplyGraphDataPatch(const FOpenLogicGraphData& NewData);
+
+	/**
+	 * Sets the graph asset this runtime graph was created from, so edits to it can be patched in.
+	 * @param Graph The graph asset.
+	 */
+	void SetSourceGraph(UOpenLogicGraph* Graph) { SourceGraph = Graph; }
+
+	/**
+	 * Returns the graph asset this runtime graph was created from, if any.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Graph")
+	UOpenLogicGraph* GetSourceGraph() const { return SourceGraph.Get(); }
+
 	/**
 	 * Returns the graph data for the runtime graph.
 	 * @return The graph data.
@@ -52,6 +87,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Graph")
 	FOpenLogicNode GetNodeData(FGuid NodeID) const;
 
+	/**
+	 * Returns the data of the specified node without copying it.
+	 * @param NodeID The ID of the node.
+	 * @return The node data, or nullptr if the node does not exist.
+	 */
+	const FOpenLogicNode* FindNodeData(const FGuid& NodeID) const { return WorkerGraphData.Nodes.Find(NodeID); }
+
+	/**
+	 * Returns the entry nodes triggered by the specified event class, including the ones implementing a subclass of it.
+	 * @param EventClass The class of the event.
+	 * @return The entry nodes, or nullptr if this graph does not implement the event.
+	 */
+	const TArray<FGuid>* FindEventImplementations(const UClass* EventClass) const;
+
+	/**
+	 * Returns the event dispatch index, built when the graph data is set.
+	 * Every implemented event class and each of its parent classes maps to the entry nodes it triggers.
+	 */
+	const TMap<TObjectKey<UClass>, TArray<FGuid>>& GetEventDispatchIndex() const { return EventDispatchIndex; }
+
+	/**
+	 * Sets the world subsystem this graph is registered to, so it is kept up to date when the graph data changes.
+	 * @param Subsystem The subsystem, or nullptr to clear it.
+	 */
+	void SetDispatchSubsystem(UOpenLogicRuntimeSubsystem* Subsystem);
+
+	/**
+	 * Returns the world subsystem this graph is registered to, if any.
+	 */
+	UOpenLogicRuntimeSubsystem* GetDispatchSubsystem() const { return DispatchSubsystem.Get(); }
+
 	/**
 	 * Sets the thread type of the runtime graph. This should be called before the worker is created.
 	 * @param NewThreadSettings	The new thread settings to set.
@@ -98,32 +164,54 @@ public:
 	 */
 	UFUNCTION()
 	void CleanupThread();
+
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
 	
 	/**
 	 * This function triggers the first found event implementation of the specified Task class
 	 * @param TaskClass The class of the task to trigger.
 	 * @param AutoProcess If true, the event will be processed automatically.
 	 * @param OutExecutionHandle The execution handle for the triggered event.
+	 * @param Priority The order the event runs in when it waits in the background thread queue.
 	 * @return True if the event was triggered successfully, false otherwise.
 	 */
 	UFUNCTION(BlueprintCallable, Category = OpenLogic)
-		bool TriggerEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess, FOpenLogicGraphExecutionHandle& OutExecutionHandle);
+		bool TriggerEvent(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess, FOpenLogicGraphExecutionHandle& OutExecutionHandle, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
 
 	/**
 	 * This function triggers all event implementations of the specified Task class
 	 * @param TaskClass The class of the task to trigger.
 	 * @param AutoProcess If true, the events will be processed automatically.
+	 * @param Priority The order the events run in when they wait in the background thread queue.
 	 * @return An array of execution handles for the triggered events.
 	 */
 	UFUNCTION(BlueprintCallable, Category = OpenLogic)
-		TArray<FOpenLogicGraphExecutionHandle> TriggerAllEvents(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess = true);
+		TArray<FOpenLogicGraphExecutionHandle> TriggerAllEvents(TSubclassOf<UOpenLogicTask> TaskClass, bool AutoProcess = true, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
+
+	/**
+	 * Creates an execution handle for every event implementation of the specified class, without processing them.
+	 * @param EventClass The class of the event.
+	 * @param OutExecutionHandles The array the created execution handles are appended to.
+	 * @param Priority The priority of the created execution handles.
+	 * @return The number of execution handles created.
+	 */
+	int32 CreateEventExecutionHandles(const UClass* EventClass, TArray<TSharedPtr<FOpenLogicGraphExecutionHandle>>& OutExecutionHandles, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
+
+	/**
+	 * Processes execution handles that were created but not processed yet.
+	 * @param ExecutionHandles The execution handles to process.
+	 */
+	void ProcessExecutionHandles(TArrayView<TSharedPtr<FOpenLogicGraphExecutionHandle>> ExecutionHandles);
 
 	/**
 	 * Creates a new execution handle for the specified node ID.
 	 * @param NodeID The ID of the node to create an execution handle for.
+	 * @param Priority The order the handle runs in when it waits in the background thread queue.
 	 * @return A shared pointer to the created execution handle.
 	 */
-	TSharedPtr<FOpenLogicGraphExecutionHandle> CreateExecutionHandle(FGuid NodeID);
+	TSharedPtr<FOpenLogicGraphExecutionHandle> CreateExecutionHandle(FGuid NodeID, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
 
 	/**
 	 * Retrieves the execution handle at the specified index.
@@ -140,6 +228,38 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = OpenLogic, meta = (DisplayName = "Destroy Execution Handle"))
 	void BP_DestroyExecutionHandle(FOpenLogicGraphExecutionHandle ExecutionHandle);
+
+	/**
+	 * Cancels the specified execution handle: its cancellation token is set, the tasks waiting on a latent completion
+	 * are notified through OnTaskCancelled, then the handle is destroyed and its tasks are returned to their pools.
+	 * @param ExecutionHandle The execution handle to cancel.
+	 * @param Reason The reason passed to the tasks.
+	 * @return True if the handle was cancelled, false if it was invalid or already cancelled.
+	 */
+	bool CancelExecutionHandle(TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, EOpenLogicCancellationReason Reason = EOpenLogicCancellationReason::Requested);
+
+	UFUNCTION(BlueprintCallable, Category = OpenLogic, meta = (DisplayName = "Cancel Execution Handle"))
+	bool BP_CancelExecutionHandle(FOpenLogicGraphExecutionHandle ExecutionHandle);
+
+	/**
+	 * Cancels the specified execution handle if it is still running after a number of seconds.
+	 * @param ExecutionHandle The execution handle to time out.
+	 * @param TimeoutSeconds The time the handle has from now on, 0 removes its timeout.
+	 */
+	void SetExecutionHandleTimeout(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, float TimeoutSeconds);
+
+	UFUNCTION(BlueprintCallable, Category = OpenLogic, meta = (DisplayName = "Set Execution Handle Timeout"))
+	void BP_SetExecutionHandleTimeout(FOpenLogicGraphExecutionHandle ExecutionHandle, float TimeoutSeconds);
+
+	/**
+	 * Overrides the timeout of the task of a node (see UOpenLogicTask::TimeoutSeconds) for this graph. Applies to the
+	 * next activations of the node.
+	 * @param NodeID The node to set the timeout of.
+	 * @param TimeoutSeconds The time the node can wait on a latent completion, 0 disables it and a negative value goes
+	 * back to the timeout of the task.
+	 */
+	UFUNCTION(BlueprintCallable, Category = OpenLogic)
+	void SetNodeTimeout(FGuid NodeID, float TimeoutSeconds);
 	
 	/**
 	 * Retrieves all execution handles.
@@ -194,24 +314,66 @@ public:
 	/**
 	 * Sets the value of the specified data property.
 	 * @param TaskInstance The task instance to set the property for.
-	 * @param PinName The name of the pin to set the property for.
+	 * @param Pin The pin to set the property for.
 	 * @param Value The value to set.
 	 */
-	void SetDataPropertyValue(UOpenLogicTask* TaskInstance, FName PinName, const TSharedPtr<void>& Value) const;
+	void SetDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const TSharedPtr<void>& Value) const;
 
-	void SetDataPropertyValueByAddress(UOpenLogicTask* TaskInstance, FName PinName, FProperty* Property, void* SourceAddress) const;
+	void SetDataPropertyValueByAddress(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, FProperty* Property, void* SourceAddress) const;
+
+	/**
+	 * Writes an output data pin in place, into the storage preallocated for it when the node was created.
+	 * Values are copy-on-write: if inputs or traces still hold the previous value, a new value is written instead.
+	 * @param TaskInstance The task instance writing the pin.
+	 * @param Pin The output pin.
+	 * @param Writer Copies the value to the destination, returns false if it cannot write a value of that pin type.
+	 * @return True if the value was written, false if the pin has no slot and the caller has to allocate the value.
+	 */
+	bool WriteOutputSlot(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const;
 
 	/**
 	 * Retrieves the value of the specified data property.
 	 * @param TaskInstance The task instance to retrieve the property for.
-	 * @param PinName The name of the pin to retrieve the property for.
+	 * @param Pin The pin to retrieve the property for.
+	 * @param ExpectedPropertyClass If set, the property class the pin must have for its value to be returned.
 	 * @return A shared pointer to the value of the property.
 	 */
-	TSharedPtr<void> GetDataPropertyValue(UOpenLogicTask* TaskInstance, FName PinName);
+	TSharedPtr<void> GetDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const UClass* ExpectedPropertyClass = nullptr);
+
+	/**
+	 * Retrieves the value of an input data pin to modify it. Input values are shared with the output they come from,
+	 * so the value is copied the first time it is modified while shared.
+	 * @param TaskInstance The task instance to retrieve the property for.
+	 * @param Pin The input pin.
+	 * @param ExpectedPropertyClass If set, the property class the pin must have for its value to be returned.
+	 * @return The value, valid until the node is activated again. nullptr if the pin has no value or it cannot be copied.
+	 */
+	void* GetMutableDataPropertyValue(UOpenLogicTask* TaskInstance, const FOpenLogicPinHandle& Pin, const UClass* ExpectedPropertyClass = nullptr);
+
+	/**
+	 * Resolves a pin handle to the index of a pin of a node. Baked handles are used as is when the pin schema of the
+	 * task still matches, other handles are looked up by name.
+	 * @param TaskInstance The task instance of the node.
+	 * @param NodeData The data of the node.
+	 * @param Pin The pin handle.
+	 * @param bIsInput Whether the pin is an input pin.
+	 * @return The index of the pin, or INDEX_NONE if the node has no such pin.
+	 */
+	int32 ResolvePinIndex(const UOpenLogicTask* TaskInstance, const FOpenLogicNode& NodeData, const FOpenLogicPinHandle& Pin, bool bIsInput) const;
+
+	// Whether an input pin of a node has ExpectedPropertyClass, ensures if it does not.
+	bool CheckInputPinClass(const FOpenLogicNode& NodeData, int32 PinIndex, const UClass* ExpectedPropertyClass) const;
 
 	void PreloadInputPropertiesForNode(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle);
 	TSharedPtr<void> ResolveConnectedPinValue(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, const FOpenLogicPinConnection& Connection);
-	TSharedPtr<void> CreatePropertyValueFromDefault(const FOpenLogicDefaultValue& DefaultValue, const UOpenLogicProperty* PropertyInstance);
+	static TSharedPtr<void> CreatePropertyValueFromDefault(const FOpenLogicDefaultValue& DefaultValue, const UOpenLogicProperty* PropertyInstance);
+
+	/**
+	 * Imports the property values set in the graph editor for a node into a task instance.
+	 * @param TaskInstance The task instance to import the values into.
+	 * @param NodeData The node data holding the values.
+	 */
+	static void ImportTaskProperties(UOpenLogicTask* TaskInstance, const FOpenLogicNode& NodeData);
 	
 	/**
 	 * Retrieves the default value of the specified data property.
@@ -241,6 +403,50 @@ public:
 	 */
 	TSharedPtr<FOpenLogicRuntimeNode> ProcessNodeByGUID(FGuid NodeID, TSharedPtr<FOpenLogicGraphExecutionHandle> ExecutionHandle);
 
+	/**
+	 * Walks the execution handles, task pools and graph data of this runtime graph and reports the memory they use.
+	 * @return The memory footprint, by category.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Memory")
+	FOpenLogicMemoryFootprint GetMemoryFootprint() const;
+
+	/**
+	 * Returns the number of task instances this graph keeps alive, pooled or persistent. The garbage collector goes
+	 * through each of them on every pass.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Memory")
+	int32 GetGCObjectCount() const;
+
+	/**
+	 * Returns the depth and wait times of the background thread queue, one entry per priority. The entries are zero
+	 * when the graph runs on the game thread.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Thread")
+	TArray<FOpenLogicPriorityQueueMetrics> GetQueueMetrics() const;
+
+	/**
+	 * Leaves the unused pooled task instances above a number per task class to the garbage collector, e.g. once a
+	 * burst of activity is over. Must be called on the game thread.
+	 * @param MaxAvailableTasks The number of unused instances to keep for each task class.
+	 * @return The number of task instances released.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Memory")
+	int32 TrimTaskPools(int32 MaxAvailableTasks = 0);
+
+	/**
+	 * The number of unused instances kept in the pool of each task class. Instances completing above it are left to
+	 * the garbage collector instead of growing the pool. 0 keeps every instance.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Memory")
+	int32 MaxAvailableTasksPerClass = 0;
+
+	/**
+	 * The timeout given to every execution handle created by this graph, in seconds. Handles still running after it
+	 * are cancelled. 0 disables it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Runtime", meta = (ClampMin = "0", Units = "s"))
+	float ExecutionHandleTimeoutSeconds = 0.0f;
+
 	/**
 	 * Dispatcher triggered when a node is activated.
 	 */
@@ -253,13 +459,116 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "OpenLogic")
 	FRuntimeWorkerNodeCompleted OnNodeCompleted;
 
+	/**
+	 * Native versions of OnNodeActivated and OnNodeCompleted. Both are only broadcast when something is bound,
+	 * C++ listeners should prefer these to avoid the reflection cost of the dynamic delegates.
+	 */
+	FOnRuntimeNodeActivatedNative OnNodeActivatedNative;
+	FOnRuntimeNodeCompletedNative OnNodeCompletedNative;
+
+	/**
+	 * Broadcast once a task ran for an activation, when its output pins hold the values it just computed. Pure nodes
+	 * never complete, this is where their results can be read.
+	 */
+	FOnRuntimeNodeActivatedNative OnNodeActivationEndNative;
+
+	/**
+	 * Starts collecting node activations and completions in a ring buffer that is delivered once per frame
+	 * through OnDebugEvents, instead of one broadcast per node. Each call must be matched by DisableDebugEventStream.
+	 * @param Capacity The number of events kept between two deliveries, the oldest are dropped past it. Only the first call sets it.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Debug")
+	void EnableDebugEventStream(int32 Capacity = 4096);
+
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Debug")
+	void DisableDebugEventStream();
+
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Debug")
+	bool IsDebugEventStreamEnabled() const { return DebugEventStreamUsers > 0; }
+
+	/**
+	 * Dispatcher triggered once per frame with the node events collected since the last frame, while the debug event stream is enabled.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "OpenLogic|Debug")
+	FRuntimeWorkerDebugEvents OnDebugEvents;
+
+	FOnRuntimeDebugEventsNative OnDebugEventsNative;
+
+	/**
+	 * Starts recording everything that comes into this graph from the outside (event triggers and payloads,
+	 * outputs of non-deterministic tasks, latent completions) into an execution trace.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Trace")
+	void StartRecording();
+
+	/**
+	 * Stops recording and writes the execution trace to a file.
+	 * @param FilePath Where to write the trace. Saved/OpenLogic/Traces/<GraphName>_<timestamp>.oltrace if empty.
+	 * @return True if the trace was written.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Trace")
+	bool StopRecording(const FString& FilePath);
+
+	/**
+	 * Stops recording and returns the execution trace.
+	 * @param OutTrace The recorded trace.
+	 * @return True if the graph was recording.
+	 */
+	bool StopRecordingTrace(FOpenLogicExecutionTrace& OutTrace);
+
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Trace")
+	bool IsRecording() const;
+
+	/**
+	 * Replaces the graph data with the one of the trace and executes it again in the recorded order.
+	 * Always runs synchronously on the calling thread, whatever the thread settings.
+	 * @param Trace The trace to replay.
+	 * @return True if the execution followed the recording.
+	 */
+	bool ReplayTrace(const FOpenLogicExecutionTrace& Trace);
+
+	/**
+	 * Loads an execution trace from a file and replays it.
+	 * @param FilePath The trace file.
+	 * @return True if the trace was loaded and the execution followed the recording.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Trace")
+	bool ReplayTraceFromFile(const FString& FilePath);
+
+	bool IsReplaying() const { return Replayer != nullptr; }
+
+	/**
+	 * Writes the running state of the graph into a compact binary snapshot, for save games: the execution handles that
+	 * have not finished with their node states and output values, and the state of persistent and waiting tasks
+	 * (see UOpenLogicTask::SerializeTaskState). Nodes are stored as indices into the node table of the graph data.
+	 * Must be called on the game thread.
+	 * @param OutData The snapshot.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Save")
+	void SaveState(TArray<uint8>& OutData);
+
+	/**
+	 * Replaces the running state of the graph with a snapshot written by SaveState. Execution handles keep their
+	 * indices, and tasks that were waiting (delays...) resume where they stopped. Must be called on the game thread.
+	 * @param Data The snapshot.
+	 * @return False if the snapshot is invalid or was saved for different graph data.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Save")
+	bool LoadState(const TArray<uint8>& Data);
+
 protected:
 	UPROPERTY()
 	TMap<TSubclassOf<UOpenLogicTask>, FOpenLogicTaskPool> TaskPools;
 
+	// Tasks are taken from and returned to the pools on the execution thread, while the game thread trims them
+	mutable FCriticalSection TaskPoolLock;
+
 	UPROPERTY()
 	TMap<FGuid, UOpenLogicTask*> PersistentNodes;
 
+	// GetGCObjectCount for callers already holding TaskPoolLock.
+	int32 CountGCObjects() const;
+
 private:
 	/**
 	 * Retrieves the event implementations for the specified task class.
@@ -299,9 +608,115 @@ private:
 	 */
 	void ProcessExecutionHandle(TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle);
 
+	/**
+	 * Marks the execution handle as finished and records its latency once nothing is running or waiting on a latent completion.
+	 * @param ExecutionHandle The execution handle to check.
+	 */
+	void TryFinishExecutionHandle(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle);
+
+	/**
+	 * Rebuilds EventDispatchIndex from the events of the graph data.
+	 */
+	void BuildEventDispatchIndex();
+
+	/**
+	 * Rebuilds the node table snapshots refer to nodes by.
+	 */
+	void BuildSnapshotNodeTable();
+
+	/**
+	 * Runs the function table of a struct task node, and completes the node if it was entered through an execution pin.
+	 * @param RuntimeNode The runtime node of the struct task.
+	 * @param PinName The input execution pin the node was activated through.
+	 * @param bEnteredThroughExecution Whether the node is on the execution path, rather than evaluated for its outputs.
+	 */
+	void ActivateStructNode(FOpenLogicRuntimeNode& RuntimeNode, const FName& PinName, bool bEnteredThroughExecution);
+
+	/**
+	 * Completes a running struct task node. Struct task nodes keep their instance data until they are released.
+	 * @param RuntimeNode The runtime node of the struct task.
+	 */
+	void CompleteStructNode(FOpenLogicRuntimeNode& RuntimeNode);
+
+	/**
+	 * Runs the node connected to an output execution pin of a node.
+	 * @param ExecutionHandle The execution handle the node belongs to.
+	 * @param NodeID The node to transition from.
+	 * @param NextPinIndex The index of the output execution pin.
+	 * @return True if the transition was successful, false otherwise.
+	 */
+	bool ExecuteOutputPin(const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle, const FGuid& NodeID, int32 NextPinIndex);
+
+	/**
+	 * Cancels the task of a runtime node if it has not completed, and returns it to its pool unless it is persistent.
+	 * @param RuntimeNode The runtime node, left without task instance and values.
+	 */
+	void ReleaseRuntimeNode(FOpenLogicRuntimeNode& RuntimeNode);
+
+	/**
+	 * Cancels a node waiting on a latent completion without cancelling its execution handle: the task is notified
+	 * through OnTaskCancelled, then completed without executing its outputs.
+	 * @param RuntimeNode The runtime node to cancel.
+	 * @param Reason The reason passed to the task.
+	 */
+	void CancelRuntimeNode(FOpenLogicRuntimeNode& RuntimeNode, EOpenLogicCancellationReason Reason);
+
+	/**
+	 * Starts the timeout of a node that is now waiting on a latent completion, if its task or this graph gives it one.
+	 * @param ExecutionHandle The execution handle the node belongs to.
+	 * @param RuntimeNode The pending runtime node.
+	 */
+	void StartNodeTimeout(const FOpenLogicGraphExecutionHandle& ExecutionHandle, FOpenLogicRuntimeNode& RuntimeNode);
+
+	/**
+	 * Adds a deadline to the timeouts checked by TickTimeouts, and starts checking them. TimeoutLock must be held.
+	 */
+	void ScheduleTimeoutCheck(double Deadline);
+
+	/**
+	 * Lets go of a persistent task instance without returning it to its pool, so its state is not reused.
+	 * @param TaskInstance The persistent task instance.
+	 */
+	void ReleasePersistentTask(UOpenLogicTask* TaskInstance);
+
+	/**
+	 * Allocates the output slots of a runtime node, for the data pins whose type is known up front.
+	 * @param RuntimeNode The runtime node.
+	 * @param NodeData The data of the node.
+	 */
+	static void AllocateOutputSlots(FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData);
+
+	/**
+	 * Writes an output data pin of a runtime node in place. See WriteOutputSlot.
+	 * @param TaskInstance The task instance writing the pin, nullptr for struct tasks.
+	 */
+	bool WriteNodeOutputSlot(UOpenLogicTask* TaskInstance, FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData, int32 PinIndex, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const;
+
+	/**
+	 * Publishes a value written to an output pin, to its consumers, the execution trace and the profiler.
+	 * @param TaskInstance The task instance writing the pin, nullptr for struct tasks.
+	 */
+	void CommitOutputValue(UOpenLogicTask* TaskInstance, FOpenLogicRuntimeNode& RuntimeNode, const FOpenLogicNode& NodeData, int32 PinIndex, const TSharedPtr<void>& Value) const;
+
 	UPROPERTY()
 	FOpenLogicGraphData WorkerGraphData;
 
+	// Event class (and each of its parent classes) to the entry nodes it triggers
+	TMap<TObjectKey<UClass>, TArray<FGuid>> EventDispatchIndex;
+
+	// The world subsystem this graph is registered to for event dispatch
+	TWeakObjectPtr<UOpenLogicRuntimeSubsystem> DispatchSubsystem;
+
+	// The graph asset this runtime graph was created from
+	TWeakObjectPtr<UOpenLogicGraph> SourceGraph;
+
+	// The node IDs in a stable order, snapshots store indices into this table
+	TArray<FGuid> SnapshotNodeTable;
+	TMap<FGuid, int32> SnapshotNodeIndices;
+
+	// Snapshots of graph data with a different node table are rejected
+	uint32 SnapshotNodeTableHash = 0;
+
 	UPROPERTY()
 	int32 HandleCounter = 0;
 	
@@ -318,4 +733,49 @@ private:
 
 	// The thread that will execute the runnable in the background
 	FRunnableThread* RunnableThread = nullptr;
+
+	// Collects the execution trace while recording
+	TUniquePtr<FOpenLogicExecutionRecorder> Recorder;
+
+	// Set for the duration of ReplayTrace
+	FOpenLogicExecutionReplayer* Replayer = nullptr;
+
+	// Delivers the debug event stream once per frame
+	bool TickDebugEventStream(float DeltaTime);
+
+	void PushDebugEvent(EOpenLogicNodeDebugEventType Type, const FGuid& NodeID, int32 HandleIndex, UOpenLogicTask* TaskInstance);
+
+	// Kept once created so the execution thread never sees it go away
+	TSharedPtr<FOpenLogicDebugEventStream> DebugEventStream;
+
+	int32 DebugEventStreamUsers = 0;
+	FTSTicker::FDelegateHandle DebugEventTickerHandle;
+	TArray<FOpenLogicNodeDebugEvent> DrainedDebugEvents;
+
+	// Cancels the execution handles and nodes whose timeout has passed. Only ticks while there are timeouts.
+	bool TickTimeouts(float DeltaTime);
+
+	struct FNodeTimeout
+	{
+		int32 HandleIndex = INDEX_NONE;
+		FGuid NodeID;
+		double Deadline = 0.0;
+	};
+
+	// Deadlines of the execution handles with a timeout, by handle index
+	TMap<int32, double> HandleTimeouts;
+
+	// Deadlines of the pending nodes with a timeout. Entries of nodes that completed in time are dropped once they pass.
+	TArray<FNodeTimeout> NodeTimeouts;
+
+	// Per node timeouts set with SetNodeTimeout, used instead of the timeout of the task
+	TMap<FGuid, float> NodeTimeoutOverrides;
+
+	// Nodes can become pending on the execution thread
+	FCriticalSection TimeoutLock;
+	double NextTimeoutDeadline = TNumericLimits<double>::Max();
+	FTSTicker::FDelegateHandle TimeoutTickerHandle;
+
+	friend class FOpenLogicExecutionReplayer;
+	friend struct FOpenLogicStructTaskContext;
 };
\ No newline at end of file
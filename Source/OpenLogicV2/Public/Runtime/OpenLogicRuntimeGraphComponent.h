@@ -6,8 +6,11 @@
 #include "OpenLogicRuntimeGraph.h"
 #include "Classes/OpenLogicGraph.h"
 #include "Components/ActorComponent.h"
+#include "Runtime/OpenLogicReplicatedState.h"
 #include "OpenLogicRuntimeGraphComponent.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnReplicatedNodeStateChanged, FGuid, NodeID, EOpenLogicTaskState, TaskState);
+
 UCLASS( ClassGroup=(OpenLogic), meta=(BlueprintSpawnableComponent) )
 class OPENLOGICV2_API UOpenLogicRuntimeGraphComponent : public UActorComponent
 {
@@ -28,6 +31,8 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = OpenLogic, meta = (ExposeOnSpawn = true))
 		UOpenLogicGraph* GraphAsset;
@@ -38,6 +43,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Default Events", meta = (ExposeOnSpawn = true))
 		TSubclassOf<UOpenLogicTask> EndPlayEvent;
 
+	// Event bus channels the runtime graph is subscribed to when the game starts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Event Bus", meta = (ExposeOnSpawn = true))
+		TArray<FName> EventChannels;
+
+public:
+	// Replicates the state and output pin values of the nodes to clients. Only the nodes that changed are sent.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "OpenLogic|Replication")
+		bool bReplicateExecutionState = false;
+
+	// Seconds between two updates while a player is within FullRateDistance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Replication", meta = (EditCondition = "bReplicateExecutionState", ClampMin = "0.01"))
+		float ReplicationInterval = 0.1f;
+
+	// Seconds between two updates while every player is further than FullRateDistance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Replication", meta = (EditCondition = "bReplicateExecutionState", ClampMin = "0.01"))
+		float DistantReplicationInterval = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Replication", meta = (EditCondition = "bReplicateExecutionState", ClampMin = "0"))
+		float FullRateDistance = 3000.0f;
+
+	// Nothing is sent while every player is further than this. Changes are kept until one comes closer.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Replication", meta = (EditCondition = "bReplicateExecutionState", ClampMin = "0"))
+		float ReplicationCullDistance = 15000.0f;
+
+	// Triggered on clients when the state of a node is received
+	UPROPERTY(BlueprintAssignable, Category = "OpenLogic|Replication")
+		FOnReplicatedNodeStateChanged OnReplicatedNodeStateChanged;
+
+	// Returns the last replicated state of a node.
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Replication")
+		bool GetReplicatedNodeState(FGuid NodeID, FOpenLogicReplicatedNodeState& OutNodeState) const;
+
+	// Called by the replicated state when a node is received.
+	void HandleReplicatedNodeState(const FOpenLogicReplicatedNodeState& NodeState);
+
 public:
 	UFUNCTION(BlueprintPure, Category = OpenLogic)
 		UOpenLogicRuntimeGraph* GetRuntimeGraph() const { return RuntimeGraph; }
@@ -57,8 +97,31 @@ private:
 
 	UFUNCTION()
 		void HandleNodeCompleted(UOpenLogicTask* NewCompletedNode);
+
+	// Captures the outputs a task computed during its activation
+	void HandleNodeActivationEnd(UOpenLogicTask* ActivatedNode);
 	
 private:
 	UPROPERTY()
 		UOpenLogicRuntimeGraph* RuntimeGraph = nullptr;
+
+private:
+	// Captures the state of a node on the server, sent with the next update.
+	void CaptureNodeState(UOpenLogicTask* Task, EOpenLogicTaskState TaskState);
+
+	// Moves the captured states into the replicated state, at the rate allowed by the distance to the players.
+	void FlushReplicatedState();
+
+	// Returns the seconds between two updates, or a negative value if no player is close enough.
+	float GetRelevantReplicationInterval() const;
+
+	UPROPERTY(Replicated)
+		FOpenLogicReplicatedGraphState ReplicatedState;
+
+	// Node states captured since the last update, nodes can run on a background thread
+	FCriticalSection PendingNodeStatesLock;
+	TMap<FGuid, TPair<EOpenLogicTaskState, TArray<FOpenLogicReplicatedPinValue>>> PendingNodeStates;
+
+	FTimerHandle ReplicationTimerHandle;
+	double LastReplicationTime = 0.0;
 };
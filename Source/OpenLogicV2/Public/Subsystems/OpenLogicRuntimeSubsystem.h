@@ -6,13 +6,35 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "Classes/OpenLogicGraph.h"
 #include "Runtime/OpenLogicRuntimeGraph.h"
+#include "Runtime/OpenLogicBatchedGraph.h"
+#include "UObject/ObjectKey.h"
 #include "OpenLogicRuntimeSubsystem.generated.h"
 
+// A broadcast waiting for its remaining recipients to be dispatched on the next frames
+struct FOpenLogicPendingBroadcast
+{
+	TWeakObjectPtr<UClass> EventClass;
+	bool bAutoProcess = true;
+	EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal;
+	TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>> Recipients;
+	int32 NextRecipient = 0;
+
+	// When the broadcast was queued, to age it and measure its wait
+	uint64 EnqueueCycles = 0;
+};
+
 UCLASS()
-class OPENLOGICV2_API UOpenLogicRuntimeSubsystem : public UWorldSubsystem
+class OPENLOGICV2_API UOpenLogicRuntimeSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
+public:
+	//~ Begin UTickableWorldSubsystem Interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
 protected:
 	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic")
 		TArray<UOpenLogicRuntimeGraph*> ActiveRuntimeWorkers;
@@ -23,4 +45,132 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "OpenLogic")
 		FOpenLogicGraphData GetGraphData(UOpenLogicGraph* Graph);
-};
\ No newline at end of file
+
+public:
+	/**
+	 * Adds a runtime graph to the event dispatch index of this world, or refreshes its entries if it is already registered.
+	 * @param RuntimeGraph The runtime graph to register.
+	 */
+	void RegisterRuntimeGraph(UOpenLogicRuntimeGraph* RuntimeGraph);
+
+	/**
+	 * Removes a runtime graph from the event dispatch index of this world.
+	 * @param RuntimeGraph The runtime graph to unregister.
+	 */
+	void UnregisterRuntimeGraph(UOpenLogicRuntimeGraph* RuntimeGraph);
+
+	/**
+	 * Triggers the specified event on every registered runtime graph implementing it or one of its subclasses.
+	 * @param EventClass The class of the event to trigger.
+	 * @param AutoProcess Whether to automatically process the execution handles.
+	 * @param Priority The order the events run in when they wait in the background thread queue of their graph.
+	 * @return The execution handles created across all graphs.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic")
+		TArray<FOpenLogicGraphExecutionHandle> TriggerEvent(TSubclassOf<UOpenLogicTask> EventClass, bool AutoProcess = true, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
+
+	/**
+	 * Returns whether any registered runtime graph implements the specified event.
+	 * @param EventClass The class of the event.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic")
+		bool HasEventImplementations(TSubclassOf<UOpenLogicTask> EventClass) const;
+
+	/**
+	 * Returns the registered runtime graphs implementing the specified event.
+	 * @param EventClass The class of the event.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic")
+		TArray<UOpenLogicRuntimeGraph*> GetGraphsImplementingEvent(TSubclassOf<UOpenLogicTask> EventClass) const;
+
+	/**
+	 * Subscribes a runtime graph to an event bus channel.
+	 * @param RuntimeGraph The runtime graph to subscribe, it is registered if it was not already.
+	 * @param Channel The channel to subscribe to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Event Bus")
+		void SubscribeToChannel(UOpenLogicRuntimeGraph* RuntimeGraph, FName Channel);
+
+	/**
+	 * Unsubscribes a runtime graph from an event bus channel.
+	 * @param RuntimeGraph The runtime graph to unsubscribe.
+	 * @param Channel The channel to unsubscribe from.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Event Bus")
+		void UnsubscribeFromChannel(UOpenLogicRuntimeGraph* RuntimeGraph, FName Channel);
+
+	/**
+	 * Broadcasts an event to every registered runtime graph implementing it, or only to the ones subscribed to a channel.
+	 * The execution handles of all recipients are created first, then processed in a single pass.
+	 * @param EventClass The class of the event to broadcast.
+	 * @param Channel The channel to broadcast on, None to broadcast to every graph in the world.
+	 * @param AutoProcess Whether to process the created execution handles.
+	 * @param bSpreadAcrossFrames If true, at most OpenLogic.EventBus.MaxRecipientsPerFrame graphs receive the event each frame.
+	 * @param Priority The order the broadcast is dispatched in when spread across frames, and the priority of its execution handles.
+	 * @return The number of graphs the event is dispatched to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Event Bus")
+		int32 BroadcastEvent(TSubclassOf<UOpenLogicTask> EventClass, FName Channel = NAME_None, bool AutoProcess = true, bool bSpreadAcrossFrames = false, EOpenLogicExecutionPriority Priority = EOpenLogicExecutionPriority::Normal);
+
+	/**
+	 * Returns the number of broadcasts that still have recipients to dispatch to.
+	 */
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Event Bus")
+		int32 GetPendingBroadcastCount() const { return PendingBroadcasts.Num(); }
+
+	/**
+	 * Returns the number of broadcasts spread across frames waiting to start and how long they waited, one entry per priority.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Event Bus")
+		TArray<FOpenLogicPriorityQueueMetrics> GetBroadcastQueueMetrics() const;
+
+public:
+	/**
+	 * Returns the batched graph running the specified graph asset in this world, creating it on first use.
+	 * Nothing adds instances automatically: callers add each actor with AddInstance and trigger events on the batched
+	 * graph, instead of giving every actor a runtime graph component.
+	 * @param GraphAsset The graph asset to run.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Batched Graph")
+		UOpenLogicBatchedGraph* GetOrCreateBatchedGraph(UOpenLogicGraph* GraphAsset);
+
+public:
+	/**
+	 * Applies the current data of a graph asset to the runtime graphs of this world created from it, keeping their
+	 * execution handles in flight (see UOpenLogicRuntimeGraph::ApplyGraphDataPatch). Its batched graph is compiled again.
+	 * @param GraphAsset The edited graph asset.
+	 * @return The number of runtime graphs patched.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic")
+		int32 PatchRuntimeGraphs(UOpenLogicGraph* GraphAsset);
+
+private:
+	/**
+	 * Removes a runtime graph from the event dispatch index, keeping its channel subscriptions.
+	 */
+	void RemoveFromDispatchIndex(const UOpenLogicRuntimeGraph* RuntimeGraph);
+
+	/**
+	 * Creates the execution handles of every recipient, then processes them.
+	 * @return The number of execution handles created.
+	 */
+	int32 DispatchBroadcast(UClass* EventClass, bool bAutoProcess, EOpenLogicExecutionPriority Priority, TArrayView<const TWeakObjectPtr<UOpenLogicRuntimeGraph>> Recipients);
+
+	/**
+	 * Returns the index of the pending broadcast to dispatch next, the one whose priority once aged is the highest.
+	 */
+	int32 SelectNextPendingBroadcast() const;
+
+	// Event class (and each of its parent classes) to the runtime graphs implementing it
+	TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>> EventDispatchIndex;
+
+	// Event bus channel to the runtime graphs subscribed to it
+	TMap<FName, TArray<TWeakObjectPtr<UOpenLogicRuntimeGraph>>> ChannelSubscribers;
+
+	TArray<FOpenLogicPendingBroadcast> PendingBroadcasts;
+
+	FOpenLogicPriorityQueueCounters BroadcastQueueCounters[OpenLogicExecutionPriorityCount];
+
+	UPROPERTY()
+		TMap<UOpenLogicGraph*, UOpenLogicBatchedGraph*> BatchedGraphs;
+};
@@ -75,6 +75,38 @@ public:
 		bool IsCompatibleWith(UOpenLogicProperty* OtherProperty);
 
 	bool ValidatePropertyType(FProperty* Property) const;
+
+	// Returns the Value property of this class, looked up once per class.
+	const FProperty* GetValueProperty() const;
+
+	// Allocates a runtime pin value of this type, initialized to its zero value. Returns nullptr for wildcards.
+	TSharedPtr<void> AllocateValue() const;
+
+	// Copies a runtime pin value of this type. Returns false if the type is not known up front.
+	bool CopyValue(void* Dest, const void* Source) const;
+
+	// Allocates a copy of a runtime pin value of this type. Returns nullptr if the type is not known up front.
+	TSharedPtr<void> CloneValue(const void* Source) const;
+
+	// Returns the size of a runtime pin value of this type, 0 if it is not known up front.
+	int32 GetValueSize() const;
+
+	// Returns whether the value of a property can be copied as is into a runtime pin value of this type.
+	bool CanCopyValueFrom(const FProperty* Property) const;
+
+	// Returns the approximate number of bytes used by a runtime pin value of this type, including its heap allocations.
+	int64 GetValueAllocatedSize(const void* Value) const;
+
+	// Returns a runtime pin value of this type as text, for logs and traces.
+	FString ExportValueToString(const void* Value) const;
+
+	// Writes or reads a runtime pin value of this type. When loading, Value is replaced by a newly allocated value.
+	bool SerializeValue(FArchive& Ar, TSharedPtr<void>& Value) const;
+
+private:
+	// Cached on the class default object by GetValueProperty().
+	mutable const FProperty* CachedValueProperty = nullptr;
+	mutable bool bValuePropertyCached = false;
 };
 
 UINTERFACE(Blueprintable)
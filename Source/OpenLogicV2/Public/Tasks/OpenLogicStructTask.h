@@ -0,0 +1,126 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTypedPin.h"
+#include "OpenLogicStructTask.generated.h"
+
+class UOpenLogicRuntimeGraph;
+struct FOpenLogicStructTaskContext;
+
+/**
+ * The logic of a struct task. Functions are static, they receive the node they run for through the context.
+ */
+struct FOpenLogicStructTaskFunctions
+{
+	// Called when the node is activated. Required.
+	void (*Activate)(FOpenLogicStructTaskContext& Context) = nullptr;
+
+	// Called when the node completes or is released before completing. Optional.
+	void (*Completed)(FOpenLogicStructTaskContext& Context) = nullptr;
+};
+
+/**
+ * Gives a struct task access to the node it runs for: its instance data, pins and execution flow.
+ * Pins are addressed by index, which is the position of the pin in TaskData plus one.
+ */
+struct OPENLOGICV2_API FOpenLogicStructTaskContext
+{
+public:
+	FOpenLogicStructTaskContext(UOpenLogicRuntimeGraph& InGraph, FOpenLogicRuntimeNode& InRuntimeNode, const FOpenLogicNode& InNodeData, FName InPinName);
+
+	// The instance data of the node, nullptr if the task has none or it is of another type.
+	template <typename T>
+	T* GetInstanceData() const
+	{
+		return RuntimeNode.InstanceData.GetMutablePtr<T>();
+	}
+
+	// The input execution pin the node was activated through, NAME_None for data nodes.
+	FName GetPinName() const { return PinName; }
+
+	const FGuid& GetNodeID() const { return RuntimeNode.NodeID; }
+
+	UObject* GetContextObject() const;
+
+	UOpenLogicRuntimeGraph& GetRuntimeGraph() const { return Graph; }
+
+	// Returns the value of an input data pin, shared with the output it comes from.
+	TSharedPtr<void> GetInputValue(int32 PinIndex) const;
+
+	// Returns the value of an input data pin, or the default value of T if the pin has no value.
+	template <typename T>
+	T GetInput(int32 PinIndex) const
+	{
+		const TSharedPtr<void> Value = GetInputValue(PinIndex);
+		return Value.IsValid() ? *static_cast<const T*>(Value.Get()) : T();
+	}
+
+	// Sets an output data pin to a value, shared as is with the pins reading it.
+	void SetOutputValue(int32 PinIndex, const TSharedPtr<void>& Value) const;
+
+	// Sets an output data pin, written in place into the storage preallocated for the pin.
+	template <typename T>
+	void SetOutput(int32 PinIndex, const T& Value) const
+	{
+		const bool bWritten = WriteOutput(PinIndex, [&Value](const UOpenLogicProperty* PropertyObject, void* Dest)
+		{
+			if (!PropertyObject->IsA(TOpenLogicPinType<T>::GetPropertyClass()))
+			{
+				return false;
+			}
+
+			*static_cast<T*>(Dest) = Value;
+			return true;
+		});
+
+		if (!bWritten)
+		{
+			SetOutputValue(PinIndex, MakeShared<T>(Value));
+		}
+	}
+
+	// Runs the nodes connected to an output execution pin.
+	bool ExecutePin(int32 PinIndex) const;
+
+	// Completes the node, after running the nodes connected to an output execution pin if one is given.
+	void Complete(int32 PinIndex = INDEX_NONE) const;
+
+private:
+	bool WriteOutput(int32 PinIndex, TFunctionRef<bool(const UOpenLogicProperty*, void*)> Writer) const;
+
+	UOpenLogicRuntimeGraph& Graph;
+	FOpenLogicRuntimeNode& RuntimeNode;
+	const FOpenLogicNode& NodeData;
+	FName PinName;
+};
+
+/**
+ * A task that runs without a task instance. The class is only used through its default object, which declares the
+ * pins of the node and its logic: a table of static functions, and the type of the state kept inline in each runtime
+ * node. Nodes of struct tasks are not pooled, not visible to the garbage collector and can be mixed with other tasks
+ * in the same graph.
+ *
+ * Struct tasks are synchronous: nodes entered through an execution pin complete before Activate returns, and nodes
+ * without execution pins only write their outputs. Their logic has to be deterministic, they are run again on replay.
+ */
+UCLASS(Abstract)
+class OPENLOGICV2_API UOpenLogicStructTask : public UOpenLogicTask
+{
+	GENERATED_BODY()
+public:
+	UOpenLogicStructTask(const FObjectInitializer& ObjectInitializer);
+
+	// The type of the state of each node, nullptr if the task has no state.
+	const UScriptStruct* InstanceDataType = nullptr;
+
+	FOpenLogicStructTaskFunctions Functions;
+
+protected:
+	template <typename T>
+	void SetInstanceDataType()
+	{
+		InstanceDataType = T::StaticStruct();
+	}
+};
@@ -12,6 +12,8 @@
 class UNodeBase;
 class UDisplayableWidgetBase;
 class UOpenLogicRuntimeEventContext;
+struct FOpenLogicBatchContext;
+class FOpenLogicTypedPinBase;
 
 UCLASS(Blueprintable, BlueprintType, Meta = (ShowWorldContextPin), Abstract)
 class OPENLOGICV2_API UOpenLogicTask : public UObject, public FTickableGameObject
@@ -51,6 +53,37 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runtime")
 		bool bIsTickable = false;
 
+	// Whether the outputs of this task depend on something outside the graph (randomness, time, world queries...).
+	// Execution traces record what it produced instead of running it again on replay.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Runtime")
+		bool bIsNonDeterministic = false;
+
+	// The relative cost of one activation of this task. The graph analyzer adds these up to estimate the cost of each event.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0"))
+		float EstimatedCost = 1.0f;
+
+	// Whether this task completes asynchronously (delays, timers, requests...).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+		bool bIsLatent = false;
+
+	// Cancels the nodes of this task that wait longer than this on a latent completion, see OnTaskCancelled.
+	// 0 disables the timeout. Runtime graphs can override it per node with SetNodeTimeout.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Runtime", meta = (ClampMin = "0", Units = "s"))
+		float TimeoutSeconds = 0.0f;
+
+	// The output pin this task executes repeatedly within a single activation, if it is a loop.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+		FName LoopBodyPin = NAME_None;
+
+	// Whether this task only reads its inputs and writes its outputs, without touching the world or other objects,
+	// so it can run on the background thread of a graph.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+		bool bIsThreadSafe = false;
+
+	// Whether this task implements OnTaskActivatedBatch and can run in a batched graph.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Runtime")
+		bool bSupportsBatchedExecution = false;
+
 public:
 	UFUNCTION()
 		FOpenLogicPinData GetInputPinData(int32 PinIndex) const;
@@ -102,6 +135,28 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "OpenLogic")
 		void OnTaskCompleted();
 
+	// Called when the task is cancelled while waiting on a latent completion, right before OnTaskCompleted. The task
+	// is returned to its pool right after, its outputs are not executed anymore.
+	UFUNCTION(BlueprintNativeEvent, Category = "OpenLogic")
+		void OnTaskCancelled(EOpenLogicCancellationReason Reason);
+
+	// Returns whether the execution handle running the task was cancelled. Long running work should check it and stop.
+	UFUNCTION(BlueprintPure, Category = "OpenLogic")
+		bool IsCancellationRequested() const;
+
+	// Returns the cancellation token of the execution handle running the task, which can be kept and checked from any
+	// thread. The token is never cancelled if the task is not running.
+	FOpenLogicCancellationToken GetCancellationToken() const;
+
+	// Called instead of OnTaskActivated in a batched graph, once for all the instances the node is activated for.
+	// Read the inputs and write the outputs through the columns of the context, indexed by instance.
+	virtual void OnTaskActivatedBatch(FOpenLogicBatchContext& Context) {}
+
+	// Saves or restores the runtime state of this instance in a graph snapshot (see UOpenLogicRuntimeGraph::SaveState).
+	// Serializes the properties marked SaveGame by default. Override it to save state held outside of the task,
+	// such as a pending latent action, and call Super.
+	virtual void SerializeTaskState(FArchive& Ar);
+
 public:
 	// Event triggered when a node widget that uses this task class is initialized.
 	UFUNCTION(BlueprintNativeEvent, Category = "OpenLogic")
@@ -154,7 +209,36 @@ public:
             return;
         }
 
-		RuntimeGraph->SetDataPropertyValue(this, PinName, MakeShared<T>(Value));
+		// Trivially copyable values and strings are written in place when the pin has a slot of the same layout
+		const bool bWritten = RuntimeGraph->WriteOutputSlot(this, PinName, [&Value](const UOpenLogicProperty* PropertyObject, void* Dest)
+		{
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				if (PropertyObject->GetValueSize() != sizeof(T))
+				{
+					return false;
+				}
+			}
+			else if constexpr (std::is_same_v<T, FString>)
+			{
+				if (PropertyObject->UnderlyingType != EOpenLogicUnderlyingType::String)
+				{
+					return false;
+				}
+			}
+			else
+			{
+				return false;
+			}
+
+			*static_cast<T*>(Dest) = Value;
+			return true;
+		});
+
+		if (!bWritten)
+		{
+			RuntimeGraph->SetDataPropertyValue(this, PinName, MakeShared<T>(Value));
+		}
 	}
 
 	template <typename T>
@@ -210,7 +294,7 @@ public:
 
 		if (ParamInstance)
 		{
-			FProperty* TargetProperty = FindFProperty<FProperty>(ParamInstance->GetClass(), TEXT("Value"));
+			const FProperty* TargetProperty = ParamInstance->GetValueProperty();
 
 			if (TargetProperty)
 			{
@@ -243,7 +327,7 @@ public:
 			UOpenLogicProperty* ParamInstance = P_THIS->GetInputProperty(nullptr, InputPinIndex);
 			if (ParamInstance)
 			{
-				FProperty* SourceProperty = FindFProperty<FProperty>(ParamInstance->GetClass(), TEXT("Value"));
+				const FProperty* SourceProperty = ParamInstance->GetValueProperty();
 				if (SourceProperty)
 				{
 					void* SourceAddress = SourceProperty->ContainerPtrToValuePtr<void>(ParamInstance);
@@ -275,7 +359,7 @@ public:
 			UOpenLogicProperty* ParamInstance = P_THIS->GetOutputProperty(nullptr, OutputPinIndex);
 			if (ParamInstance)
 			{
-				FProperty* SourceProperty = FindFProperty<FProperty>(ParamInstance->GetClass(), TEXT("Value"));
+				const FProperty* SourceProperty = ParamInstance->GetValueProperty();
 				if (SourceProperty)
 				{
 					void* SourceAddress = SourceProperty->ContainerPtrToValuePtr<void>(ParamInstance);
@@ -324,10 +408,37 @@ public:
 
 	UFUNCTION()
 		void ResetTaskState();
+
+	// Binds this instance to the runtime node and execution handle it runs for. Cleared when it goes back to its pool.
+	void BindRuntimeNode(const TSharedPtr<FOpenLogicRuntimeNode>& RuntimeNode, const TSharedPtr<FOpenLogicGraphExecutionHandle>& ExecutionHandle);
+
+	// Returns the bound runtime node, or nullptr if it no longer runs this instance.
+	TSharedPtr<FOpenLogicRuntimeNode> GetBoundRuntimeNode() const;
+
+	// Returns the bound execution handle, or nullptr if the bound runtime node is no longer valid.
+	TSharedPtr<FOpenLogicGraphExecutionHandle> GetBoundExecutionHandle() const;
+
+	// Returns the pin schema hash of the class, which baked pin handles are validated against.
+	uint32 GetPinSchemaHash() const;
+
 private:
 	UPROPERTY()
 		TMap<int32, UOpenLogicProperty*> DynamicProperties;
 
+	// Cached on the class default object by GetPinSchemaHash(), outside the editor where pins cannot change.
+	mutable uint32 CachedPinSchemaHash = 0;
+
+	// The typed pins declared as members of this task, see TOpenLogicInput and TOpenLogicOutput.
+	friend class FOpenLogicTypedPinBase;
+	TArray<FOpenLogicTypedPinBase*> TypedPins;
+
+	// Binds the typed pins to the pins of the task.
+	void BindTypedPins();
+
+	// Direct references to the runtime state of this instance, so it does not have to be looked up in the runtime graph.
+	TWeakPtr<FOpenLogicRuntimeNode> BoundRuntimeNode;
+	TWeakPtr<FOpenLogicGraphExecutionHandle> BoundExecutionHandle;
+
 	UPROPERTY()
 		UOpenLogicRuntimeGraph* RuntimeGraph = nullptr;
 	
@@ -373,6 +484,7 @@ protected:
 		TMap<FGuid, FName> BlueprintTaskProperties;
 
 public:
+	virtual void PostInitProperties() override;
 	virtual UWorld* GetWorld() const override;
 	virtual bool CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack) override;
 	virtual int32 GetFunctionCallspace(UFunction* Function, FFrame* Stack) override;
@@ -0,0 +1,189 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/OpenLogicTask.h"
+#include "Classes/Properties/OpenLogicActor.h"
+#include "Classes/Properties/OpenLogicBoolean.h"
+#include "Classes/Properties/OpenLogicByte.h"
+#include "Classes/Properties/OpenLogicDouble.h"
+#include "Classes/Properties/OpenLogicFloat.h"
+#include "Classes/Properties/OpenLogicFloatArray.h"
+#include "Classes/Properties/OpenLogicInteger.h"
+#include "Classes/Properties/OpenLogicObject.h"
+#include "Classes/Properties/OpenLogicRotator.h"
+#include "Classes/Properties/OpenLogicString.h"
+#include "Classes/Properties/OpenLogicText.h"
+#include "Classes/Properties/OpenLogicTransform.h"
+#include "Classes/Properties/OpenLogicVector.h"
+#include "Classes/Properties/OpenLogicVectorArray.h"
+
+class AActor;
+
+/**
+ * Maps the C++ type of a typed pin to the property class of the pin. Declaring a typed pin of a type that has no
+ * mapping does not compile, specialize it with OPENLOGIC_DECLARE_PIN_TYPE to add one.
+ */
+template <typename T>
+struct TOpenLogicPinType;
+
+#define OPENLOGIC_DECLARE_PIN_TYPE(CppType, PropertyClass) \
+	template <> \
+	struct TOpenLogicPinType<CppType> \
+	{ \
+		static UClass* GetPropertyClass() { return PropertyClass::StaticClass(); } \
+	};
+
+OPENLOGIC_DECLARE_PIN_TYPE(bool, UOpenLogicBoolean)
+OPENLOGIC_DECLARE_PIN_TYPE(uint8, UOpenLogicByte)
+OPENLOGIC_DECLARE_PIN_TYPE(int32, UOpenLogicInteger)
+OPENLOGIC_DECLARE_PIN_TYPE(float, UOpenLogicFloat)
+OPENLOGIC_DECLARE_PIN_TYPE(double, UOpenLogicDouble)
+OPENLOGIC_DECLARE_PIN_TYPE(FString, UOpenLogicString)
+OPENLOGIC_DECLARE_PIN_TYPE(FText, UOpenLogicText)
+OPENLOGIC_DECLARE_PIN_TYPE(FVector, UOpenLogicVector)
+OPENLOGIC_DECLARE_PIN_TYPE(FRotator, UOpenLogicRotator)
+OPENLOGIC_DECLARE_PIN_TYPE(FTransform, UOpenLogicTransform)
+OPENLOGIC_DECLARE_PIN_TYPE(UObject*, UOpenLogicObject)
+OPENLOGIC_DECLARE_PIN_TYPE(AActor*, UOpenLogicActor)
+OPENLOGIC_DECLARE_PIN_TYPE(TArray<float>, UOpenLogicFloatArray)
+OPENLOGIC_DECLARE_PIN_TYPE(TArray<FVector>, UOpenLogicVectorArray)
+
+/**
+ * The part of a typed pin that does not depend on its type. Typed pins register with their task when it is
+ * constructed, and are bound to the pins of the task once its properties are initialized.
+ */
+class OPENLOGICV2_API FOpenLogicTypedPinBase
+{
+public:
+	FOpenLogicTypedPinBase(UOpenLogicTask* InOwner, FName InPinName, EOpenLogicPinDirection InDirection, UClass* InPropertyClass, const FText& InDescription);
+
+	FOpenLogicTypedPinBase(const FOpenLogicTypedPinBase&) = delete;
+	FOpenLogicTypedPinBase& operator=(const FOpenLogicTypedPinBase&) = delete;
+
+	// The handle the pin is accessed through, with the pin index baked in once bound.
+	const FOpenLogicPinHandle& GetHandle() const { return Handle; }
+
+	// Whether the task has a pin of this name and type.
+	bool IsBound() const { return Handle.PinIndex != INDEX_NONE; }
+
+protected:
+	UOpenLogicTask* Owner = nullptr;
+	FOpenLogicPinHandle Handle;
+
+private:
+	friend class UOpenLogicTask;
+
+	// Adds the pin to the pins of the task if its constructor did not declare it.
+	void Declare(FTaskData& TaskData) const;
+
+	// Resolves the index of the pin in the pins of the task, and checks that it has the type of the typed pin.
+	void Bind(const FTaskData& TaskData);
+
+	EOpenLogicPinDirection Direction = EOpenLogicPinDirection::Input;
+	UClass* PropertyClass = nullptr;
+	FText Description;
+};
+
+/**
+ * An input data pin of a C++ task, read with its C++ type. Declare the pin in the constructor of the task as well to
+ * place it among the other pins, otherwise it is added after them.
+ *
+ *	TOpenLogicInput<float> Duration { this, "Duration" };
+ */
+template <typename T>
+class TOpenLogicInput : public FOpenLogicTypedPinBase
+{
+public:
+	TOpenLogicInput(UOpenLogicTask* InOwner, FName InPinName, const FText& InDescription = FText::GetEmpty())
+		: FOpenLogicTypedPinBase(InOwner, InPinName, EOpenLogicPinDirection::Input, TOpenLogicPinType<T>::GetPropertyClass(), InDescription)
+	{
+	}
+
+	// Returns the value of the pin, or the default value of T if the task is not running or the pin is not of type T.
+	T Get() const
+	{
+		const T* Value = GetPtr();
+		return Value ? *Value : T();
+	}
+
+	// Returns the value of the pin without copying it, for values such as arrays. Valid until the task completes,
+	// nullptr if the task is not running, the pin has no value or it is not of type T.
+	const T* GetPtr() const
+	{
+		UOpenLogicRuntimeGraph* Graph = EnsureBound() ? Owner->GetRuntimeGraph() : nullptr;
+		const TSharedPtr<void> Value = Graph ? Graph->GetDataPropertyValue(Owner, Handle, TOpenLogicPinType<T>::GetPropertyClass()) : nullptr;
+		return static_cast<const T*>(Value.Get());
+	}
+
+	// Returns the value of the pin to modify it in place, copied first if other pins share it. nullptr if the task is
+	// not running, the pin has no value or it is not of type T.
+	T* GetMutable() const
+	{
+		UOpenLogicRuntimeGraph* Graph = EnsureBound() ? Owner->GetRuntimeGraph() : nullptr;
+		return Graph ? static_cast<T*>(Graph->GetMutableDataPropertyValue(Owner, Handle, TOpenLogicPinType<T>::GetPropertyClass())) : nullptr;
+	}
+
+private:
+	// The value of an unbound pin is not known to be a T, it is never read
+	bool EnsureBound() const
+	{
+		return ensureMsgf(IsBound(), TEXT("[TOpenLogicInput] Pin %s of %s is not bound."), *Handle.PinName.ToString(), *Owner->GetClass()->GetName());
+	}
+};
+
+/**
+ * An output data pin of a C++ task, written with its C++ type into the storage preallocated for the pin.
+ *
+ *	TOpenLogicOutput<int32> Index { this, "Index" };
+ */
+template <typename T>
+class TOpenLogicOutput : public FOpenLogicTypedPinBase
+{
+public:
+	TOpenLogicOutput(UOpenLogicTask* InOwner, FName InPinName, const FText& InDescription = FText::GetEmpty())
+		: FOpenLogicTypedPinBase(InOwner, InPinName, EOpenLogicPinDirection::Output, TOpenLogicPinType<T>::GetPropertyClass(), InDescription)
+	{
+	}
+
+	// Sets the value of the pin. Only valid while the task is running.
+	void Set(const T& Value) const
+	{
+		SetValue(Value);
+	}
+
+	// Moves a value into the pin, to avoid copying values such as arrays. Only valid while the task is running.
+	void Set(T&& Value) const
+	{
+		SetValue(MoveTemp(Value));
+	}
+
+private:
+	template <typename ValueType>
+	void SetValue(ValueType&& Value) const
+	{
+		UOpenLogicRuntimeGraph* Graph = Owner->GetRuntimeGraph();
+		if (!Graph)
+		{
+			return;
+		}
+
+		const bool bWritten = Graph->WriteOutputSlot(Owner, Handle, [&Value](const UOpenLogicProperty* PropertyObject, void* Dest)
+		{
+			// The type of the pin can change when the graph is patched while running
+			if (!PropertyObject->IsA(TOpenLogicPinType<T>::GetPropertyClass()))
+			{
+				return false;
+			}
+
+			*static_cast<T*>(Dest) = Forward<ValueType>(Value);
+			return true;
+		});
+
+		if (!bWritten)
+		{
+			Graph->SetDataPropertyValue(Owner, Handle, MakeShared<T>(Forward<ValueType>(Value)));
+		}
+	}
+};
@@ -0,0 +1,161 @@
+// Copyright 2025 - NegativeNameSeller
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/OpenLogicTypes.h"
+#include "OpenLogicGraphAnalyzer.generated.h"
+
+// Forward declarations
+class UOpenLogicTask;
+
+UENUM(BlueprintType)
+enum class EOpenLogicLintSeverity : uint8
+{
+	Info,
+	Warning,
+	Error
+};
+
+UENUM(BlueprintType)
+enum class EOpenLogicLintRule : uint8
+{
+	// A data producer that is re-evaluated on demand feeds a loop or its body.
+	ReevaluatedInLoop,
+
+	// A latent node is executed from a loop body, the loop continues without waiting for it.
+	LatentInLoop,
+
+	// The execution connections form a cycle.
+	ExecutionCycle,
+
+	// The node is never executed or read from any event.
+	UnreachableNode,
+
+	// A pin default value or task property holds a very large literal.
+	LargeLiteral,
+
+	// The node sits at the end of a long chain of data dependencies.
+	DeepDataChain
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicLintIssue
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		EOpenLogicLintRule Rule = EOpenLogicLintRule::UnreachableNode;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		EOpenLogicLintSeverity Severity = EOpenLogicLintSeverity::Warning;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		FGuid NodeID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		FText Message;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicEventCost
+{
+	GENERATED_USTRUCT_BODY()
+
+	// The event node the cost was estimated from.
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		FGuid NodeID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		TSubclassOf<UOpenLogicTask> EventClass;
+
+	// The sum of the EstimatedCost of every node the event can execute or read, loop bodies multiplied by the assumed iteration count.
+	// Every branch is counted, so this is an upper bound.
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		float EstimatedCost = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		int32 ReachableNodeCount = 0;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicGraphAnalyzerSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	// Literals longer than this (in characters, or bytes for serialized values) are reported.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis")
+		int32 MaxLiteralLength = 4096;
+
+	// Data chains deeper than this are reported.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis")
+		int32 MaxDataChainDepth = 8;
+
+	// The number of iterations assumed for every loop when estimating costs.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Analysis")
+		int32 AssumedLoopIterations = 10;
+};
+
+USTRUCT(BlueprintType)
+struct OPENLOGICV2_API FOpenLogicGraphAnalysis
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		TArray<FOpenLogicLintIssue> Issues;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+		TArray<FOpenLogicEventCost> EventCosts;
+
+	TArray<FOpenLogicLintIssue> GetIssuesForNode(const FGuid& NodeID) const;
+};
+
+/**
+ * Walks graph data without running it and reports performance hazards, along with an estimated cost per event.
+ * Costs come from UOpenLogicTask::EstimatedCost, loops and latent tasks from UOpenLogicTask::LoopBodyPin and bIsLatent.
+ */
+class OPENLOGICV2_API FOpenLogicGraphAnalyzer
+{
+public:
+	static FOpenLogicGraphAnalysis Analyze(const FOpenLogicGraphData& GraphData, const FOpenLogicGraphAnalyzerSettings& Settings = FOpenLogicGraphAnalyzerSettings());
+
+	// Writes the issues and event costs to the "OpenLogic" message log.
+	static void ReportToMessageLog(const FOpenLogicGraphAnalysis& Analysis, const FOpenLogicGraphData& GraphData, const FString& GraphName);
+
+private:
+	FOpenLogicGraphAnalyzer(const FOpenLogicGraphData& InGraphData, const FOpenLogicGraphAnalyzerSettings& InSettings);
+
+	void CheckUnreachableNodes();
+	void CheckExecutionCycles();
+	void CheckLoops();
+	void CheckLiterals();
+	void CheckDataChains();
+	void EstimateEventCosts();
+
+	const UOpenLogicTask* GetTask(const FGuid& NodeID) const;
+	FString GetNodeName(const FGuid& NodeID) const;
+
+	// The nodes executed from the output pins of a node, optionally limited to one pin.
+	TArray<FGuid> GetExecutionTargets(const FGuid& NodeID, FName OnlyPin = NAME_None) const;
+
+	// The nodes whose outputs feed the input pins of a node.
+	TArray<FGuid> GetDataProducers(const FGuid& NodeID) const;
+
+	// Every node executed from the given nodes, following execution connections.
+	TSet<FGuid> CollectExecutionReachable(const TArray<FGuid>& StartNodes) const;
+
+	int32 GetDataChainDepth(const FGuid& NodeID, TMap<FGuid, int32>& Depths, TSet<FGuid>& Visiting) const;
+	float EstimateExecutionCost(const FGuid& NodeID, float Multiplier, TSet<FGuid>& Visited, TSet<FGuid>& CountedProducers, TSet<FGuid>& Reached) const;
+	float EstimateDataCost(const FGuid& NodeID, float Multiplier, TSet<FGuid>& CountedProducers, TSet<FGuid>& Reached, int32 Depth) const;
+
+	void AddIssue(EOpenLogicLintRule Rule, EOpenLogicLintSeverity Severity, const FGuid& NodeID, const FText& Message);
+
+private:
+	const FOpenLogicGraphData& GraphData;
+	const FOpenLogicGraphAnalyzerSettings& Settings;
+
+	TMap<FGuid, const UOpenLogicTask*> Tasks;
+	TArray<FGuid> EventNodes;
+
+	FOpenLogicGraphAnalysis Result;
+};
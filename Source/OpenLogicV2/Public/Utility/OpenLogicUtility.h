@@ -9,6 +9,7 @@
 #include "Classes/OpenLogicGraph.h"
 #include "Runtime/OpenLogicRuntimeGraph.h"
 #include "Widgets/ExecutionPinBase.h"
+#include "Profiling/OpenLogicLatency.h"
 #include "OpenLogicUtility.generated.h"
 
 UCLASS(Blueprintable)
@@ -29,6 +30,19 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic", meta = (DefaultToSelf = "ContextObject"))
 		static void LagTest();
+
+public:
+	// Returns the trigger-to-completion latency recorded for an event class, across every runtime graph.
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Latency")
+		static bool GetEventLatency(TSubclassOf<UOpenLogicTask> EventClass, FOpenLogicEventLatency& OutLatency);
+
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Latency")
+		static TArray<FOpenLogicEventLatency> GetAllEventLatencies();
+
+	// Resets the latency histograms of an event class, or of every event class if none is given.
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Latency")
+		static void ResetEventLatency(TSubclassOf<UOpenLogicTask> EventClass);
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic", CustomThunk, meta = (CustomStructureParam = "InStruct"))
 		void StructToPayload(FString& Payload, bool& Success, const UStruct* InStruct);
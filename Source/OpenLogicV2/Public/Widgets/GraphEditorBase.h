@@ -352,10 +352,21 @@ private:
 	UFUNCTION()
 		void OnRuntimeTaskCompleted(UOpenLogicTask* CompletedRuntimeTask);
 
+	void OnRuntimeDebugEvents(TConstArrayView<FOpenLogicNodeDebugEvent> Events, int32 DroppedCount);
+
+public:
+	// Whether the bound runtime worker reports its node events once per frame instead of once per node.
+	// Nodes that ran several times in a frame are then only reported once, with their latest state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Debug")
+		bool bBatchRuntimeEvents = true;
+
 private:
 	UPROPERTY()
 		UOpenLogicRuntimeGraph* BoundRuntimeWorker;
 
+	// Whether BoundRuntimeWorker was bound through its debug event stream
+	bool bBoundToDebugEventStream = false;
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic")
 		bool SetZoomLevel(float NewZoomLevel);
@@ -399,6 +410,44 @@ protected:
 	UPROPERTY()
 		bool bCanSaveGraphPosition = false;
 
+public:
+	// Runs the graph analyzer on the active graph, reports the results to the message log and shows the issues on the node widgets.
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Analysis")
+		FOpenLogicGraphAnalysis AnalyzeGraph();
+
+	UFUNCTION(BlueprintPure, Category = "OpenLogic|Analysis")
+		const FOpenLogicGraphAnalysis& GetLastAnalysis() const { return LastAnalysis; }
+
+public:
+	// Whether the graph is analyzed for performance hazards after it is saved.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Analysis")
+		bool bAnalyzeOnSave = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Analysis")
+		FOpenLogicGraphAnalyzerSettings AnalyzerSettings;
+
+	// Whether saved changes are patched into the runtime graphs running this graph in game and play in editor worlds.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OpenLogic|Runtime")
+		bool bPatchRunningGraphsOnSave = true;
+
+protected:
+	UFUNCTION()
+		void OnGraphSaved_Internal(FOpenLogicGraphData GraphData);
+
+	UFUNCTION()
+		void Timer_AnalyzeGraph();
+
+	UFUNCTION()
+		void Timer_PatchRunningGraphs();
+
+protected:
+	UPROPERTY()
+		FOpenLogicGraphAnalysis LastAnalysis;
+
+	// Saves come in bursts (moving a node, connecting pins), the analysis runs once they settle.
+	FTimerHandle TimerHandle_AnalyzeGraph;
+	FTimerHandle TimerHandle_PatchRunningGraphs;
+
 public:
 	// Sets the position of the grid material.
 	UFUNCTION(BlueprintCallable, Category = "OpenLogic")
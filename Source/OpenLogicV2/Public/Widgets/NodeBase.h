@@ -9,6 +9,7 @@
 #include "Components/Widget.h"
 #include "Components/TextBlock.h"
 #include "ExecutionPinBase.h"
+#include "Utility/OpenLogicGraphAnalyzer.h"
 #include "NodeBase.generated.h"
 
 // Forward declarations
@@ -154,6 +155,25 @@ public:
 public:
 	UFUNCTION(BlueprintPure, Category = OpenLogic)
 		FOpenLogicNode& GetNodeStateData() const;
+
+public:
+	// Updates the graph analyzer issues reported for this node.
+	UFUNCTION(BlueprintCallable, Category = "OpenLogic|Analysis")
+		void SetLintIssues(const TArray<FOpenLogicLintIssue>& NewIssues);
+
+	// Called when the graph analyzer issues of this node change. The default implementation appends them to the node tooltip.
+	UFUNCTION(BlueprintNativeEvent, Category = "OpenLogic|Analysis")
+		void OnLintIssuesChanged(const TArray<FOpenLogicLintIssue>& Issues);
+
+protected:
+	// The graph analyzer issues reported for this node at the last save.
+	UPROPERTY(BlueprintReadOnly, Category = "OpenLogic|Analysis")
+		TArray<FOpenLogicLintIssue> LintIssues;
+
+private:
+	// The tooltip of the node before the lint issues were appended to it, restored once they are fixed.
+	FText ToolTipWithoutLintIssues;
+	bool bToolTipHasLintIssues = false;
 	
 public:
 	UFUNCTION(BlueprintPure, Category = OpenLogic)